@@ -71,6 +71,168 @@ def addAladdinOptions(parser):
         help="Aladdin accelerator configuration file.")
     parser.add_option("--aladdin-debugger", action="store_true",
         help="Run the Aladdin debugger on accelerator initialization.")
+    parser.add_option("--accel-sweep", default=None,
+        help="File that lists the Aladdin accelerator configuration files "
+        "of a set of design points, one per line. The simulator is forked "
+        "at the first accelerator invocation to simulate each of them, "
+        "with the outputs in the outputs directory next to its file.")
+    parser.add_option("--accel-sweep-jobs", type="int", default=None,
+        help="Number of design points of --accel-sweep to simulate at once "
+        "[Default: the number of host CPUs]")
+    parser.add_option("--kvm-fast-forward", action="store_true",
+        help="Run the CPU code up to the first accelerator invocation "
+        "natively with KVM, then switch to --cpu-type. System calls are "
+        "emulated as usual. Only for x86 hosts and workloads.")
+    parser.add_option("--kvm-perf", action="store_true",
+        help="Count the cycles and instructions of --kvm-fast-forward with "
+        "the host performance counters, which virtualized hosts often "
+        "don't have. Otherwise the host clock is used, and instructions "
+        "aren't counted.")
+
+# Accelerators of the design points of --accel-sweep stand in for the
+# request code they are invoked with, and get ids above it.
+ACCEL_SWEEP_ID_STRIDE = 1 << 20
+
+def read_accel_config(cfg_file):
+    """Reads an accelerator configuration file on top of the defaults."""
+    # First read all default values.
+    default_cfg = ConfigParser.SafeConfigParser()
+    default_cfg_file = os.path.join(
+        os.path.dirname(os.path.realpath(__file__)), "aladdin_template.cfg")
+    default_cfg.read(default_cfg_file)
+    defaults = dict(i for i in default_cfg.items("DEFAULT"))
+
+    # Now read the actual supplied config file using the defaults.
+    config = ConfigParser.SafeConfigParser(defaults)
+    config.read(cfg_file)
+    if not config.sections():
+        fatal("No accelerators were specified in %s!" % cfg_file)
+    return config
+
+def create_datapath(config, accel, name, accel_id):
+    """Creates the datapath of one accelerator of a configuration file."""
+    memory_type = config.get(accel, 'memory_type').lower()
+    # Accelerators need their own clock domain!
+    cycleTime = config.getint(accel, "cycle_time")
+    clock = "%1.3fGHz" % (1/cycleTime)
+    clk_domain = SrcClockDomain(
+        clock = clock, voltage_domain = system.cpu_voltage_domain)
+    # Set the globally required parameters.
+    datapath = HybridDatapath(
+        clk_domain = clk_domain,
+        benchName = accel,
+        # TODO: Ideally bench_name would change to output_prefix but that's a
+        # pretty big breaking change.
+        outputPrefix = config.get(accel, "bench_name"),
+        traceFileName = config.get(accel, "trace_file_name"),
+        configFileName = config.get(accel, "config_file_name"),
+        acceleratorName = name,
+        acceleratorId = accel_id,
+        cycleTime = cycleTime,
+        useDb = config.getboolean(accel, "use_db"),
+        experimentName = config.get(accel, "experiment_name"),
+        enableStatsDump = options.enable_stats_dump_and_resume,
+        executeStandalone = (np == 0))
+    datapath.cacheLineFlushLatency = config.getint(accel, "cacheline_flush_latency")
+    datapath.cacheLineInvalidateLatency = config.getint(accel, "cacheline_invalidate_latency")
+    datapath.dmaSetupOverhead = config.getint(accel, "dma_setup_overhead")
+    datapath.maxDmaRequests = config.getint(accel, "max_dma_requests")
+    datapath.numDmaChannels = config.getint(accel, "num_dma_channels")
+    datapath.dmaChunkSize = config.getint(accel, "dma_chunk_size")
+    datapath.pipelinedDma = config.getboolean(accel, "pipelined_dma")
+    datapath.ignoreCacheFlush = config.getboolean(accel, "ignore_cache_flush")
+    datapath.invalidateOnDmaStore = config.getboolean(accel, "invalidate_on_dma_store")
+    datapath.recordMemoryTrace = config.getboolean(accel, "record_memory_trace")
+    datapath.enableAcp = config.getboolean(accel, "enable_acp")
+    datapath.useAcpCache = True
+    datapath.acpCacheSize = config.get(accel, "acp_cache_size")
+    datapath.acpCacheLatency = config.getint(accel, "acp_cache_latency")
+    datapath.acpCacheMSHRs = config.getint(accel, "acp_cache_mshrs")
+    datapath.useAladdinDebugger = options.aladdin_debugger
+    if memory_type == "cache":
+      datapath.cacheSize = config.get(accel, "cache_size")
+      datapath.cacheBandwidth = config.get(accel, "cache_bandwidth")
+      datapath.cacheQueueSize = config.get(accel, "cache_queue_size")
+      datapath.cacheAssoc = config.getint(accel, "cache_assoc")
+      datapath.cacheHitLatency = config.getint(accel, "cache_hit_latency")
+      datapath.cacheLineSize = options.cacheline_size
+      datapath.cactiCacheConfig = config.get(accel, "cacti_cache_config")
+      datapath.tlbEntries = config.getint(accel, "tlb_entries")
+      datapath.tlbAssoc = config.getint(accel, "tlb_assoc")
+      datapath.tlbHitLatency = config.getint(accel, "tlb_hit_latency")
+      datapath.tlbMissLatency = config.getint(accel, "tlb_miss_latency")
+      datapath.tlbCactiConfig = config.get(accel, "cacti_tlb_config")
+      datapath.tlbPageBytes = config.getint(accel, "tlb_page_size")
+      datapath.numOutStandingWalks = config.getint(
+          accel, "tlb_max_outstanding_walks")
+      datapath.tlbBandwidth = config.getint(accel, "tlb_bandwidth")
+    elif memory_type == "spad" and options.ruby:
+      # If the memory_type is spad, Aladdin will initialize a 2-way cache for
+      # every datapath, although this cache will not be used in simulation.
+      # Ruby doesn't support direct-mapped caches, so set the assoc to 2.
+      datapath.cacheAssoc = 2
+    if (memory_type != "cache" and memory_type != "spad"):
+      fatal("Aladdin configuration file specified invalid memory type %s for "
+            "accelerator %s." % (memory_type, accel))
+    return datapath
+
+def redirect_output(outdir):
+    """Writes stdout and stderr to files in outdir, like run.sh does."""
+    for name, stream in (("stdout", sys.stdout), ("stderr", sys.stderr)):
+        stream.flush()
+        fd = os.open(os.path.join(outdir, name),
+                     os.O_WRONLY | os.O_CREAT | os.O_TRUNC, 0644)
+        os.dup2(fd, stream.fileno())
+        os.close(fd)
+
+def fork_design_points():
+    """Simulates each design point of --accel-sweep in a child process,
+    from the accelerator invocation that the simulator exited at."""
+    outdirs = [ os.path.join(os.path.dirname(os.path.abspath(cfg_file)),
+                             "outputs") for cfg_file in sweep_cfg_files ]
+    print("Forking %d design points at tick %d" %
+          (len(outdirs), m5.curTick()))
+    index, codes = m5.forkEach(outdirs, options.accel_sweep_jobs)
+
+    if index is None:
+        failed = [ cfg_file for cfg_file, code in zip(sweep_cfg_files, codes)
+                   if code != 0 ]
+        for cfg_file in failed:
+            print("Design point %s failed" % cfg_file, file=sys.stderr)
+        print("Simulated %d design points, %d failed" %
+              (len(codes), len(failed)))
+        sys.exit(1 if failed else 0)
+
+    redirect_output(outdirs[index])
+    for code, accel_id in sweep_accel_ids[index]:
+        system.selectAccelerator(code, accel_id)
+    system.startPendingAccelerators()
+
+def create_switch_cpus(system, cpu_class):
+    """Creates the CPUs that take over from the KVM CPUs."""
+    switch_cpus = [ cpu_class(switched_out=True, cpu_id=i)
+                    for i in xrange(np) ]
+    for old_cpu, new_cpu in zip(system.cpu, switch_cpus):
+        new_cpu.system = system
+        new_cpu.workload = old_cpu.workload
+        new_cpu.clk_domain = old_cpu.clk_domain
+        new_cpu.isa = old_cpu.isa
+        if options.maxinsts:
+            new_cpu.max_insts_any_thread = options.maxinsts
+        if options.checker:
+            new_cpu.addCheckerCpu()
+    system.switch_cpus = switch_cpus
+    return [ (system.cpu[i], switch_cpus[i]) for i in xrange(np) ]
+
+def switch_from_kvm():
+    """Switches to the detailed CPUs at the first accelerator invocation,
+    and starts the accelerators it invoked."""
+    print("Switching from KVM at tick %d" % m5.curTick())
+    m5.switchCpus(system, switch_cpu_list)
+    if options.accel_sweep:
+        fork_design_points()
+    else:
+        system.startPendingAccelerators()
 
 def get_processes(options):
     """Interprets provided options and returns a list of processes"""
@@ -169,6 +331,25 @@ if np > 0:
 #print "CPUClass:%s, test_mem_mode:%s, FutureClass:%s" % (CPUClass, test_mem_mode, FutureClass)
 CPUClass.numThreads = numThreads
 
+# With --kvm-fast-forward, the CPUs of --cpu-type only take over at the
+# first accelerator invocation.
+DetailedClass = CPUClass
+if options.kvm_fast_forward:
+    if buildEnv['TARGET_ISA'] != 'x86':
+        fatal("--kvm-fast-forward is only supported with x86")
+    if np == 0:
+        fatal("--kvm-fast-forward needs CPUs that invoke the accelerators")
+    if FutureClass or options.standard_switch or options.repeat_switch:
+        fatal("--kvm-fast-forward can't be combined with other CPU switches")
+    if options.ruby:
+        fatal("--kvm-fast-forward doesn't support Ruby")
+    if options.smt or CpuConfig.is_kvm_cpu(CPUClass):
+        fatal("--kvm-fast-forward needs a single-threaded, simulated "
+              "--cpu-type")
+    CPUClass, test_mem_mode = Simulation.getCPUClass("X86KvmCPU")
+elif options.kvm_perf:
+    fatal("--kvm-perf needs --kvm-fast-forward")
+
 MemClass = Simulation.setMemClass(options)
 
 # Check -- do not allow SMT with multiple CPUs
@@ -180,8 +361,9 @@ system = System(mem_mode = test_mem_mode,
                 cache_line_size = options.cacheline_size)
 
 # The O3 model requires fetch buffer size at most the cache line size.
-if CPUClass.type == 'DerivO3CPU':
-  CPUClass.fetchBufferSize = min(CPUClass.fetchBufferSize, system.cache_line_size)
+if DetailedClass.type == 'DerivO3CPU':
+  DetailedClass.fetchBufferSize = min(DetailedClass.fetchBufferSize,
+                                      system.cache_line_size)
 
 # Create a top-level voltage domain
 system.voltage_domain = VoltageDomain(voltage = options.sys_voltage)
@@ -205,88 +387,67 @@ if np > 0:
   for cpu in system.cpu:
       cpu.clk_domain = system.cpu_clk_domain
 
+if options.kvm_fast_forward:
+  system.kvm_vm = KvmVM()
+  for process in multiprocesses:
+      process.useArchPT = True
+      process.kvmInSE = True
+  for cpu in system.cpu:
+      cpu.usePerf = bool(options.kvm_perf)
+
+if options.accel_cfg_file and options.accel_sweep:
+  fatal("Can't specify both --accel_cfg_file and --accel-sweep")
+
+datapaths = []
 if options.accel_cfg_file:
-  # First read all default values.
-  default_cfg = ConfigParser.SafeConfigParser()
-  default_cfg_file = os.path.join(
-      os.path.dirname(os.path.realpath(__file__)), "aladdin_template.cfg")
-  default_cfg.read(default_cfg_file)
-  defaults = dict(i for i in default_cfg.items("DEFAULT"))
-
-  # Now read the actual supplied config file using the defaults.
-  config = ConfigParser.SafeConfigParser(defaults)
-  config.read(options.accel_cfg_file)
-  accels = config.sections()
-  if not accels:
-    fatal("No accelerators were specified!")
-  datapaths = []
-  for accel in accels:
-    memory_type = config.get(accel, 'memory_type').lower()
-    # Accelerators need their own clock domain!
-    cycleTime = config.getint(accel, "cycle_time")
-    clock = "%1.3fGHz" % (1/cycleTime)
-    clk_domain = SrcClockDomain(
-        clock = clock, voltage_domain = system.cpu_voltage_domain)
-    # Set the globally required parameters.
-    datapath = HybridDatapath(
-        clk_domain = clk_domain,
-        benchName = accel,
-        # TODO: Ideally bench_name would change to output_prefix but that's a
-        # pretty big breaking change.
-        outputPrefix = config.get(accel, "bench_name"),
-        traceFileName = config.get(accel, "trace_file_name"),
-        configFileName = config.get(accel, "config_file_name"),
-        acceleratorName = "%s_datapath" % accel,
-        acceleratorId = config.getint(accel, "accelerator_id"),
-        cycleTime = cycleTime,
-        useDb = config.getboolean(accel, "use_db"),
-        experimentName = config.get(accel, "experiment_name"),
-        enableStatsDump = options.enable_stats_dump_and_resume,
-        executeStandalone = (np == 0))
-    datapath.cacheLineFlushLatency = config.getint(accel, "cacheline_flush_latency")
-    datapath.cacheLineInvalidateLatency = config.getint(accel, "cacheline_invalidate_latency")
-    datapath.dmaSetupOverhead = config.getint(accel, "dma_setup_overhead")
-    datapath.maxDmaRequests = config.getint(accel, "max_dma_requests")
-    datapath.numDmaChannels = config.getint(accel, "num_dma_channels")
-    datapath.dmaChunkSize = config.getint(accel, "dma_chunk_size")
-    datapath.pipelinedDma = config.getboolean(accel, "pipelined_dma")
-    datapath.ignoreCacheFlush = config.getboolean(accel, "ignore_cache_flush")
-    datapath.invalidateOnDmaStore = config.getboolean(accel, "invalidate_on_dma_store")
-    datapath.recordMemoryTrace = config.getboolean(accel, "record_memory_trace")
-    datapath.enableAcp = config.getboolean(accel, "enable_acp")
-    datapath.useAcpCache = True
-    datapath.acpCacheSize = config.get(accel, "acp_cache_size")
-    datapath.acpCacheLatency = config.getint(accel, "acp_cache_latency")
-    datapath.acpCacheMSHRs = config.getint(accel, "acp_cache_mshrs")
-    datapath.useAladdinDebugger = options.aladdin_debugger
-    if memory_type == "cache":
-      datapath.cacheSize = config.get(accel, "cache_size")
-      datapath.cacheBandwidth = config.get(accel, "cache_bandwidth")
-      datapath.cacheQueueSize = config.get(accel, "cache_queue_size")
-      datapath.cacheAssoc = config.getint(accel, "cache_assoc")
-      datapath.cacheHitLatency = config.getint(accel, "cache_hit_latency")
-      datapath.cacheLineSize = options.cacheline_size
-      datapath.cactiCacheConfig = config.get(accel, "cacti_cache_config")
-      datapath.tlbEntries = config.getint(accel, "tlb_entries")
-      datapath.tlbAssoc = config.getint(accel, "tlb_assoc")
-      datapath.tlbHitLatency = config.getint(accel, "tlb_hit_latency")
-      datapath.tlbMissLatency = config.getint(accel, "tlb_miss_latency")
-      datapath.tlbCactiConfig = config.get(accel, "cacti_tlb_config")
-      datapath.tlbPageBytes = config.getint(accel, "tlb_page_size")
-      datapath.numOutStandingWalks = config.getint(
-          accel, "tlb_max_outstanding_walks")
-      datapath.tlbBandwidth = config.getint(accel, "tlb_bandwidth")
-    elif memory_type == "spad" and options.ruby:
-      # If the memory_type is spad, Aladdin will initialize a 2-way cache for
-      # every datapath, although this cache will not be used in simulation.
-      # Ruby doesn't support direct-mapped caches, so set the assoc to 2.
-      datapath.cacheAssoc = 2
-    if (memory_type != "cache" and memory_type != "spad"):
-      fatal("Aladdin configuration file specified invalid memory type %s for "
-            "accelerator %s." % (memory_type, accel))
-    datapaths.append(datapath)
-  for datapath in datapaths:
-    setattr(system, datapath.acceleratorName, datapath)
+  config = read_accel_config(options.accel_cfg_file)
+  for accel in config.sections():
+    datapaths.append(create_datapath(
+        config, accel, "%s_datapath" % accel,
+        config.getint(accel, "accelerator_id")))
+elif options.accel_sweep:
+  if np == 0:
+    fatal("--accel-sweep needs CPUs that invoke the accelerators")
+  with open(options.accel_sweep, "r") as f:
+    sweep_cfg_files = [ line.strip() for line in f
+                        if line.strip() and not line.startswith("#") ]
+  if not sweep_cfg_files:
+    fatal("No design points were specified in %s!" % options.accel_sweep)
+
+  # Every design point gets its own datapaths, which stand in for the
+  # request codes of its accelerators, and only the ones of the design
+  # point that a forked child simulates are invoked.
+  sweep_accel_ids = []
+  for i, cfg_file in enumerate(sweep_cfg_files):
+    config = read_accel_config(cfg_file)
+    accel_ids = []
+    for accel in config.sections():
+      code = config.getint(accel, "accelerator_id")
+      if not 0 <= code < ACCEL_SWEEP_ID_STRIDE:
+        fatal("Accelerator id %#x of %s is out of range for --accel-sweep" %
+              (code, cfg_file))
+      accel_id = code + (i + 1) * ACCEL_SWEEP_ID_STRIDE
+      datapaths.append(create_datapath(
+          config, accel, "%s_datapath%d" % (accel, i), accel_id))
+      accel_ids.append((code, accel_id))
+    sweep_accel_ids.append(accel_ids)
+
+  system.accel_alias_codes = [ code for ids in sweep_accel_ids
+                               for code, _ in ids ]
+  system.accel_alias_ids = [ accel_id for ids in sweep_accel_ids
+                             for _, accel_id in ids ]
+  system.exit_on_accel_invocation = True
+  Simulation.exit_handlers["accelerator invocation"] = fork_design_points
+  # The simulator can't be forked with open listeners
+  m5.disableAllListeners()
+
+if options.kvm_fast_forward:
+  # Switching forks the design points of --accel-sweep, if any.
+  system.exit_on_accel_invocation = True
+  Simulation.exit_handlers["accelerator invocation"] = switch_from_kvm
+
+for datapath in datapaths:
+  setattr(system, datapath.acceleratorName, datapath)
 
 if options.simpoint_profile:
     if not CpuConfig.is_atomic_cpu(TestCPUClass):
@@ -304,7 +465,7 @@ for i in xrange(np):
         system.cpu[i].simpoint_profile = True
         system.cpu[i].simpoint_interval = options.simpoint_interval
 
-    if options.checker:
+    if options.checker and not options.kvm_fast_forward:
         system.cpu[i].addCheckerCpu()
 
     system.cpu[i].createThreads()
@@ -338,7 +499,7 @@ if options.ruby:
             system.cpu[i].itb.walker.port = ruby_port.slave
             system.cpu[i].dtb.walker.port = ruby_port.slave
 
-    if options.accel_cfg_file:
+    if datapaths:
         for i,datapath in enumerate(datapaths):
             datapath.cache_port = system.ruby._cpu_ports[options.num_cpus+3*i].slave
             datapath.spad_port = system.ruby._cpu_ports[options.num_cpus+3*i+1].slave
@@ -351,5 +512,8 @@ else:
     CacheConfig.config_cache(options, system)
     MemConfig.config_mem(options, system)
 
+if options.kvm_fast_forward:
+    switch_cpu_list = create_switch_cpus(system, DetailedClass)
+
 root = Root(full_system = False, system = system)
 Simulation.run(options, root, system, FutureClass)
@@ -195,9 +195,10 @@ def config_cache(options, system):
         else:
             system.cpu[i].connectAllPorts(system.membus)
 
-    if options.accel_cfg_file:
-      datapaths = system.find_all(HybridDatapath)[0]
-      for datapath in datapaths:
+    # Datapaths come from --accel_cfg_file, or one set for each design point
+    # of --accel-sweep.
+    datapaths = system.find_all(HybridDatapath)[0]
+    for datapath in datapaths:
         # For now, we will connect all datapaths to a cache regardless of
         # whether they are needed or not.
         datapath.cache = dcache_class(
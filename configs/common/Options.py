@@ -258,6 +258,10 @@ def addCommonOptions(parser):
                       help="Enable basic block profiling for SimPoints")
     parser.add_option("--simpoint-interval", type="int", default=10000000,
                       help="SimPoint interval in num of instructions")
+    parser.add_option("--simpoint-clusters", type="int", default=0,
+                      help="""With --simpoint-profile, cluster BBVs online into
+                              at most N phases and checkpoint a representative
+                              interval of each in the same run""")
     parser.add_option("--take-simpoint-checkpoints", action="store", type="string",
         help="<simpoint file,weight file,interval-length,warmup-length>")
     parser.add_option("--restore-simpoint-checkpoint", action="store_true",
@@ -297,6 +301,25 @@ def addCommonOptions(parser):
     parser.add_option("-s", "--standard-switch", action="store", type="int",
         default=None,
         help="switch from timing to Detailed CPU after warmup period of <N>")
+
+    # Statistical sampling - functional warming on an atomic CPU,
+    # interleaved with short detailed measurement windows on --cpu-type
+    parser.add_option("--sampling", action="store_true", default=False,
+        help="estimate CPI by SMARTS-style sampling")
+    parser.add_option("--sampling-warming", action="store", type="int",
+        default=1000000,
+        help="functional warming instructions between windows")
+    parser.add_option("--sampling-warmup", action="store", type="int",
+        default=2000,
+        help="detailed warm-up instructions before each window")
+    parser.add_option("--sampling-window", action="store", type="int",
+        default=1000, help="instructions per measurement window")
+    parser.add_option("--sampling-max", action="store", type="int",
+        default=10000, help="maximum number of measurement windows")
+    parser.add_option("--sampling-error", action="store", type="float",
+        default=0.03,
+        help="stop when the 99.7% confidence interval of the CPI is "
+             "within this fraction of the mean (0 to disable)")
     parser.add_option("-p", "--prog-interval", type="str",
         help="CPU Progress Interval")
 
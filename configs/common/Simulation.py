@@ -42,7 +42,7 @@
 from __future__ import print_function
 
 import sys
-from os import getcwd
+from os import getcwd, rename
 from os.path import join as joinpath
 
 from common import CpuConfig
@@ -81,7 +81,7 @@ def setCPUClass(options):
         if options.restore_with_cpu != options.cpu_type:
             CPUClass = TmpClass
             TmpClass, test_mem_mode = getCPUClass(options.restore_with_cpu)
-    elif options.fast_forward:
+    elif options.fast_forward or options.sampling:
         if options.ruby:
             CPUClass = TmpClass
             TmpClass = TimingSimpleCPU
@@ -270,8 +270,19 @@ def scriptCheckpoints(options, maxtick, cptdir):
 
     return exit_event
 
-def dumpStatsInterval(options, maxtick):
+# Functions that handle exits from the simulation loop, by their cause,
+# after which the simulation continues, e.g. to fork the simulator
+exit_handlers = {}
+
+def simulateUntil(maxtick):
     exit_event = m5.simulate(maxtick - m5.curTick())
+    while exit_event.getCause() in exit_handlers:
+        exit_handlers[exit_event.getCause()]()
+        exit_event = m5.simulate(maxtick - m5.curTick())
+    return exit_event
+
+def dumpStatsInterval(options, maxtick):
+    exit_event = simulateUntil(maxtick)
     exit_cause = exit_event.getCause()
     exit_dump_stats = exit_cause.startswith("statistics_dump:")
     exit_reset_stats = exit_cause.startswith("statistics_reset:")
@@ -281,7 +292,7 @@ def dumpStatsInterval(options, maxtick):
           stats_desc = exit_cause[len("statistics_dump:"):]
           m5.stats.dump(stats_desc)
         m5.stats.reset()
-        exit_event = m5.simulate(maxtick - m5.curTick())
+        exit_event = simulateUntil(maxtick)
         exit_cause = exit_event.getCause()
         exit_dump_stats = exit_cause.startswith("statistics_dump:")
         exit_reset_stats = exit_cause.startswith("statistics_reset:")
@@ -289,7 +300,7 @@ def dumpStatsInterval(options, maxtick):
     return exit_event
 
 def benchCheckpoints(options, maxtick, cptdir):
-    exit_event = m5.simulate(maxtick - m5.curTick())
+    exit_event = simulateUntil(maxtick)
     exit_cause = exit_event.getCause()
 
     num_checkpoints = 0
@@ -302,7 +313,7 @@ def benchCheckpoints(options, maxtick, cptdir):
             exit_cause = "maximum %d checkpoints dropped" % max_checkpoints
             break
 
-        exit_event = m5.simulate(maxtick - m5.curTick())
+        exit_event = simulateUntil(maxtick)
         exit_cause = exit_event.getCause()
 
     return exit_event
@@ -413,6 +424,57 @@ def takeSimpointCheckpoints(simpoints, interval_length, cptdir):
     print("%d checkpoints taken" % num_checkpoints)
     sys.exit(code)
 
+def takeOnlineSimpointCheckpoints(testsys, interval_length, cptdir):
+    """Checkpoint the candidate representatives proposed by a SimPoint
+    probe that clusters online, then keep the ones that ended up
+    representing a cluster under the names used by
+    --take-simpoint-checkpoints."""
+    import re
+    import shutil
+
+    probe = testsys.cpu[0].probeListener
+    candidates = {}
+    while True:
+        exit_event = m5.simulate()
+        exit_cause = exit_event.getCause()
+        if exit_cause == "checkpoint":
+            print("Found 'checkpoint' exit event...ignoring...")
+            continue
+        if exit_cause != "simpoint checkpoint":
+            break
+
+        interval = probe.checkpointInterval()
+        start_inst = probe.checkpointInst()
+        name = "cpt.online_simpoint_%d" % interval
+        m5.checkpoint(joinpath(cptdir, name))
+        candidates[interval] = (name, start_inst)
+
+    probe.writeClusters()
+
+    outdir = m5.options.outdir
+    weights = {}
+    for line in open(joinpath(outdir, probe.weights_file)):
+        weight, cluster = line.split()
+        weights[int(cluster)] = float(weight)
+
+    num_checkpoints = 0
+    for line in open(joinpath(outdir, probe.simpoints_file)):
+        interval, cluster = [int(x) for x in line.split()]
+        name, start_inst = candidates.pop(interval)
+        rename(joinpath(cptdir, name), joinpath(cptdir,
+            "cpt.simpoint_%02d_inst_%d_weight_%f_interval_%d_warmup_%d"
+            % (num_checkpoints, start_inst, weights[cluster],
+               interval_length, 0)))
+        num_checkpoints += 1
+
+    # Candidates that turned out to be in an already represented cluster
+    for name, start_inst in candidates.values():
+        shutil.rmtree(joinpath(cptdir, name))
+
+    print('Exiting @ tick %i because %s' % (m5.curTick(), exit_cause))
+    print("%d checkpoints taken" % num_checkpoints)
+    sys.exit(exit_event.getCode())
+
 def restoreSimpointCheckpoint():
     exit_event = m5.simulate()
     exit_cause = exit_event.getCause()
@@ -452,6 +514,48 @@ def repeatSwitch(testsys, repeat_switch_cpu_list, maxtick, switch_freq):
             exit_event = m5.simulate(maxtick - m5.curTick())
             return exit_event
 
+def sampleLoop(testsys, sampler, switch_cpu_list, maxtick):
+    """Alternate functional warming on the fast CPUs with detailed
+    measurement windows until the sampler's confidence target is met
+    or the workload exits. The schedule follows the instruction count
+    of the first CPU."""
+    print("starting sampling loop")
+    warm_list = switch_cpu_list
+    detail_list = [(new_cpu, old_cpu) for old_cpu, new_cpu in warm_list]
+    warm_cpu = warm_list[0][0]
+    detail_cpu = warm_list[0][1]
+
+    while True:
+        warm_cpu.scheduleInstStop(0, sampler.warming_insts,
+                                  "sampling warming done")
+        exit_event = m5.simulate(maxtick - m5.curTick())
+        if exit_event.getCause() != "sampling warming done":
+            return exit_event
+
+        m5.switchCpus(testsys, warm_list)
+
+        detail_cpu.scheduleInstStop(0, sampler.warmup_insts,
+                                    "sampling warmup done")
+        exit_event = m5.simulate(maxtick - m5.curTick())
+        if exit_event.getCause() != "sampling warmup done":
+            return exit_event
+
+        sampler.beginWindow()
+        detail_cpu.scheduleInstStop(0, sampler.window_insts,
+                                    "sampling window done")
+        exit_event = m5.simulate(maxtick - m5.curTick())
+        sampler.endWindow()
+        if exit_event.getCause() != "sampling window done":
+            return exit_event
+
+        if sampler.done():
+            print("Sampled CPI %f +/- %f after %d windows" %
+                  (sampler.cpiMean(), sampler.cpiHalfWidth(),
+                   sampler.samples()))
+            return exit_event
+
+        m5.switchCpus(testsys, detail_list)
+
 def run(options, root, testsys, cpu_class):
     if options.checkpoint_dir:
         cptdir = options.checkpoint_dir
@@ -472,6 +576,13 @@ def run(options, root, testsys, cpu_class):
     if options.repeat_switch and options.take_checkpoints:
         fatal("Can't specify both --repeat-switch and --take-checkpoints")
 
+    if options.sampling and (options.standard_switch or options.repeat_switch
+                             or options.take_checkpoints != None):
+        fatal("Can't combine --sampling with CPU switching or checkpoints")
+
+    if options.sampling and not cpu_class:
+        fatal("--sampling needs a detailed --cpu-type to switch to")
+
     np = options.num_cpus
     switch_cpus = None
 
@@ -502,7 +613,18 @@ def run(options, root, testsys, cpu_class):
             # Add checker cpu if selected
             if options.checker:
                 switch_cpus[i].addCheckerCpu()
-            if options.bp_type:
+            if options.sampling:
+                # Let the fast CPU train the detailed CPU's branch
+                # predictor while warming. The predictor is a child of the
+                # fast CPU and only a parameter of the detailed one, so
+                # that it's instantiated once.
+                if options.bp_type:
+                    bp = BPConfig.get(options.bp_type)()
+                else:
+                    bp = switch_cpus[i].branchPred
+                testsys.cpu[i].branchPred = bp
+                switch_cpus[i].branchPred = bp
+            elif options.bp_type:
                 bpClass = BPConfig.get(options.bp_type)
                 switch_cpus[i].branchPred = bpClass()
 
@@ -514,6 +636,16 @@ def run(options, root, testsys, cpu_class):
         testsys.switch_cpus = switch_cpus
         switch_cpu_list = [(testsys.cpu[i], switch_cpus[i]) for i in xrange(np)]
 
+        if options.sampling:
+            # Caches are warmed because both CPUs use the same ports
+            testsys.sampler = SamplingController(
+                cpus=switch_cpus,
+                warming_insts=options.sampling_warming,
+                warmup_insts=options.sampling_warmup,
+                window_insts=options.sampling_window,
+                max_samples=options.sampling_max,
+                target_error=options.sampling_error)
+
     if options.repeat_switch:
         switch_class = getCPUClass(options.cpu_type)[0]
         if switch_class.require_caches() and \
@@ -669,7 +801,12 @@ def run(options, root, testsys, cpu_class):
         fatal("Bad maxtick (%d) specified: " \
               "Checkpoint starts starts from tick: %d", maxtick, cpt_starttick)
 
-    if options.standard_switch or cpu_class:
+    if options.sampling:
+        if options.fast_forward:
+            print("Sampling starts at instruction count:%s" %
+                    str(testsys.cpu[0].max_insts_any_thread))
+            exit_event = m5.simulate()
+    elif options.standard_switch or cpu_class:
         if options.standard_switch:
             print("Switch at instruction count:%s" %
                     str(testsys.cpu[0].max_insts_any_thread))
@@ -722,6 +859,11 @@ def run(options, root, testsys, cpu_class):
     elif options.take_simpoint_checkpoints != None:
         takeSimpointCheckpoints(simpoints, interval_length, cptdir)
 
+    # Take SimPoint checkpoints while clustering online
+    elif options.simpoint_profile and options.simpoint_clusters:
+        takeOnlineSimpointCheckpoints(testsys, options.simpoint_interval,
+                                      cptdir)
+
     # Restore from SimPoint checkpoints
     elif options.restore_simpoint_checkpoint != None:
         restoreSimpointCheckpoint()
@@ -733,7 +875,10 @@ def run(options, root, testsys, cpu_class):
 
         # If checkpoints are being taken, then the checkpoint instruction
         # will occur in the benchmark code it self.
-        if options.repeat_switch and maxtick > options.repeat_switch:
+        if options.sampling:
+            exit_event = sampleLoop(testsys, testsys.sampler,
+                                    switch_cpu_list, maxtick)
+        elif options.repeat_switch and maxtick > options.repeat_switch:
             exit_event = repeatSwitch(testsys, repeat_switch_cpu_list,
                                       maxtick, options.repeat_switch)
         elif options.enable_stats_dump_and_resume:
@@ -229,7 +229,8 @@ for i in xrange(np):
         system.cpu[i].workload = multiprocesses[i]
 
     if options.simpoint_profile:
-        system.cpu[i].addSimPointProbe(options.simpoint_interval)
+        system.cpu[i].addSimPointProbe(options.simpoint_interval,
+                                       options.simpoint_clusters)
 
     if options.checker:
         system.cpu[i].addCheckerCpu()
@@ -145,6 +145,7 @@ def create_system(options, full_system, system, dma_ports, bootmem,
 
         l2_cntrl = L2Cache_Controller(version = i,
                                       L2cache = l2_cache,
+                                      l2_select_num_bits = l2_bits,
                                       transitions_per_cycle = options.ports,
                                       ruby_system = ruby_system)
 
@@ -180,6 +181,8 @@ def create_system(options, full_system, system, dma_ports, bootmem,
     if rom_dir_cntrl_node is not None:
         dir_cntrl_nodes.append(rom_dir_cntrl_node)
     for dir_cntrl in dir_cntrl_nodes:
+        dir_cntrl.l2_select_num_bits = l2_bits
+
         # Connect the directory controllers and the network
         dir_cntrl.requestToDir = MessageBuffer()
         dir_cntrl.requestToDir.slave = ruby_system.network.master
@@ -80,6 +80,11 @@ def define_options(parser):
     parser.add_option("--recycle-latency", type="int", default=10,
                       help="Recycle latency for ruby controller input buffers")
 
+    parser.add_option("--ruby-functional-warmup", action="store_true",
+                      default=False,
+                      help="Install the cache contents of checkpoints "
+                           "directly, if the protocol supports it")
+
     protocol = buildEnv['PROTOCOL']
     exec "import %s" % protocol
     eval("%s.define_options(parser)" % protocol)
@@ -205,6 +210,7 @@ def create_system(options, full_system, system, piobus = None, dma_ports = [],
     ruby.number_of_virtual_networks = ruby.network.number_of_virtual_networks
     ruby._cpu_ports = cpu_sequencers
     ruby.num_of_sequencers = len(cpu_sequencers)
+    ruby.functional_warmup = options.ruby_functional_warmup
 
     # Create a backing copy of physical memory in case required
     if options.access_backing_store:
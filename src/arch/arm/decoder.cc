@@ -54,7 +54,8 @@ namespace ArmISA
 GenericISA::BasicDecodeCache Decoder::defaultCache;
 
 Decoder::Decoder(ISA* isa)
-    : data(0), fpscrLen(0), fpscrStride(0), decoderFlavour(isa
+    : data(0), fpscrLen(0), fpscrStride(0), _contextVersion(0),
+      decoderFlavour(isa
             ? isa->decoderFlavour()
             : Enums::Generic)
 {
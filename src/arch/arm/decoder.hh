@@ -71,6 +71,8 @@ class Decoder
 
     int fpscrLen;
     int fpscrStride;
+    /// Counts the changes of the vector length and stride.
+    uint64_t _contextVersion;
 
     Enums::DecoderFlavour decoderFlavour;
 
@@ -194,9 +196,17 @@ class Decoder
   public: // ARM-specific decoder state manipulation
     void setContext(FPSCR fpscr)
     {
+        if (fpscrLen != fpscr.len || fpscrStride != fpscr.stride)
+            ++_contextVersion;
         fpscrLen = fpscr.len;
         fpscrStride = fpscr.stride;
     }
+
+    /**
+     * Changes whenever the same instruction bytes at the same PC state may
+     * decode differently.
+     */
+    uint64_t contextVersion() const { return _contextVersion; }
 };
 
 } // namespace ArmISA
@@ -93,6 +93,10 @@ class Decoder
 
     void takeOverFrom(Decoder *old) {}
 
+    /// Decoding only depends on the instruction bytes and the PC state,
+    /// so the decoding context never changes.
+    uint64_t contextVersion() const { return 0; }
+
   protected:
     /// A cache of decoded instruction objects.
     static GenericISA::BasicDecodeCache defaultCache;
@@ -74,6 +74,10 @@ class Decoder
     bool instReady() { return instDone; }
     void takeOverFrom(Decoder *old) {}
 
+    /// Decoding only depends on the instruction bytes and the PC state,
+    /// so the decoding context never changes.
+    uint64_t contextVersion() const { return 0; }
+
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
 
     /// Decode a machine instruction.
@@ -47,9 +47,11 @@ class Decoder
     ExtMachInst emi;
     bool instDone;
     RegVal asi;
+    /// Counts the changes of the asi.
+    uint64_t _contextVersion;
 
   public:
-    Decoder(ISA* isa = nullptr) : instDone(false), asi(0)
+    Decoder(ISA* isa = nullptr) : instDone(false), asi(0), _contextVersion(0)
     {}
 
     void process() {}
@@ -95,9 +97,14 @@ class Decoder
     void
     setContext(RegVal _asi)
     {
+        if (asi != _asi)
+            ++_contextVersion;
         asi = _asi;
     }
 
+    /// Changes whenever the same instruction bytes may decode differently.
+    uint64_t contextVersion() const { return _contextVersion; }
+
     void takeOverFrom(Decoder *old) {}
 
   protected:
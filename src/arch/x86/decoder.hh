@@ -102,6 +102,8 @@ class Decoder
     uint8_t altAddr;
     uint8_t defAddr;
     uint8_t stack;
+    //Counts the changes of the mode and the sizes above
+    uint64_t _contextVersion;
 
     uint8_t getNextByte()
     {
@@ -236,7 +238,7 @@ class Decoder
 
   public:
     Decoder(ISA* isa = nullptr) : basePC(0), origPC(0), offset(0),
-        outOfBytes(true), instDone(false),
+        _contextVersion(0), outOfBytes(true), instDone(false),
         state(ResetState)
     {
         emi.reset();
@@ -256,6 +258,14 @@ class Decoder
 
     void setM5Reg(HandyM5Reg m5Reg)
     {
+        if (mode != (X86Mode)(uint64_t)m5Reg.mode ||
+                submode != (X86SubMode)(uint64_t)m5Reg.submode ||
+                altOp != m5Reg.altOp || defOp != m5Reg.defOp ||
+                altAddr != m5Reg.altAddr || defAddr != m5Reg.defAddr ||
+                stack != m5Reg.stack) {
+            ++_contextVersion;
+        }
+
         mode = (X86Mode)(uint64_t)m5Reg.mode;
         submode = (X86SubMode)(uint64_t)m5Reg.submode;
         emi.mode.mode = mode;
@@ -283,6 +293,9 @@ class Decoder
         }
     }
 
+    /// Changes whenever the same instruction bytes may decode differently.
+    uint64_t contextVersion() const { return _contextVersion; }
+
     void takeOverFrom(Decoder *old)
     {
         mode = old->mode;
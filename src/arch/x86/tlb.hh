@@ -154,6 +154,8 @@ namespace X86ISA
         // Checkpointing
         void serialize(CheckpointOut &cp) const override;
         void unserialize(CheckpointIn &cp) override;
+        // Only restores its own entries
+        bool parallelLoadState() const override { return true; }
 
         /**
          * Get the table walker master port. This is used for
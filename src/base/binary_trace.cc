@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Binary debug trace backend.
+ */
+
+#include "base/binary_trace.hh"
+
+#include <algorithm>
+#include <atomic>
+
+namespace Trace {
+
+namespace {
+
+const char magic[] = "gem5btr";
+const uint8_t version = 1;
+
+std::atomic<uint64_t> nextGeneration(1);
+
+} // anonymous namespace
+
+const size_t BinaryLogger::blockSize;
+const size_t BinaryLogger::maxCachedIds;
+
+BinaryLogger::BinaryLogger(std::ostream &stream, size_t flight_bytes)
+    : stream(stream), flightBytes(flight_bytes),
+      generation(nextGeneration++), stringsWritten(0), retainedBytes(0),
+      textBuf(*this), textStream(&textBuf)
+{
+    rawArgs = true;
+
+    stream.write(magic, sizeof(magic) - 1);
+    stream.put(version);
+}
+
+BinaryLogger::~BinaryLogger()
+{
+    flush();
+}
+
+BinaryLogger::Channel &
+BinaryLogger::channel()
+{
+    // Almost all records come from one thread, so remember the last
+    // lookup instead of hashing the thread ID every time
+    static thread_local uint64_t cached_generation = 0;
+    static thread_local Channel *cached = nullptr;
+    if (cached_generation == generation)
+        return *cached;
+
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto &chan = channels[std::this_thread::get_id()];
+    if (!chan) {
+        chan.reset(new Channel);
+        chan->index = channels.size() - 1;
+    }
+    cached_generation = generation;
+    cached = chan.get();
+    return *chan;
+}
+
+std::unique_ptr<BinaryLogger::Block>
+BinaryLogger::newBlock(size_t size, uint32_t thread)
+{
+    std::unique_ptr<Block> block;
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        if (!spare.empty() && spare.back()->data.size() >= size) {
+            block = std::move(spare.back());
+            spare.pop_back();
+        }
+    }
+    if (!block) {
+        block.reset(new Block);
+        block->data.resize(std::max(size, blockSize));
+    }
+    block->used = 0;
+    block->thread = thread;
+    return block;
+}
+
+char *
+BinaryLogger::reserve(size_t size)
+{
+    Channel &chan = channel();
+    Block *block = chan.current.get();
+    if (!block || block->used + size > block->data.size()) {
+        if (block)
+            retire(std::move(chan.current));
+        chan.current = newBlock(size, chan.index);
+        block = chan.current.get();
+    }
+
+    char *p = &block->data[block->used];
+    block->used += size;
+    return p;
+}
+
+void
+BinaryLogger::retire(std::unique_ptr<Block> block)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    if (!flightBytes) {
+        writeStrings();
+        writeBlock(*block);
+        spare.push_back(std::move(block));
+        return;
+    }
+
+    retainedBytes += block->used;
+    retained.push_back(std::move(block));
+    while (retainedBytes > flightBytes && retained.size() > 1) {
+        retainedBytes -= retained.front()->used;
+        spare.push_back(std::move(retained.front()));
+        retained.pop_front();
+    }
+}
+
+void
+BinaryLogger::writeStrings()
+{
+    for (; stringsWritten < strings.size(); ++stringsWritten) {
+        const std::string &str = strings[stringsWritten];
+        const uint32_t id = stringsWritten;
+        const uint32_t len = str.size();
+        stream.put('S');
+        stream.write(reinterpret_cast<const char *>(&id), sizeof(id));
+        stream.write(reinterpret_cast<const char *>(&len), sizeof(len));
+        stream.write(str.data(), len);
+    }
+}
+
+void
+BinaryLogger::writeBlock(const Block &block)
+{
+    const uint32_t len = block.used;
+    stream.put('B');
+    stream.write(reinterpret_cast<const char *>(&block.thread),
+                 sizeof(block.thread));
+    stream.write(reinterpret_cast<const char *>(&len), sizeof(len));
+    stream.write(block.data.data(), len);
+}
+
+void
+BinaryLogger::flush()
+{
+    textStream.flush();
+
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    for (auto &chan : channels) {
+        if (chan.second->current && chan.second->current->used)
+            retire(std::move(chan.second->current));
+    }
+
+    writeStrings();
+    for (auto &block : retained) {
+        writeBlock(*block);
+        spare.push_back(std::move(block));
+    }
+    retained.clear();
+    retainedBytes = 0;
+
+    stream.flush();
+}
+
+uint32_t
+BinaryLogger::internString(const std::string &str)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    auto it = stringIds.find(str);
+    if (it != stringIds.end())
+        return it->second;
+
+    const uint32_t id = strings.size();
+    strings.push_back(str);
+    stringIds.emplace(str, id);
+    return id;
+}
+
+BinaryLogger::IdCache &
+BinaryLogger::idCache()
+{
+    static thread_local IdCache cache;
+    if (cache.generation != generation) {
+        cache.literals.clear();
+        cache.names.clear();
+        cache.generation = generation;
+    }
+    return cache;
+}
+
+uint32_t
+BinaryLogger::cachedId(IdMap &cache, const char *str, size_t len)
+{
+    auto it = cache.find(str);
+    if (it != cache.end() && it->second.first.size() == len &&
+        std::memcmp(it->second.first.data(), str, len) == 0) {
+        return it->second.second;
+    }
+
+    // Strings built on the fly rarely have the same address twice, so
+    // don't let them pile up
+    if (cache.size() >= maxCachedIds)
+        cache.clear();
+
+    std::string copy(str, len);
+    const uint32_t id = internString(copy);
+    cache[str] = std::make_pair(std::move(copy), id);
+    return id;
+}
+
+uint32_t
+BinaryLogger::literalId(const char *str)
+{
+    return cachedId(idCache().literals, str, std::strlen(str));
+}
+
+uint32_t
+BinaryLogger::nameId(const std::string &name)
+{
+    return cachedId(idCache().names, name.data(), name.size());
+}
+
+void
+BinaryLogger::logMessage(Tick when, const std::string &name,
+                         const std::string &message)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    const uint32_t name_id = nameId(name);
+    const uint32_t len = message.size();
+
+    char *p = reserve(1 + 8 + 4 + 4 + len);
+    p = put(p, 'T');
+    p = put(p, static_cast<uint64_t>(when));
+    p = put(p, name_id);
+    p = put(p, len);
+    std::memcpy(p, message.data(), len);
+}
+
+void
+BinaryLogger::logRaw(Tick when, const std::string &name, const char *fmt,
+                     unsigned nargs, const std::string &args)
+{
+    const uint32_t name_id = nameId(name);
+    const uint32_t fmt_id = literalId(fmt);
+    const uint32_t len = args.size();
+
+    char *p = reserve(1 + 8 + 4 + 4 + 1 + 4 + len);
+    p = put(p, 'M');
+    p = put(p, static_cast<uint64_t>(when));
+    p = put(p, name_id);
+    p = put(p, fmt_id);
+    p = put(p, static_cast<uint8_t>(nargs));
+    p = put(p, len);
+    std::memcpy(p, args.data(), len);
+}
+
+void
+BinaryLogger::dump(Tick when, const std::string &name, const void *d, int len)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    const uint32_t name_id = nameId(name);
+    const uint32_t size = len;
+
+    char *p = reserve(1 + 8 + 4 + 4 + size);
+    p = put(p, 'X');
+    p = put(p, static_cast<uint64_t>(when));
+    p = put(p, name_id);
+    p = put(p, size);
+    std::memcpy(p, d, size);
+}
+
+void
+BinaryLogger::logInst(Tick when, const std::string &cpu, unsigned tid,
+                      Addr pc, int upc, uint32_t disassembly,
+                      uint32_t op_class, uint8_t flags, uint64_t data,
+                      Addr addr)
+{
+    const uint32_t cpu_id = nameId(cpu);
+
+    char *p = reserve(1 + 8 + 4 + 1 + 8 + 2 + 4 + 4 + 1 + 8 + 8);
+    p = put(p, 'I');
+    p = put(p, static_cast<uint64_t>(when));
+    p = put(p, cpu_id);
+    p = put(p, static_cast<uint8_t>(tid));
+    p = put(p, static_cast<uint64_t>(pc));
+    p = put(p, static_cast<uint16_t>(upc < 0 ? 0xffff : upc));
+    p = put(p, disassembly);
+    p = put(p, op_class);
+    p = put(p, flags);
+    p = put(p, data);
+    put(p, static_cast<uint64_t>(addr));
+}
+
+int
+BinaryLogger::TextBuf::sync()
+{
+    std::string text = str();
+    size_t start = 0;
+    size_t end;
+    while ((end = text.find('\n', start)) != std::string::npos) {
+        logger.logMessage(MaxTick, std::string(),
+                          text.substr(start, end + 1 - start));
+        start = end + 1;
+    }
+    str(text.substr(start));
+    return 0;
+}
+
+} // namespace Trace
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Binary debug trace backend.
+ *
+ * A BinaryLogger replaces the text debug logger when --debug-format=binary
+ * is used. Instead of formatting every DPRINTF, it records the tick, an ID
+ * for the object name, an ID for the format string and the raw arguments
+ * (see base/trace_args.hh). Instruction traces from the ExeTracer are
+ * recorded as fixed-size records that refer to the disassembly of each
+ * static instruction by ID, so an instruction is only disassembled the
+ * first time it is traced. util/decode_binary_trace.py turns the result
+ * back into the usual text output.
+ *
+ * Records are appended to fixed-size blocks owned by the thread that
+ * produced them. In streaming mode, full blocks are written to the output
+ * file. In flight-recorder mode only the most recent blocks, up to a
+ * configured size, are kept in memory and written out by flush(), which
+ * runs when the simulator exits, including on fatal errors and panics.
+ *
+ * File layout: the magic string "gem5btr", a format version byte, then a
+ * sequence of chunks. A chunk is a type byte followed by:
+ *
+ *   'S' string   id (4 bytes), length (4 bytes), characters
+ *   'B' block    thread index (4 bytes), length (4 bytes), records
+ *
+ * A string chunk always precedes the first block that refers to it.
+ * Records within a block start with a type byte:
+ *
+ *   'M' message  tick (8), name (4), format (4), nargs (1),
+ *                argument length (4), arguments
+ *   'T' text     tick (8), name (4), length (4), characters
+ *   'X' hex dump tick (8), name (4), length (4), bytes
+ *   'I' inst     tick (8), cpu name (4), thread (1), pc (8),
+ *                micro pc (2, 0xffff if not a microop), disassembly (4),
+ *                op class (4), flags (1), data (8), address (8)
+ *
+ * All integers are in host byte order.
+ */
+
+#ifndef __BASE_BINARY_TRACE_HH__
+#define __BASE_BINARY_TRACE_HH__
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/trace.hh"
+#include "base/types.hh"
+
+namespace Trace {
+
+class BinaryLogger : public Logger
+{
+  public:
+    /** Flags of an instruction record */
+    enum InstFlags : uint8_t
+    {
+        /** The instruction executed (as opposed to a macroop header) */
+        InstRan = 0x1,
+        /** The instruction's predicate was false */
+        InstPredFalse = 0x2,
+        /** The data field is valid */
+        InstDataValid = 0x4,
+        /** The address field is valid */
+        InstAddrValid = 0x8,
+    };
+
+    /**
+     * @param stream Binary output stream. Ownership is not transferred.
+     * @param flight_bytes If non-zero, keep only roughly this many bytes
+     *                     of the most recent records and write them out
+     *                     on flush() instead of streaming every record.
+     */
+    BinaryLogger(std::ostream &stream, size_t flight_bytes);
+    ~BinaryLogger();
+
+    void logMessage(Tick when, const std::string &name,
+                    const std::string &message) override;
+
+    void logRaw(Tick when, const std::string &name, const char *fmt,
+                unsigned nargs, const std::string &args) override;
+
+    void dump(Tick when, const std::string &name,
+              const void *d, int len) override;
+
+    /** Text written to the ostream is recorded one line at a time */
+    std::ostream &getOstream() override { return textStream; }
+
+    void flush() override;
+
+    BinaryLogger *binaryLogger() override { return this; }
+
+    /** Get the ID of a string, defining it if it has not been seen. */
+    uint32_t internString(const std::string &str);
+
+    /**
+     * Get the ID of a string literal, such as a format string. Literals
+     * are looked up by address in a per-thread cache first.
+     */
+    uint32_t literalId(const char *str);
+
+    /** Record an executed instruction. */
+    void logInst(Tick when, const std::string &cpu, unsigned tid, Addr pc,
+                 int upc, uint32_t disassembly, uint32_t op_class,
+                 uint8_t flags, uint64_t data, Addr addr);
+
+  private:
+    static const size_t blockSize = 64 * 1024;
+
+    /** Entries in a per-thread ID cache before it is emptied */
+    static const size_t maxCachedIds = 4096;
+
+    struct Block
+    {
+        std::vector<char> data;
+        size_t used;
+        uint32_t thread;
+    };
+
+    /** Records produced by one host thread */
+    struct Channel
+    {
+        uint32_t index;
+        std::unique_ptr<Block> current;
+    };
+
+    /** Get the calling thread's channel, creating it if necessary */
+    Channel &channel();
+
+    /** Reserve space for a record of the given size */
+    char *reserve(size_t size);
+
+    /** Get an empty block with room for at least size bytes */
+    std::unique_ptr<Block> newBlock(size_t size, uint32_t thread);
+
+    /** Hand a full block to the writer or the flight recorder */
+    void retire(std::unique_ptr<Block> block);
+
+    /** Write any string definitions that have not been written yet */
+    void writeStrings();
+    void writeBlock(const Block &block);
+
+    template <typename T>
+    static char *
+    put(char *p, const T &val)
+    {
+        std::memcpy(p, &val, sizeof(val));
+        return p + sizeof(val);
+    }
+
+    /**
+     * Get the ID of an object name. Names usually live as long as their
+     * objects, so they are looked up by address in a per-thread cache
+     * first.
+     */
+    uint32_t nameId(const std::string &name);
+
+    typedef std::unordered_map<const char *,
+                               std::pair<std::string, uint32_t>> IdMap;
+
+    /**
+     * IDs looked up by the calling thread, keyed by the address of the
+     * characters. The string is kept to check that an address hasn't been
+     * reused for a different string.
+     */
+    struct IdCache
+    {
+        /** Logger the IDs belong to */
+        uint64_t generation = 0;
+        IdMap literals;
+        IdMap names;
+    };
+
+    /** Get the calling thread's ID cache for this logger */
+    IdCache &idCache();
+
+    /**
+     * Look up a string of the given length in a per-thread cache,
+     * interning it on a miss.
+     */
+    uint32_t cachedId(IdMap &cache, const char *str, size_t len);
+
+    /** Forwards complete lines written to textStream to logMessage() */
+    class TextBuf : public std::stringbuf
+    {
+      public:
+        TextBuf(BinaryLogger &logger) : logger(logger) { }
+      protected:
+        int sync() override;
+      private:
+        BinaryLogger &logger;
+    };
+
+    std::ostream &stream;
+    const size_t flightBytes;
+
+    /** Distinguishes loggers in the per-thread channel and ID caches */
+    const uint64_t generation;
+
+    /** Protects everything below that is shared between threads */
+    std::recursive_mutex mutex;
+
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint32_t> stringIds;
+    size_t stringsWritten;
+
+    std::unordered_map<std::thread::id, std::unique_ptr<Channel>> channels;
+
+    /** Retired blocks kept by the flight recorder */
+    std::deque<std::unique_ptr<Block>> retained;
+    size_t retainedBytes;
+
+    /** Retired blocks kept for reuse */
+    std::vector<std::unique_ptr<Block>> spare;
+
+    TextBuf textBuf;
+    std::ostream textStream;
+};
+
+} // namespace Trace
+
+#endif // __BASE_BINARY_TRACE_HH__
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/binary_trace.hh"
+
+using namespace Trace;
+
+TEST(BinaryLoggerTest, LiteralIds)
+{
+    std::ostringstream out;
+    BinaryLogger logger(out, 0);
+
+    const char *fmt = "%s: %d\n";
+    const uint32_t id = logger.literalId(fmt);
+    EXPECT_EQ(id, logger.literalId(fmt));
+    EXPECT_EQ(id, logger.internString(fmt));
+    EXPECT_NE(id, logger.literalId("other"));
+}
+
+// A cached address that now holds a different string must not return the
+// old string's ID.
+TEST(BinaryLoggerTest, ReusedAddress)
+{
+    std::ostringstream out;
+    BinaryLogger logger(out, 0);
+
+    char buf[] = "first";
+    const uint32_t first = logger.literalId(buf);
+    std::strcpy(buf, "other");
+    const uint32_t other = logger.literalId(buf);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(other, logger.internString("other"));
+    std::strcpy(buf, "first");
+    EXPECT_EQ(first, logger.literalId(buf));
+}
+
+// IDs cached by a thread belong to the logger that handed them out.
+TEST(BinaryLoggerTest, CachePerLogger)
+{
+    std::ostringstream out_a, out_b;
+    BinaryLogger a(out_a, 0);
+    BinaryLogger b(out_b, 0);
+
+    const char *x = "x";
+    const char *y = "y";
+    EXPECT_EQ(0, a.literalId(x));
+    EXPECT_EQ(1, a.literalId(y));
+    EXPECT_EQ(0, b.literalId(y));
+    EXPECT_EQ(1, b.literalId(x));
+    EXPECT_EQ(1, a.literalId(y));
+}
+
+// Every thread sees the same ID for a string, whichever thread defined it.
+TEST(BinaryLoggerTest, Threads)
+{
+    std::ostringstream out;
+    BinaryLogger logger(out, 0);
+
+    std::vector<std::string> strings;
+    for (int i = 0; i < 100; ++i)
+        strings.push_back("string " + std::to_string(i));
+
+    const int num_threads = 4;
+    std::vector<std::vector<uint32_t>> ids(num_threads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int pass = 0; pass < 10; ++pass) {
+                ids[t].clear();
+                for (size_t i = 0; i < strings.size(); ++i) {
+                    const size_t n = (i + t * 25) % strings.size();
+                    ids[t].push_back(logger.literalId(strings[n].c_str()));
+                }
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    for (int t = 0; t < num_threads; ++t) {
+        for (size_t i = 0; i < strings.size(); ++i) {
+            const size_t n = (i + t * 25) % strings.size();
+            EXPECT_EQ(logger.internString(strings[n]), ids[t][i]);
+        }
+    }
+}
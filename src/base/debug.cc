@@ -127,6 +127,16 @@ CompoundFlag::disable()
         k->disable();
 }
 
+bool
+CompoundFlag::compiledIn() const
+{
+    for (auto& k : _kids) {
+        if (k->compiledIn())
+            return true;
+    }
+    return false;
+}
+
 struct AllFlags : public Flag
 {
     AllFlags()
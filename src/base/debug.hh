@@ -57,6 +57,9 @@ class Flag
     virtual void enable() = 0;
     virtual void disable() = 0;
     virtual void sync() {}
+
+    /** False if the flag's trace statements were left out of the build */
+    virtual bool compiledIn() const { return true; }
 };
 
 class SimpleFlag : public Flag
@@ -65,10 +68,11 @@ class SimpleFlag : public Flag
   protected:
     bool _tracing; // tracing is enabled and flag is on
     bool _status;  // flag status
+    const bool _compiled; // flag is used by the build
 
   public:
-    SimpleFlag(const char *name, const char *desc)
-        : Flag(name, desc), _status(false)
+    SimpleFlag(const char *name, const char *desc, bool compiled = true)
+        : Flag(name, desc), _status(false), _compiled(compiled)
     { }
 
     bool status() const { return _tracing; }
@@ -80,10 +84,25 @@ class SimpleFlag : public Flag
 
     void sync() { _tracing = _active && _status; }
 
+    bool compiledIn() const override { return _compiled; }
+
     static void enableAll();
     static void disableAll();
 };
 
+/**
+ * Stand-in for a flag that is not in the DEBUG_FLAGS list of the build.
+ * The generated debug/<flag>.hh header declares a constant of this type
+ * instead of the SimpleFlag, so tests of the flag are constant and the
+ * compiler drops the trace statements that use it, arguments included.
+ */
+struct DisabledFlag
+{
+    constexpr bool status() const { return false; }
+    constexpr operator bool() const { return false; }
+    constexpr bool operator!() const { return true; }
+};
+
 class CompoundFlag : public Flag
 {
   protected:
@@ -120,6 +139,8 @@ class CompoundFlag : public Flag
 
     void enable();
     void disable();
+
+    bool compiledIn() const override;
 };
 
 typedef std::map<std::string, Flag *> FlagsMap;
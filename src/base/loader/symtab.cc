@@ -30,7 +30,9 @@
 
 #include "base/loader/symtab.hh"
 
+#include <algorithm>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -47,8 +49,10 @@ SymbolTable *debugSymbolTable = NULL;
 void
 SymbolTable::clear()
 {
-    addrTable.clear();
-    symbolTable.clear();
+    symbols.clear();
+    byAddr.clear();
+    byName.clear();
+    pendingNames.clear();
 }
 
 bool
@@ -57,16 +61,55 @@ SymbolTable::insert(Addr address, string symbol)
     if (symbol.empty())
         return false;
 
-    if (!symbolTable.insert(make_pair(symbol, address)).second)
+    // Names must be unique, among both sorted and pending symbols.
+    Index::const_iterator i = lowerBound(symbol);
+    if (i != byName.end() && symbols[*i].name == symbol)
         return false;
 
-    // There can be multiple symbols for the same address, so always
-    // update the addrTable multimap when we see a new symbol name.
-    addrTable.insert(make_pair(address, symbol));
+    const size_t hash = std::hash<string>()(symbol);
+    auto pending = pendingNames.equal_range(hash);
+    for (auto p = pending.first; p != pending.second; ++p) {
+        if (symbols[p->second].name == symbol)
+            return false;
+    }
+
+    // There can be multiple symbols for the same address, they are kept
+    // in the order they were inserted.
+    pendingNames.emplace(hash, symbols.size());
+    symbols.push_back(Symbol{address, std::move(symbol)});
 
     return true;
 }
 
+void
+SymbolTable::sortPending() const
+{
+    const size_t sorted = byAddr.size();
+    for (uint32_t i = sorted; i < symbols.size(); ++i) {
+        byAddr.push_back(i);
+        byName.push_back(i);
+    }
+
+    // Sort the new symbols and merge them into the sorted ones. Both are
+    // stable, so symbols at the same address stay in insertion order.
+    auto addr_less = [this](uint32_t a, uint32_t b) {
+        return symbols[a].address < symbols[b].address;
+    };
+    std::stable_sort(byAddr.begin() + sorted, byAddr.end(), addr_less);
+    std::inplace_merge(byAddr.begin(), byAddr.begin() + sorted,
+                       byAddr.end(), addr_less);
+
+    auto name_less = [this](uint32_t a, uint32_t b) {
+        return symbols[a].name < symbols[b].name;
+    };
+    std::sort(byName.begin() + sorted, byName.end(), name_less);
+    std::inplace_merge(byName.begin(), byName.begin() + sorted,
+                       byName.end(), name_less);
+
+    // Free the buckets as well, the table is often not written again
+    std::unordered_multimap<size_t, uint32_t>().swap(pendingNames);
+}
+
 
 bool
 SymbolTable::load(const string &filename)
@@ -112,14 +155,12 @@ SymbolTable::load(const string &filename)
 void
 SymbolTable::serialize(const string &base, CheckpointOut &cp) const
 {
-    paramOut(cp, base + ".size", addrTable.size());
-
-    int i = 0;
-    ATable::const_iterator p, end = addrTable.end();
-    for (p = addrTable.begin(); p != end; ++p) {
-        paramOut(cp, csprintf("%s.addr_%d", base, i), p->first);
-        paramOut(cp, csprintf("%s.symbol_%d", base, i), p->second);
-        ++i;
+    paramOut(cp, base + ".size", symbols.size());
+
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        const Symbol &symbol = symbolByAddr(i);
+        paramOut(cp, csprintf("%s.addr_%d", base, i), symbol.address);
+        paramOut(cp, csprintf("%s.symbol_%d", base, i), symbol.name);
     }
 }
 
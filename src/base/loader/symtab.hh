@@ -32,35 +32,87 @@
 #ifndef __SYMTAB_HH__
 #define __SYMTAB_HH__
 
+#include <algorithm>
+#include <cstdint>
 #include <iosfwd>
-#include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "base/types.hh"
 #include "sim/serialize.hh"
 
+/**
+ * A table of symbols with unique names.
+ *
+ * Symbols are stored in a vector in the order they were inserted, and
+ * looked up through vectors of their indices that are sorted by address
+ * and by name. Inserting only appends, and the indices are sorted by the
+ * first lookup after it, so that loading the many symbols of a large
+ * binary doesn't pay for lookups it doesn't do. Once sorted, the table
+ * isn't written by lookups, so its pages stay shared between forked
+ * simulators.
+ *
+ * Lookups are const, but the first one after an insert() sorts the
+ * table. They are therefore only safe to call from several threads at
+ * once if buildIndices() was called after the last insert().
+ */
 class SymbolTable
 {
   public:
-    typedef std::multimap<Addr, std::string> ATable;
-    typedef std::map<std::string, Addr> STable;
-
-  private:
-    ATable addrTable;
-    STable symbolTable;
+    struct Symbol
+    {
+        Addr address;
+        std::string name;
+    };
 
   private:
-    bool
-    upperBound(Addr addr, ATable::const_iterator &iter) const
+    typedef std::vector<uint32_t> Index;
+
+    /** All symbols, in the order they were inserted */
+    std::vector<Symbol> symbols;
+
+    /**
+     * Indices of the symbols sorted by address, with symbols at the same
+     * address in the order they were inserted, and by name. Symbols that
+     * were inserted after the last lookup aren't in them yet.
+     */
+    mutable Index byAddr;
+    mutable Index byName;
+
+    /**
+     * Symbols that aren't sorted yet, by the hash of their name, to find
+     * duplicate names when inserting.
+     */
+    mutable std::unordered_multimap<size_t, uint32_t> pendingNames;
+
+    /** Sort the symbols that were inserted since the last lookup. */
+    void sortPending() const;
+
+    void
+    sort() const
     {
-        // find first key *larger* than desired address
-        iter = addrTable.upper_bound(addr);
+        if (byAddr.size() != symbols.size())
+            sortPending();
+    }
 
-        // if very first key is larger, we're out of luck
-        if (iter == addrTable.begin())
-            return false;
+    /** The position in byAddr of the first symbol above addr */
+    Index::const_iterator
+    upperBound(Addr addr) const
+    {
+        sort();
+        return std::upper_bound(byAddr.begin(), byAddr.end(), addr,
+            [this](Addr a, uint32_t idx) { return a < symbols[idx].address; });
+    }
 
-        return true;
+    /** The position in byName of the symbol name, among sorted symbols */
+    Index::const_iterator
+    lowerBound(const std::string &name) const
+    {
+        return std::lower_bound(byName.begin(), byName.end(), name,
+            [this](uint32_t idx, const std::string &n) {
+                return symbols[idx].name < n;
+            });
     }
 
   public:
@@ -72,8 +124,21 @@ class SymbolTable
     bool insert(Addr address, std::string symbol);
     bool load(const std::string &file);
 
-    const ATable &getAddrTable() const { return addrTable; }
-    const STable &getSymbolTable() const { return symbolTable; }
+    size_t size() const { return symbols.size(); }
+
+    /** The i-th symbol in address order */
+    const Symbol &
+    symbolByAddr(size_t i) const
+    {
+        sort();
+        return symbols[byAddr[i]];
+    }
+
+    /**
+     * Sort the symbols now, e.g. before forking or before threads look
+     * them up, rather than at the first lookup.
+     */
+    void buildIndices() const { sort(); }
 
   public:
     void serialize(const std::string &base, CheckpointOut &cp) const;
@@ -83,24 +148,28 @@ class SymbolTable
     bool
     findSymbol(Addr address, std::string &symbol) const
     {
-        ATable::const_iterator i = addrTable.find(address);
-        if (i == addrTable.end())
+        sort();
+        Index::const_iterator i = std::lower_bound(
+            byAddr.begin(), byAddr.end(), address,
+            [this](uint32_t idx, Addr a) { return symbols[idx].address < a; });
+        if (i == byAddr.end() || symbols[*i].address != address)
             return false;
 
         // There are potentially multiple symbols that map to the same
         // address. For simplicity, just return the first one.
-        symbol = (*i).second;
+        symbol = symbols[*i].name;
         return true;
     }
 
     bool
     findAddress(const std::string &symbol, Addr &address) const
     {
-        STable::const_iterator i = symbolTable.find(symbol);
-        if (i == symbolTable.end())
+        sort();
+        Index::const_iterator i = lowerBound(symbol);
+        if (i == byName.end() || symbols[*i].name != symbol)
             return false;
 
-        address = (*i).second;
+        address = symbols[*i].address;
         return true;
     }
 
@@ -116,14 +185,17 @@ class SymbolTable
     findNearestSymbol(Addr addr, std::string &symbol, Addr &symaddr,
                       Addr &nextaddr) const
     {
-        ATable::const_iterator i;
-        if (!upperBound(addr, i))
+        Index::const_iterator i = upperBound(addr);
+        // if the very first symbol is larger, we're out of luck
+        if (i == byAddr.begin())
             return false;
 
-        nextaddr = i->first;
+        // the following symbol, if there is none, is at the end of the
+        // address space
+        nextaddr = i != byAddr.end() ? symbols[*i].address : MaxAddr;
         --i;
-        symaddr = i->first;
-        symbol = i->second;
+        symaddr = symbols[*i].address;
+        symbol = symbols[*i].name;
         return true;
     }
 
@@ -132,40 +204,29 @@ class SymbolTable
     bool
     findNearestSymbol(Addr addr, std::string &symbol, Addr &symaddr) const
     {
-        ATable::const_iterator i;
-        if (!upperBound(addr, i))
-            return false;
-
-        --i;
-        symaddr = i->first;
-        symbol = i->second;
-        return true;
+        Addr nextaddr;
+        return findNearestSymbol(addr, symbol, symaddr, nextaddr);
     }
 
 
     bool
     findNearestAddr(Addr addr, Addr &symaddr, Addr &nextaddr) const
     {
-        ATable::const_iterator i;
-        if (!upperBound(addr, i))
+        Index::const_iterator i = upperBound(addr);
+        if (i == byAddr.begin())
             return false;
 
-        nextaddr = i->first;
+        nextaddr = i != byAddr.end() ? symbols[*i].address : MaxAddr;
         --i;
-        symaddr = i->first;
+        symaddr = symbols[*i].address;
         return true;
     }
 
     bool
     findNearestAddr(Addr addr, Addr &symaddr) const
     {
-        ATable::const_iterator i;
-        if (!upperBound(addr, i))
-            return false;
-
-        --i;
-        symaddr = i->first;
-        return true;
+        Addr nextaddr;
+        return findNearestAddr(addr, symaddr, nextaddr);
     }
 };
 
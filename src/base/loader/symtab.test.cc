@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "base/loader/symtab.hh"
+
+namespace {
+
+/** The names of all symbols in address order */
+std::string
+namesByAddr(const SymbolTable &symtab)
+{
+    std::string names;
+    for (size_t i = 0; i < symtab.size(); ++i)
+        names += symtab.symbolByAddr(i).name + " ";
+    return names;
+}
+
+} // anonymous namespace
+
+TEST(SymbolTable, EqualAddressesKeepInsertionOrder)
+{
+    SymbolTable symtab;
+    EXPECT_TRUE(symtab.insert(0x100, "b"));
+    EXPECT_TRUE(symtab.insert(0x200, "d"));
+    EXPECT_TRUE(symtab.insert(0x100, "a"));
+    EXPECT_EQ("b a d ", namesByAddr(symtab));
+
+    std::string symbol;
+    EXPECT_TRUE(symtab.findSymbol(0x100, symbol));
+    EXPECT_EQ("b", symbol);
+
+    // Symbols inserted after the first lookup are merged in after the
+    // sorted ones at the same address
+    EXPECT_TRUE(symtab.insert(0x100, "c"));
+    EXPECT_TRUE(symtab.insert(0x80, "z"));
+    EXPECT_TRUE(symtab.insert(0x200, "0"));
+    EXPECT_EQ("z b a c d 0 ", namesByAddr(symtab));
+    EXPECT_TRUE(symtab.findSymbol(0x100, symbol));
+    EXPECT_EQ("b", symbol);
+
+    Addr symaddr, nextaddr;
+    EXPECT_TRUE(symtab.findNearestSymbol(0x1ff, symbol, symaddr, nextaddr));
+    EXPECT_EQ("c", symbol);
+    EXPECT_EQ(0x100, symaddr);
+    EXPECT_EQ(0x200, nextaddr);
+}
+
+TEST(SymbolTable, NearestSymbol)
+{
+    SymbolTable symtab;
+    symtab.insert(0x200, "high");
+    symtab.insert(0x100, "low");
+
+    std::string symbol;
+    Addr symaddr, nextaddr;
+    EXPECT_FALSE(symtab.findNearestSymbol(0xff, symbol, symaddr, nextaddr));
+
+    EXPECT_TRUE(symtab.findNearestSymbol(0x100, symbol, symaddr, nextaddr));
+    EXPECT_EQ("low", symbol);
+    EXPECT_EQ(0x100, symaddr);
+    EXPECT_EQ(0x200, nextaddr);
+
+    // The last symbol extends to the end of the address space
+    EXPECT_TRUE(symtab.findNearestSymbol(0x200, symbol, symaddr, nextaddr));
+    EXPECT_EQ("high", symbol);
+    EXPECT_EQ(MaxAddr, nextaddr);
+    EXPECT_TRUE(symtab.findNearestAddr(0x12345, symaddr, nextaddr));
+    EXPECT_EQ(0x200, symaddr);
+    EXPECT_EQ(MaxAddr, nextaddr);
+
+    EXPECT_FALSE(symtab.findNearestAddr(0x0, symaddr, nextaddr));
+    EXPECT_FALSE(SymbolTable().findNearestAddr(0x100, symaddr, nextaddr));
+}
+
+TEST(SymbolTable, DuplicateNames)
+{
+    SymbolTable symtab;
+    EXPECT_FALSE(symtab.insert(0x100, ""));
+
+    // Among pending symbols
+    EXPECT_TRUE(symtab.insert(0x100, "x"));
+    EXPECT_FALSE(symtab.insert(0x200, "x"));
+    EXPECT_EQ(1, symtab.size());
+
+    // Among sorted symbols
+    symtab.buildIndices();
+    EXPECT_FALSE(symtab.insert(0x300, "x"));
+    EXPECT_TRUE(symtab.insert(0x300, "y"));
+
+    // Among both
+    EXPECT_FALSE(symtab.insert(0x400, "x"));
+    EXPECT_FALSE(symtab.insert(0x400, "y"));
+    EXPECT_EQ(2, symtab.size());
+
+    Addr address;
+    EXPECT_TRUE(symtab.findAddress("x", address));
+    EXPECT_EQ(0x100, address);
+    EXPECT_TRUE(symtab.findAddress("y", address));
+    EXPECT_EQ(0x300, address);
+    EXPECT_FALSE(symtab.findAddress("z", address));
+}
+
+TEST(SymbolTable, FindAddressAfterMerge)
+{
+    SymbolTable symtab;
+    symtab.insert(0x300, "m");
+    symtab.insert(0x100, "c");
+    symtab.buildIndices();
+    symtab.insert(0x200, "a");
+    symtab.insert(0x400, "z");
+
+    Addr address;
+    EXPECT_TRUE(symtab.findAddress("a", address));
+    EXPECT_EQ(0x200, address);
+    EXPECT_TRUE(symtab.findAddress("c", address));
+    EXPECT_EQ(0x100, address);
+    EXPECT_TRUE(symtab.findAddress("m", address));
+    EXPECT_EQ(0x300, address);
+    EXPECT_TRUE(symtab.findAddress("z", address));
+    EXPECT_EQ(0x400, address);
+    EXPECT_FALSE(symtab.findAddress("b", address));
+}
+
+TEST(SymbolTable, Clear)
+{
+    SymbolTable symtab;
+    symtab.insert(0x100, "x");
+    symtab.buildIndices();
+    symtab.insert(0x200, "y");
+    symtab.clear();
+    EXPECT_EQ(0, symtab.size());
+
+    std::string symbol;
+    EXPECT_FALSE(symtab.findSymbol(0x100, symbol));
+    EXPECT_TRUE(symtab.insert(0x200, "x"));
+    EXPECT_TRUE(symtab.insert(0x100, "y"));
+    EXPECT_EQ("y x ", namesByAddr(symtab));
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A bounded, lock-free, single-producer/single-consumer ring buffer.
+ *
+ * This is used to hand fixed-size records from the simulation thread to a
+ * background helper thread (e.g. a trace writer) without taking a lock on
+ * the simulation thread. Exactly one thread may call the producer side
+ * (tryPush/push/tryFill) and exactly one thread may call the consumer side
+ * (tryPop/popBulk) at any given time.
+ *
+ * The capacity is rounded up to a power of two so that indices can be
+ * wrapped with a mask. Head and tail are free-running counters; the
+ * number of occupied slots is always (tail - head).
+ */
+
+#ifndef __BASE_SPSC_RING_HH__
+#define __BASE_SPSC_RING_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+template <typename T>
+class SpscRing
+{
+  public:
+    /**
+     * @param capacity Minimum number of elements the ring can hold. It is
+     *                 rounded up to the next power of two.
+     */
+    explicit SpscRing(size_t capacity)
+        : mask(roundUp(capacity) - 1), slots(mask + 1), head(0), tail(0)
+    {
+    }
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    /** Number of elements the ring can hold. */
+    size_t capacity() const { return mask + 1; }
+
+    /**
+     * Approximate number of elements in the ring. Exact when called from
+     * either the producer or the consumer thread while the other side is
+     * idle.
+     */
+    size_t
+    size() const
+    {
+        return tail.load(std::memory_order_acquire) -
+               head.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+    /**
+     * Producer side: append an element if there is room.
+     *
+     * @return true if the element was enqueued, false if the ring is full.
+     */
+    bool
+    tryPush(const T &val)
+    {
+        const uint64_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) > mask)
+            return false;
+        slots[t & mask] = val;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Producer side: append an element, yielding the host thread until
+     * the consumer has made room. Never drops data.
+     *
+     * @return true if the producer had to wait for the consumer.
+     */
+    bool
+    push(const T &val)
+    {
+        if (tryPush(val))
+            return false;
+        while (!tryPush(val))
+            std::this_thread::yield();
+        return true;
+    }
+
+    /**
+     * Producer side: fill the next free slot in place, which avoids a copy
+     * for elements that are expensive to construct (e.g. protobuf
+     * messages whose allocations can be reused). The slot still holds
+     * whatever element last occupied it.
+     *
+     * @param func Called with a reference to the free slot. The element is
+     *             only published if func returns true.
+     * @return true if an element was published, false if the ring was
+     *         full or func returned false.
+     */
+    template <typename Func>
+    bool
+    tryFill(Func func)
+    {
+        const uint64_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) > mask)
+            return false;
+        if (!func(slots[t & mask]))
+            return false;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer side: remove the oldest element if there is one.
+     *
+     * @return true if an element was written to val.
+     */
+    bool
+    tryPop(T &val)
+    {
+        const uint64_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire))
+            return false;
+        val = slots[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer side: remove up to max_count elements in FIFO order,
+     * calling func on each element in place before releasing the slots
+     * back to the producer. func may modify (e.g. swap out) the element.
+     *
+     * @return The number of elements consumed.
+     */
+    template <typename Func>
+    size_t
+    popBulk(size_t max_count, Func func)
+    {
+        const uint64_t h = head.load(std::memory_order_relaxed);
+        const uint64_t t = tail.load(std::memory_order_acquire);
+        size_t count = t - h;
+        if (count > max_count)
+            count = max_count;
+        for (size_t i = 0; i < count; ++i)
+            func(slots[(h + i) & mask]);
+        head.store(h + count, std::memory_order_release);
+        return count;
+    }
+
+  private:
+    static size_t
+    roundUp(size_t n)
+    {
+        size_t p = 1;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+
+    const size_t mask;
+    std::vector<T> slots;
+
+    /**
+     * Consumer and producer indices, kept on separate cache lines to
+     * avoid false sharing between the two threads.
+     * @{
+     */
+    char pad0[64];
+    std::atomic<uint64_t> head;
+    char pad1[64 - sizeof(std::atomic<uint64_t>)];
+    std::atomic<uint64_t> tail;
+    /** @} */
+};
+
+#endif // __BASE_SPSC_RING_HH__
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Unit tests for the single-producer/single-consumer ring buffer.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "base/spsc_ring.hh"
+
+// The capacity is rounded up to a power of two
+TEST(SpscRingTest, CapacityRoundsUp)
+{
+    SpscRing<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8);
+    EXPECT_TRUE(ring.empty());
+}
+
+// Pushing past capacity fails until the consumer frees a slot
+TEST(SpscRingTest, FullAndEmpty)
+{
+    SpscRing<int> ring(4);
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(ring.tryPush(i));
+    EXPECT_FALSE(ring.tryPush(4));
+    EXPECT_EQ(ring.size(), 4);
+
+    int val;
+    EXPECT_TRUE(ring.tryPop(val));
+    EXPECT_EQ(val, 0);
+    EXPECT_TRUE(ring.tryPush(4));
+
+    for (int i = 1; i < 5; i++) {
+        EXPECT_TRUE(ring.tryPop(val));
+        EXPECT_EQ(val, i);
+    }
+    EXPECT_FALSE(ring.tryPop(val));
+}
+
+// Bulk pops honour the limit and preserve FIFO order across wrap-around
+TEST(SpscRingTest, PopBulk)
+{
+    SpscRing<unsigned> ring(4);
+    unsigned next = 0;
+    std::vector<unsigned> out;
+    auto collect = [&out](unsigned v) { out.push_back(v); };
+    for (int round = 0; round < 3; round++) {
+        while (ring.tryPush(next))
+            next++;
+        EXPECT_EQ(ring.popBulk(3, collect), 3);
+    }
+    ring.popBulk(100, collect);
+    ASSERT_EQ(out.size(), next);
+    for (unsigned i = 0; i < next; i++)
+        EXPECT_EQ(out[i], i);
+}
+
+// In-place fills are only published when the fill function succeeds
+TEST(SpscRingTest, TryFill)
+{
+    SpscRing<int> ring(2);
+    EXPECT_TRUE(ring.tryFill([](int &v) { v = 1; return true; }));
+    EXPECT_FALSE(ring.tryFill([](int &v) { v = 2; return false; }));
+    EXPECT_EQ(ring.size(), 1);
+    EXPECT_TRUE(ring.tryFill([](int &v) { v = 3; return true; }));
+    EXPECT_FALSE(ring.tryFill([](int &v) { v = 4; return true; }));
+
+    int val;
+    EXPECT_TRUE(ring.tryPop(val));
+    EXPECT_EQ(val, 1);
+    EXPECT_TRUE(ring.tryPop(val));
+    EXPECT_EQ(val, 3);
+}
+
+// A producer and a consumer thread exchange a long sequence losslessly
+TEST(SpscRingTest, Threaded)
+{
+    const uint64_t count = 1 << 16;
+    SpscRing<uint64_t> ring(64);
+
+    std::thread producer([&ring, count]() {
+        for (uint64_t i = 0; i < count; i++)
+            ring.push(i);
+    });
+
+    uint64_t expected = 0;
+    bool in_order = true;
+    while (expected < count) {
+        auto check = [&](uint64_t v) {
+            in_order &= (v == expected);
+            expected++;
+        };
+        if (ring.popBulk(16, check) == 0)
+            std::this_thread::yield();
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_TRUE(ring.empty());
+}
@@ -504,6 +504,40 @@ enabled()
     return _enabled;
 }
 
+namespace {
+
+struct ChangedStat
+{
+    InfoAccess *stat;
+    Info *info;
+};
+
+/** Tracked stats updated since the last dump and since the last reset */
+vector<ChangedStat> changedSinceDump;
+vector<ChangedStat> changedSinceReset;
+
+/** Stats that aren't tracked, visited by every dump and reset */
+vector<Info *> untrackedStats;
+
+/** All stats in dump order */
+vector<Info *> _orderedStats;
+
+/** Position of each stat in the dump order, indexed by stat ID */
+vector<size_t> dumpOrder;
+
+} // anonymous namespace
+
+void
+InfoAccess::markChanged()
+{
+    const ChangedStat changed = { this, info() };
+    if (!(changeState & ChangedSinceDump))
+        changedSinceDump.push_back(changed);
+    if (!(changeState & ChangedSinceReset))
+        changedSinceReset.push_back(changed);
+    changeState = ChangedSinceBoth;
+}
+
 void
 enable()
 {
@@ -511,6 +545,75 @@ enable()
         fatal("Stats are already enabled");
 
     _enabled = true;
+
+    vector<Info *> &stats = _orderedStats;
+    if (stats.empty()) {
+        stats.assign(statsList().begin(), statsList().end());
+        sort(stats.begin(), stats.end(), Info::less);
+    }
+    dumpOrder.resize(Info::id_count);
+    for (size_t i = 0; i < stats.size(); ++i) {
+        dumpOrder[stats[i]->id] = i;
+        if (!stats[i]->tracked())
+            untrackedStats.push_back(stats[i]);
+    }
+}
+
+void
+setDumpOrder(const vector<Info *> &stats)
+{
+    if (_enabled)
+        fatal("Can't change the dump order once stats are enabled");
+
+    _orderedStats = stats;
+}
+
+const vector<Info *> &
+orderedStats()
+{
+    return _orderedStats;
+}
+
+vector<Info *>
+takeChangedStats()
+{
+    vector<Info *> stats(untrackedStats);
+    stats.reserve(stats.size() + changedSinceDump.size());
+    for (auto &changed : changedSinceDump) {
+        changed.stat->changeState &= ~InfoAccess::ChangedSinceDump;
+        stats.push_back(changed.info);
+    }
+    changedSinceDump.clear();
+
+    sort(stats.begin(), stats.end(), [](const Info *a, const Info *b) {
+            return dumpOrder[a->id] < dumpOrder[b->id];
+        });
+    return stats;
+}
+
+void
+clearChangedStats()
+{
+    for (auto &changed : changedSinceDump)
+        changed.stat->changeState &= ~InfoAccess::ChangedSinceDump;
+    changedSinceDump.clear();
+}
+
+void
+resetChangedStats()
+{
+    for (auto *info : untrackedStats)
+        info->reset();
+
+    // A reset changes the value of the stat, so the next incremental
+    // dump has to include it
+    for (auto &changed : changedSinceReset) {
+        changed.info->reset();
+        if (!(changed.stat->changeState & InfoAccess::ChangedSinceDump))
+            changedSinceDump.push_back(changed);
+        changed.stat->changeState = InfoAccess::ChangedSinceDump;
+    }
+    changedSinceReset.clear();
 }
 
 void
@@ -61,6 +61,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "base/stats/info.hh"
@@ -98,6 +99,7 @@ class InfoProxy : public Base
         visitor.visit(*static_cast<Base *>(this));
     }
     bool zero() const { return s.zero(); }
+    bool tracked() const { return s.tracked(); }
 };
 
 template <class Stat>
@@ -172,6 +174,26 @@ struct StorageParams
 
 class InfoAccess
 {
+  private:
+    /** Bits of changeState */
+    enum ChangeState : uint8_t
+    {
+        /** In the list of stats changed since the last dump */
+        ChangedSinceDump = 0x1,
+        /** In the list of stats changed since the last reset */
+        ChangedSinceReset = 0x2,
+        ChangedSinceBoth = ChangedSinceDump | ChangedSinceReset,
+    };
+
+    uint8_t changeState;
+
+    /** Add the stat to the changed stats lists it isn't in yet */
+    void markChanged();
+
+    friend std::vector<Info *> takeChangedStats();
+    friend void clearChangedStats();
+    friend void resetChangedStats();
+
   protected:
     /** Set up an info class for this statistic */
     void setInfo(Info *info);
@@ -186,6 +208,27 @@ class InfoAccess
     const Info *info() const;
 
   public:
+    InfoAccess() : changeState(0) { }
+
+    /**
+     * Record an update of the stat's value. Only stats that have been
+     * updated are visited by incremental dumps and by resets, so every
+     * update of a tracked stat has to call this.
+     */
+    void
+    touch()
+    {
+        if (changeState != ChangedSinceBoth)
+            markChanged();
+    }
+
+    /**
+     * Whether all changes of the stat go through touch(). Stats whose
+     * value can change without an update, like values, formulas and
+     * averages over time, are instead visited by every dump and reset.
+     */
+    bool tracked() const { return false; }
+
     /**
      * Reset the stat to the default state.
      */
@@ -462,6 +505,14 @@ class DataWrapVec2d : public DataWrapVec<Derived, InfoProxyType>
 //
 //////////////////////////////////////////////////////////////////////
 
+/**
+ * True for storage whose value depends on the current tick, and so
+ * changes without updates. Stats using it can't be tracked with
+ * InfoAccess::touch().
+ */
+template <class Stor>
+struct TimeDependentStor : std::false_type {};
+
 /**
  * Templatized storage and interface for a simple scalar stat.
  */
@@ -623,6 +674,9 @@ class AvgStor
 
 };
 
+template <>
+struct TimeDependentStor<AvgStor> : std::true_type {};
+
 /**
  * Implementation of a scalar stat. The type of stat is determined by the
  * Storage template.
@@ -688,12 +742,12 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * Increment the stat by 1. This calls the associated storage object inc
      * function.
      */
-    void operator++() { data()->inc(1); }
+    void operator++() { this->touch(); data()->inc(1); }
     /**
      * Decrement the stat by 1. This calls the associated storage object dec
      * function.
      */
-    void operator--() { data()->dec(1); }
+    void operator--() { this->touch(); data()->dec(1); }
 
     /** Increment the stat by 1. */
     void operator++(int) { ++*this; }
@@ -706,7 +760,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * @param v The new value.
      */
     template <typename U>
-    void operator=(const U &v) { data()->set(v); }
+    void operator=(const U &v) { this->touch(); data()->set(v); }
 
     /**
      * Increment the stat by the given value. This calls the associated
@@ -714,7 +768,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * @param v The value to add.
      */
     template <typename U>
-    void operator+=(const U &v) { data()->inc(v); }
+    void operator+=(const U &v) { this->touch(); data()->inc(v); }
 
     /**
      * Decrement the stat by the given value. This calls the associated
@@ -722,7 +776,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * @param v The value to substract.
      */
     template <typename U>
-    void operator-=(const U &v) { data()->dec(v); }
+    void operator-=(const U &v) { this->touch(); data()->dec(v); }
 
     /**
      * Return the number of elements, always 1 for a scalar.
@@ -738,6 +792,8 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
 
     bool zero() { return result() == 0.0; }
 
+    bool tracked() const { return !TimeDependentStor<Stor>::value; }
+
     void reset() { data()->reset(this->info()); }
     void prepare() { data()->prepare(this->info()); }
 };
@@ -926,12 +982,12 @@ class ScalarProxy
      * Increment the stat by 1. This calls the associated storage object inc
      * function.
      */
-    void operator++() { stat.data(index)->inc(1); }
+    void operator++() { stat.touch(); stat.data(index)->inc(1); }
     /**
      * Decrement the stat by 1. This calls the associated storage object dec
      * function.
      */
-    void operator--() { stat.data(index)->dec(1); }
+    void operator--() { stat.touch(); stat.data(index)->dec(1); }
 
     /** Increment the stat by 1. */
     void operator++(int) { ++*this; }
@@ -947,6 +1003,7 @@ class ScalarProxy
     void
     operator=(const U &v)
     {
+        stat.touch();
         stat.data(index)->set(v);
     }
 
@@ -959,6 +1016,7 @@ class ScalarProxy
     void
     operator+=(const U &v)
     {
+        stat.touch();
         stat.data(index)->inc(v);
     }
 
@@ -971,6 +1029,7 @@ class ScalarProxy
     void
     operator-=(const U &v)
     {
+        stat.touch();
         stat.data(index)->dec(v);
     }
 
@@ -1088,6 +1147,8 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
         return true;
     }
 
+    bool tracked() const { return !TimeDependentStor<Stor>::value; }
+
     bool
     check() const
     {
@@ -1302,6 +1363,8 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
 #endif
     }
 
+    bool tracked() const { return !TimeDependentStor<Stor>::value; }
+
     /**
      * Return a total of all entries in this vector.
      * @return The total of all vector entries.
@@ -1812,6 +1875,9 @@ class AvgSampleStor
     }
 };
 
+template <>
+struct TimeDependentStor<AvgSampleStor> : std::true_type {};
+
 /**
  * Implementation of a distribution stat. The type of distribution is
  * determined by the Storage template. @sa ScalarBase
@@ -1866,7 +1932,7 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
      * @param n The number of times to add it, defaults to 1.
      */
     template <typename U>
-    void sample(const U &v, int n = 1) { data()->sample(v, n); }
+    void sample(const U &v, int n = 1) { this->touch(); data()->sample(v, n); }
 
     /**
      * Return the number of entries in this stat.
@@ -1879,6 +1945,8 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
      */
     bool zero() const { return data()->zero(); }
 
+    bool tracked() const { return !TimeDependentStor<Stor>::value; }
+
     void
     prepare()
     {
@@ -1898,7 +1966,7 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
     /**
      *  Add the argument distribution to the this distribution.
      */
-    void add(DistBase &d) { data()->add(d.data()); }
+    void add(DistBase &d) { this->touch(); data()->add(d.data()); }
 
 };
 
@@ -1986,6 +2054,8 @@ class VectorDistBase : public DataWrapVec<Derived, VectorDistInfoProxy>
         return true;
     }
 
+    bool tracked() const { return !TimeDependentStor<Stor>::value; }
+
     void
     prepare()
     {
@@ -2036,6 +2106,7 @@ class DistProxy
     void
     sample(const U &v, int n = 1)
     {
+        stat.touch();
         data()->sample(v, n);
     }
 
@@ -2765,7 +2836,7 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
      * @param n The number of times to add it, defaults to 1.
      */
     template <typename U>
-    void sample(const U &v, int n = 1) { data()->sample(v, n); }
+    void sample(const U &v, int n = 1) { this->touch(); data()->sample(v, n); }
 
     /**
      * Return the number of entries in this stat.
@@ -2778,6 +2849,8 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
      */
     bool zero() const { return data()->zero(); }
 
+    bool tracked() const { return !TimeDependentStor<Stor>::value; }
+
     void
     prepare()
     {
@@ -3234,6 +3307,33 @@ void reset();
 void enable();
 bool enabled();
 
+/**
+ * Set the order in which stats are dumped, which defaults to the order
+ * of Info::less. Must be called before enable().
+ */
+void setDumpOrder(const std::vector<Info *> &stats);
+
+/** All stats in dump order, valid once stats are enabled */
+const std::vector<Info *> &orderedStats();
+
+/**
+ * Get the stats that may have changed since the last dump, in dump
+ * order: the tracked stats that have been updated, or reset, since then
+ * and all stats that aren't tracked. The tracked stats are then
+ * considered unchanged until they are updated again.
+ */
+std::vector<Info *> takeChangedStats();
+
+/** Consider all tracked stats unchanged, e.g. after a full dump */
+void clearChangedStats();
+
+/**
+ * Reset the stats that may have changed since the last reset, i.e. the
+ * tracked stats that have been updated since then and all stats that
+ * aren't tracked.
+ */
+void resetChangedStats();
+
 /**
  * Register reset and dump handlers.  These are the functions which
  * will actually perform the whole statistics reset/dump actions
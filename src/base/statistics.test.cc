@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/stats/output.hh"
+
+using namespace Stats;
+
+namespace {
+
+/** The values of the stats visited by a dump, by name */
+typedef std::map<std::string, std::vector<double>> Values;
+
+/** An output that records the values it is given */
+class RecordOutput : public Output
+{
+  public:
+    Values values;
+
+    void begin(std::string desc) override { }
+    void end() override { }
+    bool valid() const override { return true; }
+
+    void
+    visit(const ScalarInfo &info) override
+    {
+        values[info.name] = { info.value() };
+    }
+
+    void
+    visit(const VectorInfo &info) override
+    {
+        const VResult &result = info.result();
+        values[info.name].assign(result.begin(), result.end());
+    }
+
+    void
+    visit(const DistInfo &info) override
+    {
+        const DistData &data = info.data;
+        std::vector<double> &v = values[info.name];
+        v.assign(data.cvec.begin(), data.cvec.end());
+        v.insert(v.end(), { data.min_val, data.max_val, data.underflow,
+                            data.overflow, data.sum, data.squares,
+                            data.samples });
+    }
+
+    void
+    visit(const VectorDistInfo &info) override
+    {
+        std::vector<double> &v = values[info.name];
+        v.clear();
+        for (const DistData &data : info.data) {
+            v.insert(v.end(), data.cvec.begin(), data.cvec.end());
+            v.insert(v.end(), { data.sum, data.samples });
+        }
+    }
+
+    void
+    visit(const Vector2dInfo &info) override
+    {
+        values[info.name].assign(info.cvec.begin(), info.cvec.end());
+    }
+
+    void
+    visit(const FormulaInfo &info) override
+    {
+        visit(static_cast<const VectorInfo &>(info));
+    }
+
+    void
+    visit(const SparseHistInfo &info) override
+    {
+        std::vector<double> &v = values[info.name];
+        v.clear();
+        for (const auto &entry : info.data.cmap)
+            v.insert(v.end(), { entry.first, double(entry.second) });
+        v.push_back(info.data.samples);
+    }
+};
+
+/** Prepare the given stats and record their values */
+Values
+dumpStats(const std::vector<Info *> &stats)
+{
+    RecordOutput output;
+    for (Info *info : stats)
+        info->prepare();
+    for (Info *info : stats)
+        info->visit(output);
+    return output.values;
+}
+
+/**
+ * Stats are registered and enabled for the rest of the program, so the
+ * tests share one set of them.
+ */
+struct TestStats
+{
+    static const int NumScalars = 8;
+
+    Scalar scalars[NumScalars];
+    Vector vector;
+    Vector2d vector2d;
+    Distribution dist;
+    Histogram hist;
+    VectorDistribution vdist;
+    SparseHistogram sparse;
+    Formula formula;
+
+    TestStats()
+    {
+        for (int i = 0; i < NumScalars; ++i) {
+            scalars[i].name("test.scalar" + std::to_string(i))
+                .desc("scalar");
+        }
+        vector.init(4).name("test.vector").desc("vector");
+        vector2d.init(2, 3).name("test.vector2d").desc("vector2d");
+        dist.init(0, 15, 2).name("test.dist").desc("dist");
+        hist.init(8).name("test.hist").desc("hist");
+        vdist.init(2, 0, 7, 1).name("test.vdist").desc("vdist");
+        sparse.init(0).name("test.sparse").desc("sparse");
+        formula.name("test.formula").desc("formula");
+        formula = scalars[0] + vector;
+        enable();
+    }
+
+    /** Update a random selection of the stats */
+    void
+    update(std::mt19937 &rng)
+    {
+        std::uniform_int_distribution<int> which(0, NumScalars + 6);
+        std::uniform_int_distribution<int> value(0, 20);
+        int updates = value(rng) / 4;
+        for (int i = 0; i < updates; ++i) {
+            int stat = which(rng);
+            if (stat < NumScalars) {
+                scalars[stat] += value(rng);
+                continue;
+            }
+            switch (stat - NumScalars) {
+              case 0: vector[value(rng) % 4] += value(rng); break;
+              case 1: vector2d[value(rng) % 2][value(rng) % 3]++; break;
+              case 2: dist.sample(value(rng)); break;
+              case 3: hist.sample(value(rng) * 3); break;
+              case 4: vdist[value(rng) % 2].sample(value(rng) % 8); break;
+              case 5: sparse.sample(value(rng)); break;
+              default: scalars[0] = value(rng); break;
+            }
+        }
+    }
+};
+
+TestStats &
+testStats()
+{
+    static TestStats *stats = new TestStats;
+    return *stats;
+}
+
+} // anonymous namespace
+
+/**
+ * Keep the values of the last incremental dump that included each stat,
+ * as a reader of incremental dumps would, and check them against a full
+ * dump after every step, including after resets of the changed stats.
+ */
+TEST(StatisticsTest, IncrementalDumpMatchesFullDump)
+{
+    TestStats &stats = testStats();
+    std::mt19937 rng(7);
+
+    Values current = dumpStats(orderedStats());
+    clearChangedStats();
+    EXPECT_EQ(current.size(), orderedStats().size());
+
+    for (int step = 0; step < 500; ++step) {
+        stats.update(rng);
+
+        std::vector<Info *> changed = takeChangedStats();
+        EXPECT_LE(changed.size(), orderedStats().size());
+        for (const auto &value : dumpStats(changed))
+            current[value.first] = value.second;
+
+        ASSERT_EQ(current, dumpStats(orderedStats())) << "step " << step;
+
+        if (step % 17 == 0) {
+            resetChangedStats();
+            for (const auto &value : dumpStats(takeChangedStats()))
+                current[value.first] = value.second;
+            ASSERT_EQ(current, dumpStats(orderedStats()))
+                << "reset at step " << step;
+        }
+    }
+}
+
+/**
+ * Resetting only the changed stats leaves every stat with the value a
+ * full reset gives it.
+ */
+TEST(StatisticsTest, ChangedResetMatchesFullReset)
+{
+    TestStats &stats = testStats();
+    std::mt19937 rng(11);
+
+    for (int step = 0; step < 50; ++step) {
+        for (int i = 0; i < step % 5 + 1; ++i)
+            stats.update(rng);
+
+        resetChangedStats();
+        Values changed_reset = dumpStats(orderedStats());
+
+        for (Info *info : orderedStats())
+            info->reset();
+        ASSERT_EQ(changed_reset, dumpStats(orderedStats()))
+            << "step " << step;
+    }
+}
+
+/** Incremental dumps visit stats in the order of full dumps. */
+TEST(StatisticsTest, IncrementalDumpOrder)
+{
+    TestStats &stats = testStats();
+    takeChangedStats();
+
+    stats.scalars[5]++;
+    stats.vector[0]++;
+    stats.scalars[1]++;
+    stats.scalars[5]++;
+
+    std::vector<Info *> changed = takeChangedStats();
+    std::vector<Info *> expected;
+    for (Info *info : orderedStats()) {
+        if (!info->tracked() || info->name == "test.scalar1" ||
+            info->name == "test.scalar5" || info->name == "test.vector") {
+            expected.push_back(info);
+        }
+    }
+    EXPECT_EQ(changed, expected);
+}
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Columnar binary stats output.
+ */
+
+#include "base/stats/binary.hh"
+
+#include <cmath>
+#include <cstring>
+#include <ostream>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+
+using namespace std;
+
+namespace Stats {
+
+namespace {
+
+const char magic[] = "gem5sbn";
+const uint8_t version = 1;
+
+template <typename T>
+void
+put(string &buf, T val)
+{
+    buf.append(reinterpret_cast<const char *>(&val), sizeof(val));
+}
+
+void
+put(string &buf, const string &str)
+{
+    put<uint32_t>(buf, str.size());
+    buf.append(str);
+}
+
+void
+put(string &buf, const vector<string> &strs)
+{
+    put<uint32_t>(buf, strs.size());
+    for (const auto &str : strs)
+        put(buf, str);
+}
+
+} // anonymous namespace
+
+Binary::Binary()
+    : stream(nullptr), layouts(0), newStats(0), sparseStats(0)
+{
+}
+
+Binary::Binary(std::ostream &stream)
+    : Binary()
+{
+    open(stream);
+}
+
+void
+Binary::open(std::ostream &_stream)
+{
+    if (stream)
+        panic("stream already set!");
+
+    stream = &_stream;
+    stream->write(magic, sizeof(magic) - 1);
+    stream->put(version);
+}
+
+bool
+Binary::valid() const
+{
+    return stream != nullptr;
+}
+
+bool
+Binary::noOutput(const Info &info) const
+{
+    return !info.flags.isSet(display);
+}
+
+void
+Binary::writeChunk(char type, const string &payload)
+{
+    const uint32_t len = payload.size();
+    stream->put(type);
+    stream->write(reinterpret_cast<const char *>(&len), sizeof(len));
+    stream->write(payload.data(), len);
+}
+
+void
+Binary::begin(std::string _desc)
+{
+    desc = _desc;
+    newStats = 0;
+    schema.clear();
+    ids.clear();
+    widths.clear();
+    values.clear();
+    sparseStats = 0;
+    sparse.clear();
+}
+
+void
+Binary::end()
+{
+    if (newStats) {
+        string payload;
+        put(payload, newStats);
+        payload.append(schema);
+        writeChunk('S', payload);
+    }
+
+    if (!layouts || ids != layoutIds || widths != layoutWidths) {
+        layoutIds = ids;
+        layoutWidths = widths;
+
+        string payload;
+        put(payload, layouts++);
+        put<uint32_t>(payload, ids.size());
+        payload.append(reinterpret_cast<const char *>(ids.data()),
+                       ids.size() * sizeof(uint32_t));
+        payload.append(reinterpret_cast<const char *>(widths.data()),
+                       widths.size() * sizeof(uint32_t));
+        writeChunk('L', payload);
+    }
+
+    string payload;
+    put<uint32_t>(payload, layouts - 1);
+    put(payload, desc);
+    put<uint32_t>(payload, values.size());
+    payload.append(reinterpret_cast<const char *>(values.data()),
+                   values.size() * sizeof(double));
+    put(payload, sparseStats);
+    payload.append(sparse);
+    writeChunk('D', payload);
+
+    stream->flush();
+}
+
+bool
+Binary::describe(const Info &info, Kind kind)
+{
+    if (info.id >= described.size())
+        described.resize(info.id + 1);
+    if (described[info.id])
+        return false;
+    described[info.id] = true;
+
+    ++newStats;
+    put<uint32_t>(schema, info.id);
+    put<uint8_t>(schema, kind);
+    put<uint16_t>(schema, info.flags);
+    put<int32_t>(schema, info.precision);
+    put<int32_t>(schema, info.prereq ? info.prereq->id : -1);
+    put(schema, info.name);
+    put(schema, info.desc);
+    return true;
+}
+
+void
+Binary::addColumn(const Info &info, size_t first)
+{
+    ids.push_back(info.id);
+    widths.push_back(values.size() - first);
+}
+
+void
+Binary::addDist(const DistData &data)
+{
+    const size_t first = values.size();
+    values.resize(first + distFields, NAN);
+    double *fields = &values[first];
+
+    fields[Samples] = data.samples;
+    fields[Sum] = data.sum;
+    fields[Squares] = data.squares;
+    if (data.type == Deviation)
+        return;
+
+    fields[Min] = data.min;
+    fields[Max] = data.max;
+    fields[BucketSize] = data.bucket_size;
+    fields[MinVal] = data.min_val;
+    fields[MaxVal] = data.max_val;
+    if (data.type == Hist) {
+        fields[Logs] = data.logs;
+    } else {
+        fields[Underflow] = data.underflow;
+        fields[Overflow] = data.overflow;
+    }
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    describe(info, ScalarKind);
+
+    const size_t first = values.size();
+    values.push_back(info.result());
+    addColumn(info, first);
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    if (describe(info, VectorKind)) {
+        put(schema, info.subnames);
+        put(schema, info.subdescs);
+    }
+
+    const size_t first = values.size();
+    const VResult &result = info.result();
+    values.insert(values.end(), result.begin(), result.end());
+    values.push_back(info.total());
+    addColumn(info, first);
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    if (describe(info, DistKind))
+        put<uint8_t>(schema, info.data.type);
+
+    const size_t first = values.size();
+    addDist(info.data);
+    addColumn(info, first);
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    if (describe(info, VectorDistKind)) {
+        put<uint8_t>(schema, info.data.empty() ? Deviation :
+                     info.data[0].type);
+        put<uint32_t>(schema, info.data.size());
+        put(schema, info.subnames);
+        put(schema, info.subdescs);
+    }
+
+    const size_t first = values.size();
+    for (const auto &data : info.data)
+        addDist(data);
+    addColumn(info, first);
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    if (describe(info, Vector2dKind)) {
+        put<uint32_t>(schema, info.x);
+        put<uint32_t>(schema, info.y);
+        put(schema, info.subnames);
+        put(schema, info.subdescs);
+        put(schema, info.y_subnames);
+    }
+
+    const size_t first = values.size();
+    values.insert(values.end(), info.cvec.begin(), info.cvec.end());
+    values.push_back(info.total());
+    addColumn(info, first);
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    if (describe(info, FormulaKind)) {
+        put(schema, info.subnames);
+        put(schema, info.subdescs);
+        put(schema, info.str());
+    }
+
+    const size_t first = values.size();
+    const VResult &result = info.result();
+    values.insert(values.end(), result.begin(), result.end());
+    values.push_back(info.total());
+    addColumn(info, first);
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    describe(info, SparseHistKind);
+
+    ++sparseStats;
+    put<uint32_t>(sparse, info.id);
+    put<double>(sparse, info.data.samples);
+    put<uint32_t>(sparse, info.data.cmap.size());
+    for (const auto &bucket : info.data.cmap) {
+        put<double>(sparse, bucket.first);
+        put<double>(sparse, bucket.second);
+    }
+}
+
+Output *
+initBinary(const string &filename)
+{
+    static Binary binary;
+    static bool connected = false;
+
+    if (!connected) {
+        binary.open(*simout.findOrCreate(filename, true)->stream());
+        connected = true;
+    }
+
+    return &binary;
+}
+
+} // namespace Stats
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Output gem5 stats in a compact, columnar binary format.
+ *
+ * The output is meant for post-processing many dumps, e.g. with
+ * util/stats/binary.py, which loads them into numpy arrays. The
+ * description of each stat is written once, and each dump is a single
+ * array of doubles whose layout, i.e. which stats are at which offsets,
+ * is only written when it changes.
+ *
+ * The file starts with the magic "gem5sbn" and a version byte, followed
+ * by chunks of a type character, a uint32 length and the payload. All
+ * integers and doubles are in host byte order, strings are a uint32
+ * length followed by the characters, and string lists are a uint32 count
+ * followed by the strings.
+ *
+ * 'S' Descriptions of stats that appear for the first time: a uint32
+ *     count, then for each stat its uint32 ID, uint8 Kind, uint16 flags,
+ *     int32 precision, int32 ID of the prerequisite (-1 for none), name
+ *     and description, followed by
+ *       Vector, Formula: subnames and subdescs; formulas add the formula
+ *       Dist: uint8 DistType
+ *       VectorDist: uint8 DistType, uint32 size, subnames and subdescs
+ *       Vector2d: uint32 x and y, subnames, subdescs and y_subnames
+ *
+ * 'L' A layout: a uint32 layout number (0, 1, ...), a uint32 count of
+ *     stats, their uint32 IDs and the uint32 number of values of each.
+ *
+ * 'D' A dump: the uint32 number of its layout, the description of the
+ *     dump, a uint32 count of values and the values, which are
+ *       Scalar: the result
+ *       Vector, Formula: the results followed by the total
+ *       Vector2d: the x * y counts, row by row, followed by the total
+ *       Dist: the distFields summary values (see DistField), followed by
+ *         the buckets; fields that the type of distribution doesn't have
+ *         are NaN
+ *       VectorDist: one Dist after the other
+ *     Sparse histograms have varying keys, so they follow as a uint32
+ *     count and then for each its uint32 ID, double samples, uint32
+ *     count of buckets and the double key and count of each bucket.
+ *
+ * Unlike the text output, zero stats and stats whose prerequisite is
+ * zero are written, so that the layout rarely changes. Stats without
+ * the display flag are left out.
+ */
+
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "base/stats/info.hh"
+#include "base/stats/output.hh"
+
+namespace Stats {
+
+class Binary : public Output
+{
+  public:
+    enum Kind : uint8_t {
+        ScalarKind = 1,
+        VectorKind,
+        DistKind,
+        VectorDistKind,
+        Vector2dKind,
+        FormulaKind,
+        SparseHistKind,
+    };
+
+    /** The summary values at the start of each distribution */
+    enum DistField {
+        Samples, Sum, Squares, Logs, Min, Max, BucketSize, MinVal, MaxVal,
+        Underflow, Overflow,
+        distFields
+    };
+
+  protected:
+    std::ostream *stream;
+
+    /** Whether the description of each stat, by ID, has been written */
+    std::vector<bool> described;
+
+    /** The last layout written */
+    std::vector<uint32_t> layoutIds;
+    std::vector<uint32_t> layoutWidths;
+    uint32_t layouts;
+
+    /** The dump being built */
+    std::string desc;
+    uint32_t newStats;
+    std::string schema;
+    std::vector<uint32_t> ids;
+    std::vector<uint32_t> widths;
+    std::vector<double> values;
+    uint32_t sparseStats;
+    std::string sparse;
+
+  protected:
+    bool noOutput(const Info &info) const;
+
+    /**
+     * Start the description of a stat if it hasn't been written yet.
+     * @return Whether the kind-specific fields should be added.
+     */
+    bool describe(const Info &info, Kind kind);
+
+    /** Add the values of a stat, which have been added to values */
+    void addColumn(const Info &info, size_t first);
+
+    void addDist(const DistData &data);
+
+    void writeChunk(char type, const std::string &payload);
+
+  public:
+    Binary();
+    Binary(std::ostream &stream);
+
+    void open(std::ostream &stream);
+
+    // Implement Visit
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+    // Implement Output
+    bool valid() const override;
+    void begin(std::string desc="") override;
+    void end() override;
+};
+
+Output *initBinary(const std::string &filename);
+
+} // namespace Stats
+
+#endif // __BASE_STATS_BINARY_HH__
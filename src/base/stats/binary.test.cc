@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/stats/binary.hh"
+
+using namespace Stats;
+
+namespace {
+
+/** A stat as described in an 'S' chunk */
+struct StatDesc
+{
+    uint32_t id;
+    uint8_t kind;
+    uint16_t flags;
+    int32_t precision;
+    int32_t prereq;
+    std::string name;
+    std::string desc;
+    std::vector<std::string> subnames;
+    std::vector<std::string> subdescs;
+    std::vector<std::string> ySubnames;
+    std::string formula;
+    uint8_t distType;
+    uint32_t size, x, y;
+};
+
+/** A dump, with the values of each stat by name */
+struct Dump
+{
+    uint32_t layout;
+    std::string desc;
+    std::map<std::string, std::vector<double>> values;
+    std::map<std::string, std::vector<double>> sparse;
+};
+
+/**
+ * Decode a binary stats file the way util/stats/binary.py does, and
+ * check the consistency of its chunks on the way.
+ */
+class Decoder
+{
+  public:
+    std::map<uint32_t, StatDesc> stats;
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> layouts;
+    std::vector<Dump> dumps;
+
+    explicit Decoder(const std::string &data)
+        : data(data), pos(0)
+    {
+        decode();
+    }
+
+  private:
+    const std::string &data;
+    size_t pos;
+
+    void
+    decode()
+    {
+        EXPECT_EQ(data.compare(0, 7, "gem5sbn"), 0);
+        pos = 7;
+        EXPECT_EQ(get<uint8_t>(), 1);
+
+        while (pos < data.size()) {
+            char type = get<char>();
+            uint32_t length = get<uint32_t>();
+            size_t end = pos + length;
+            ASSERT_LE(end, data.size());
+            switch (type) {
+              case 'S': describe(); break;
+              case 'L': layout(); break;
+              case 'D': dump(); break;
+              default: FAIL() << "unknown chunk " << type;
+            }
+            EXPECT_EQ(pos, end) << "chunk " << type;
+            pos = end;
+        }
+    }
+
+    template <typename T>
+    T
+    get()
+    {
+        T val;
+        EXPECT_LE(pos + sizeof(T), data.size());
+        std::memcpy(&val, data.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return val;
+    }
+
+    std::string
+    string()
+    {
+        uint32_t length = get<uint32_t>();
+        std::string str = data.substr(pos, length);
+        pos += length;
+        return str;
+    }
+
+    std::vector<std::string>
+    strings()
+    {
+        std::vector<std::string> strs(get<uint32_t>());
+        for (auto &str : strs)
+            str = string();
+        return strs;
+    }
+
+    void
+    describe()
+    {
+        for (uint32_t count = get<uint32_t>(); count; --count) {
+            StatDesc stat;
+            stat.id = get<uint32_t>();
+            stat.kind = get<uint8_t>();
+            stat.flags = get<uint16_t>();
+            stat.precision = get<int32_t>();
+            stat.prereq = get<int32_t>();
+            stat.name = string();
+            stat.desc = string();
+            switch (stat.kind) {
+              case Binary::VectorKind:
+              case Binary::FormulaKind:
+                stat.subnames = strings();
+                stat.subdescs = strings();
+                if (stat.kind == Binary::FormulaKind)
+                    stat.formula = string();
+                break;
+              case Binary::DistKind:
+                stat.distType = get<uint8_t>();
+                break;
+              case Binary::VectorDistKind:
+                stat.distType = get<uint8_t>();
+                stat.size = get<uint32_t>();
+                stat.subnames = strings();
+                stat.subdescs = strings();
+                break;
+              case Binary::Vector2dKind:
+                stat.x = get<uint32_t>();
+                stat.y = get<uint32_t>();
+                stat.subnames = strings();
+                stat.subdescs = strings();
+                stat.ySubnames = strings();
+                break;
+            }
+            EXPECT_EQ(stats.count(stat.id), 0) << "described twice";
+            stats[stat.id] = stat;
+        }
+    }
+
+    void
+    layout()
+    {
+        EXPECT_EQ(get<uint32_t>(), layouts.size());
+        uint32_t count = get<uint32_t>();
+        std::vector<std::pair<uint32_t, uint32_t>> columns(count);
+        for (auto &column : columns)
+            column.first = get<uint32_t>();
+        for (auto &column : columns)
+            column.second = get<uint32_t>();
+        layouts.push_back(columns);
+    }
+
+    void
+    dump()
+    {
+        Dump dump;
+        dump.layout = get<uint32_t>();
+        EXPECT_LT(dump.layout, layouts.size());
+        dump.desc = string();
+        std::vector<double> values(get<uint32_t>());
+        for (auto &value : values)
+            value = get<double>();
+
+        size_t offset = 0;
+        for (const auto &column : layouts[dump.layout]) {
+            EXPECT_EQ(stats.count(column.first), 1) << "undescribed stat";
+            dump.values[stats[column.first].name].assign(
+                values.begin() + offset,
+                values.begin() + offset + column.second);
+            offset += column.second;
+        }
+        EXPECT_EQ(offset, values.size());
+
+        for (uint32_t count = get<uint32_t>(); count; --count) {
+            uint32_t id = get<uint32_t>();
+            std::vector<double> &sparse = dump.sparse[stats[id].name];
+            sparse.push_back(get<double>());
+            for (uint32_t buckets = get<uint32_t>(); buckets; --buckets) {
+                sparse.push_back(get<double>());
+                sparse.push_back(get<double>());
+            }
+        }
+        dumps.push_back(dump);
+    }
+};
+
+/**
+ * Stats are registered and enabled for the rest of the program, so the
+ * tests share one set of them.
+ */
+struct TestStats
+{
+    Scalar scalar;
+    Scalar hidden;
+    Vector vector;
+    Vector2d vector2d;
+    Distribution dist;
+    Histogram hist;
+    StandardDeviation stdev;
+    VectorDistribution vdist;
+    SparseHistogram sparse;
+    Formula formula;
+
+    TestStats()
+    {
+        scalar.name("test.scalar").desc("scalar").precision(2);
+        hidden.name("test.hidden").desc("hidden");
+        vector.init(3).name("test.vector").desc("vector")
+            .subname(0, "a").subdesc(0, "first");
+        vector2d.init(2, 3).name("test.vector2d").desc("vector2d");
+        dist.init(0, 9, 2).name("test.dist").desc("dist");
+        hist.init(4).name("test.hist").desc("hist");
+        stdev.name("test.stdev").desc("stdev");
+        vdist.init(2, 0, 3, 1).name("test.vdist").desc("vdist");
+        sparse.init(0).name("test.sparse").desc("sparse");
+        formula.name("test.formula").desc("formula").prereq(scalar);
+        formula = scalar * 2;
+
+        // Stats without the display flag aren't written
+        for (Info *info : statsList()) {
+            if (info->name == "test.hidden")
+                info->flags.clear(display);
+        }
+        enable();
+    }
+
+    /** Prepare the stats and visit them with an output */
+    void
+    dump(Output &output, const std::string &desc,
+         const std::vector<Info *> &infos = orderedStats())
+    {
+        output.begin(desc);
+        for (Info *info : infos) {
+            info->prepare();
+            info->visit(output);
+        }
+        output.end();
+    }
+};
+
+TestStats &
+testStats()
+{
+    static TestStats *stats = new TestStats;
+    for (Info *info : orderedStats())
+        info->reset();
+    return *stats;
+}
+
+} // anonymous namespace
+
+TEST(BinaryStatsTest, Descriptions)
+{
+    TestStats &stats = testStats();
+    std::ostringstream stream;
+    Binary binary(stream);
+    stats.dump(binary, "first");
+    stats.dump(binary, "second");
+
+    std::string data = stream.str();
+    Decoder decoder(data);
+
+    // Every displayed stat is described once, the hidden one not at all
+    std::map<std::string, StatDesc> by_name;
+    for (const auto &stat : decoder.stats)
+        by_name[stat.second.name] = stat.second;
+    EXPECT_EQ(by_name.size(), orderedStats().size() - 1);
+    EXPECT_EQ(by_name.count("test.hidden"), 0);
+
+    const StatDesc &scalar = by_name["test.scalar"];
+    EXPECT_EQ(scalar.kind, Binary::ScalarKind);
+    EXPECT_EQ(scalar.desc, "scalar");
+    EXPECT_EQ(scalar.precision, 2);
+    EXPECT_EQ(scalar.prereq, -1);
+
+    const StatDesc &vector = by_name["test.vector"];
+    EXPECT_EQ(vector.kind, Binary::VectorKind);
+    ASSERT_GE(vector.subnames.size(), 1);
+    EXPECT_EQ(vector.subnames[0], "a");
+    EXPECT_EQ(vector.subdescs[0], "first");
+
+    const StatDesc &vector2d = by_name["test.vector2d"];
+    EXPECT_EQ(vector2d.kind, Binary::Vector2dKind);
+    EXPECT_EQ(vector2d.x, 2);
+    EXPECT_EQ(vector2d.y, 3);
+
+    EXPECT_EQ(by_name["test.dist"].distType, Dist);
+    EXPECT_EQ(by_name["test.hist"].distType, Hist);
+    EXPECT_EQ(by_name["test.stdev"].distType, Deviation);
+
+    const StatDesc &vdist = by_name["test.vdist"];
+    EXPECT_EQ(vdist.kind, Binary::VectorDistKind);
+    EXPECT_EQ(vdist.size, 2);
+
+    EXPECT_EQ(by_name["test.sparse"].kind, Binary::SparseHistKind);
+
+    const StatDesc &formula = by_name["test.formula"];
+    EXPECT_EQ(formula.kind, Binary::FormulaKind);
+    EXPECT_EQ(formula.prereq, (int32_t)scalar.id);
+    EXPECT_FALSE(formula.formula.empty());
+
+    // The layout is only written once
+    EXPECT_EQ(decoder.layouts.size(), 1);
+    ASSERT_EQ(decoder.dumps.size(), 2);
+    EXPECT_EQ(decoder.dumps[0].desc, "first");
+    EXPECT_EQ(decoder.dumps[1].desc, "second");
+}
+
+TEST(BinaryStatsTest, Values)
+{
+    TestStats &stats = testStats();
+    std::ostringstream stream;
+    Binary binary(stream);
+
+    const int num_dumps = 4;
+    for (int i = 0; i < num_dumps; ++i) {
+        stats.scalar += 3;
+        stats.vector[i % 3] += i + 1;
+        stats.vector2d[1][2] += i;
+        stats.dist.sample(i * 3);
+        stats.hist.sample(i);
+        stats.stdev.sample(i);
+        stats.vdist[1].sample(i);
+        stats.sparse.sample(i % 2);
+        stats.dump(binary, "dump " + std::to_string(i));
+    }
+
+    std::string data = stream.str();
+    Decoder decoder(data);
+    ASSERT_EQ(decoder.dumps.size(), num_dumps);
+
+    for (int i = 0; i < num_dumps; ++i) {
+        const Dump &dump = decoder.dumps[i];
+        EXPECT_EQ(dump.desc, "dump " + std::to_string(i));
+        auto values = dump.values;
+
+        EXPECT_EQ(values["test.scalar"], std::vector<double>{ 3.0 * (i + 1) });
+        EXPECT_EQ(values["test.formula"],
+                  std::vector<double>({ 6.0 * (i + 1), 6.0 * (i + 1) }));
+
+        std::vector<double> vector(4, 0);
+        for (int j = 0; j <= i; ++j)
+            vector[j % 3] += j + 1;
+        vector[3] = vector[0] + vector[1] + vector[2];
+        EXPECT_EQ(values["test.vector"], vector);
+
+        std::vector<double> vector2d(7, 0);
+        vector2d[5] = vector2d[6] = i * (i + 1) / 2;
+        EXPECT_EQ(values["test.vector2d"], vector2d);
+
+        // Samples 0, 3, ..., 3i in buckets of 2 from 0 to 9
+        const std::vector<double> &dist = values["test.dist"];
+        ASSERT_EQ(dist.size(), Binary::distFields + 5);
+        EXPECT_EQ(dist[Binary::Samples], i + 1);
+        EXPECT_EQ(dist[Binary::Sum], 3.0 * i * (i + 1) / 2);
+        EXPECT_EQ(dist[Binary::Min], 0);
+        EXPECT_EQ(dist[Binary::Max], 9);
+        EXPECT_EQ(dist[Binary::BucketSize], 2);
+        EXPECT_EQ(dist[Binary::MinVal], 0);
+        EXPECT_EQ(dist[Binary::MaxVal], 3 * i);
+        EXPECT_EQ(dist[Binary::Underflow], 0);
+        EXPECT_EQ(dist[Binary::Overflow], 0);
+        EXPECT_TRUE(std::isnan(dist[Binary::Logs]));
+        std::vector<double> buckets(5, 0);
+        for (int j = 0; j <= i; ++j)
+            buckets[j * 3 / 2]++;
+        EXPECT_EQ(std::vector<double>(dist.begin() + Binary::distFields,
+                                      dist.end()), buckets);
+
+        const std::vector<double> &hist = values["test.hist"];
+        ASSERT_EQ(hist.size(), Binary::distFields + 4);
+        EXPECT_EQ(hist[Binary::Samples], i + 1);
+        EXPECT_FALSE(std::isnan(hist[Binary::Logs]));
+        EXPECT_TRUE(std::isnan(hist[Binary::Underflow]));
+
+        // Standard deviations have no buckets
+        const std::vector<double> &stdev = values["test.stdev"];
+        ASSERT_EQ(stdev.size(), Binary::distFields);
+        EXPECT_EQ(stdev[Binary::Samples], i + 1);
+        EXPECT_EQ(stdev[Binary::Sum], i * (i + 1) / 2);
+        EXPECT_TRUE(std::isnan(stdev[Binary::Min]));
+
+        // One distribution after the other
+        const std::vector<double> &vdist = values["test.vdist"];
+        ASSERT_EQ(vdist.size(), 2 * (Binary::distFields + 4));
+        EXPECT_EQ(vdist[Binary::Samples], 0);
+        EXPECT_EQ(vdist[Binary::distFields + 4 + Binary::Samples], i + 1);
+
+        std::vector<double> sparse = { double(i + 1) };
+        sparse.insert(sparse.end(), { 0, double(i / 2 + 1) });
+        if (i > 0)
+            sparse.insert(sparse.end(), { 1, double((i + 1) / 2) });
+        EXPECT_EQ(dump.sparse.at("test.sparse"), sparse);
+    }
+}
+
+/** A new layout is written when the dumped stats change, and only then */
+TEST(BinaryStatsTest, Layouts)
+{
+    TestStats &stats = testStats();
+    std::ostringstream stream;
+    Binary binary(stream);
+
+    std::vector<Info *> some;
+    for (Info *info : orderedStats()) {
+        if (info->name == "test.scalar" || info->name == "test.vector")
+            some.push_back(info);
+    }
+
+    stats.scalar = 1;
+    stats.dump(binary, "some", some);
+    stats.scalar = 2;
+    stats.dump(binary, "some again", some);
+    stats.scalar = 3;
+    stats.dump(binary, "all");
+    stats.scalar = 4;
+    stats.dump(binary, "some at last", some);
+
+    std::string data = stream.str();
+    Decoder decoder(data);
+    ASSERT_EQ(decoder.dumps.size(), 4);
+    EXPECT_EQ(decoder.layouts.size(), 3);
+    EXPECT_EQ(decoder.dumps[0].layout, 0);
+    EXPECT_EQ(decoder.dumps[1].layout, 0);
+    EXPECT_EQ(decoder.dumps[2].layout, 1);
+    EXPECT_EQ(decoder.dumps[3].layout, 2);
+    EXPECT_EQ(decoder.layouts[0], decoder.layouts[2]);
+
+    EXPECT_EQ(decoder.dumps[0].values.size(), 2);
+    EXPECT_EQ(decoder.dumps[2].values.size(), decoder.stats.size() - 1);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(decoder.dumps[i].values.at("test.scalar"),
+                  std::vector<double>{ i + 1.0 });
+    }
+}
@@ -128,6 +128,12 @@ class Info
      */
     virtual bool zero() const = 0;
 
+    /**
+     * @return true if every change to this stat's value is recorded in
+     * the changed stats list (see Stats::takeChangedStats())
+     */
+    virtual bool tracked() const { return false; }
+
     /**
      * Visitor entry for outputing statistics data
      */
@@ -0,0 +1,500 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Asynchronous stats dumps.
+ */
+
+#include "base/stats/snapshot.hh"
+
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "base/stats/info.hh"
+#include "base/stats/output.hh"
+
+namespace Stats {
+
+namespace {
+
+/** The value of one stat at the time of a dump */
+class StatSnapshot
+{
+  public:
+    virtual ~StatSnapshot() {}
+
+    /** Copy the current value of the stat */
+    virtual void take() = 0;
+
+    /** The snapshot as an Info of the same kind as the stat */
+    virtual Info &info() = 0;
+};
+
+/**
+ * Common part of the snapshots of all kinds of stats. The description
+ * of the stat is copied once, its value by every take().
+ */
+template <class Base>
+class SnapshotBase : public Base, public StatSnapshot
+{
+  protected:
+    const Base &src;
+    bool isZero;
+
+    void
+    takeBase()
+    {
+        isZero = src.zero();
+    }
+
+  public:
+    SnapshotBase(const Base &src)
+        : src(src), isZero(true)
+    {
+        this->name = src.name;
+        this->desc = src.desc;
+        this->flags = src.flags;
+        this->precision = src.precision;
+        this->id = src.id;
+        this->storageParams = src.storageParams;
+        // Set to the snapshot of the prerequisite by SnapshotSet::take()
+        this->prereq = nullptr;
+    }
+
+    Info &info() override { return *this; }
+
+    bool check() const override { return true; }
+    void prepare() override { }
+    void reset() override { }
+    bool zero() const override { return isZero; }
+
+    void
+    visit(Output &visitor) override
+    {
+        visitor.visit(*static_cast<Base *>(this));
+    }
+};
+
+class ScalarSnapshot : public SnapshotBase<ScalarInfo>
+{
+  private:
+    Counter _value;
+    Result _result;
+    Result _total;
+
+  public:
+    ScalarSnapshot(const ScalarInfo &src)
+        : SnapshotBase<ScalarInfo>(src), _value(0), _result(0), _total(0)
+    { }
+
+    void
+    take() override
+    {
+        takeBase();
+        _value = src.value();
+        _result = src.result();
+        _total = src.total();
+    }
+
+    Counter value() const override { return _value; }
+    Result result() const override { return _result; }
+    Result total() const override { return _total; }
+};
+
+/** Snapshot of a vector or a formula */
+template <class Base>
+class VectorSnapshot : public SnapshotBase<Base>
+{
+  private:
+    size_type _size;
+    VCounter _value;
+    VResult _result;
+    Result _total;
+
+  public:
+    VectorSnapshot(const Base &src)
+        : SnapshotBase<Base>(src), _size(0), _total(0)
+    {
+        this->subnames = src.subnames;
+        this->subdescs = src.subdescs;
+    }
+
+    void
+    take() override
+    {
+        this->takeBase();
+        _size = this->src.size();
+        _value = this->src.value();
+        _result = this->src.result();
+        _total = this->src.total();
+    }
+
+    size_type size() const override { return _size; }
+    const VCounter &value() const override { return _value; }
+    const VResult &result() const override { return _result; }
+    Result total() const override { return _total; }
+};
+
+class FormulaSnapshot : public VectorSnapshot<FormulaInfo>
+{
+  private:
+    std::string formula;
+
+  public:
+    FormulaSnapshot(const FormulaInfo &src)
+        : VectorSnapshot<FormulaInfo>(src), formula(src.str())
+    { }
+
+    std::string str() const override { return formula; }
+};
+
+class DistSnapshot : public SnapshotBase<DistInfo>
+{
+  public:
+    DistSnapshot(const DistInfo &src) : SnapshotBase<DistInfo>(src) { }
+
+    void
+    take() override
+    {
+        takeBase();
+        data = src.data;
+    }
+};
+
+class VectorDistSnapshot : public SnapshotBase<VectorDistInfo>
+{
+  public:
+    VectorDistSnapshot(const VectorDistInfo &src)
+        : SnapshotBase<VectorDistInfo>(src)
+    {
+        subnames = src.subnames;
+        subdescs = src.subdescs;
+    }
+
+    void
+    take() override
+    {
+        takeBase();
+        data = src.data;
+    }
+
+    size_type size() const override { return data.size(); }
+};
+
+class Vector2dSnapshot : public SnapshotBase<Vector2dInfo>
+{
+  private:
+    Result _total;
+
+  public:
+    Vector2dSnapshot(const Vector2dInfo &src)
+        : SnapshotBase<Vector2dInfo>(src), _total(0)
+    {
+        subnames = src.subnames;
+        subdescs = src.subdescs;
+        y_subnames = src.y_subnames;
+    }
+
+    void
+    take() override
+    {
+        takeBase();
+        x = src.x;
+        y = src.y;
+        cvec = src.cvec;
+        _total = src.total();
+    }
+
+    Result total() const override { return _total; }
+};
+
+class SparseHistSnapshot : public SnapshotBase<SparseHistInfo>
+{
+  public:
+    SparseHistSnapshot(const SparseHistInfo &src)
+        : SnapshotBase<SparseHistInfo>(src)
+    { }
+
+    void
+    take() override
+    {
+        takeBase();
+        data = src.data;
+    }
+};
+
+/** Creates the snapshot matching the kind of a stat */
+struct SnapshotFactory : public Output
+{
+    std::unique_ptr<StatSnapshot> snapshot;
+
+    void begin(std::string desc) override { }
+    void end() override { }
+    bool valid() const override { return true; }
+
+    void
+    visit(const ScalarInfo &info) override
+    {
+        snapshot.reset(new ScalarSnapshot(info));
+    }
+
+    void
+    visit(const VectorInfo &info) override
+    {
+        snapshot.reset(new VectorSnapshot<VectorInfo>(info));
+    }
+
+    void
+    visit(const DistInfo &info) override
+    {
+        snapshot.reset(new DistSnapshot(info));
+    }
+
+    void
+    visit(const VectorDistInfo &info) override
+    {
+        snapshot.reset(new VectorDistSnapshot(info));
+    }
+
+    void
+    visit(const Vector2dInfo &info) override
+    {
+        snapshot.reset(new Vector2dSnapshot(info));
+    }
+
+    void
+    visit(const FormulaInfo &info) override
+    {
+        snapshot.reset(new FormulaSnapshot(info));
+    }
+
+    void
+    visit(const SparseHistInfo &info) override
+    {
+        snapshot.reset(new SparseHistSnapshot(info));
+    }
+};
+
+/**
+ * One dump: the snapshots of the dumped stats and where to write them.
+ * Sets are reused, so the snapshot of each stat is only created once.
+ */
+class SnapshotSet
+{
+  private:
+    /** Snapshots by stat ID */
+    std::vector<std::unique_ptr<StatSnapshot>> snapshots;
+
+    /** The dumped stats, in dump order */
+    std::vector<Info *> stats;
+
+    std::vector<Output *> outputs;
+    std::string desc;
+
+    StatSnapshot &
+    snapshot(Info &info)
+    {
+        if (info.id >= snapshots.size())
+            snapshots.resize(info.id + 1);
+
+        auto &snap = snapshots[info.id];
+        if (!snap) {
+            SnapshotFactory factory;
+            info.visit(factory);
+            snap = std::move(factory.snapshot);
+        }
+        return *snap;
+    }
+
+  public:
+    void
+    take(const std::vector<Output *> &_outputs,
+         const std::vector<Info *> &_stats, const std::string &_desc)
+    {
+        outputs = _outputs;
+        desc = _desc;
+
+        stats.clear();
+        stats.reserve(_stats.size());
+        for (auto *info : _stats) {
+            StatSnapshot &snap = snapshot(*info);
+            snap.take();
+
+            // The prerequisite isn't necessarily part of the dump, but
+            // the outputs need to know whether it was zero
+            Info &snap_info = snap.info();
+            if (info->prereq) {
+                Info *prereq = const_cast<Info *>(info->prereq);
+                StatSnapshot &prereq_snap = snapshot(*prereq);
+                prereq_snap.take();
+                snap_info.prereq = &prereq_snap.info();
+            }
+            stats.push_back(&snap_info);
+        }
+    }
+
+    void
+    write()
+    {
+        for (auto *output : outputs) {
+            output->begin(desc);
+            for (auto *info : stats)
+                info->visit(*output);
+            output->end();
+        }
+    }
+};
+
+class AsyncDumper
+{
+  private:
+    /**
+     * Number of dumps that can be outstanding before dumpAsync() waits
+     * for the writer, which bounds the memory used by snapshots.
+     */
+    static const size_t maxPending = 2;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+
+    /** Dumps to write, the first one is being written */
+    std::deque<std::unique_ptr<SnapshotSet>> pending;
+
+    /** Written sets for reuse */
+    std::vector<std::unique_ptr<SnapshotSet>> spare;
+
+    bool stopping;
+    std::thread writer;
+
+    void
+    writerLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cond.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (pending.empty())
+                return;
+
+            SnapshotSet *set = pending.front().get();
+            lock.unlock();
+            set->write();
+            lock.lock();
+
+            spare.push_back(std::move(pending.front()));
+            pending.pop_front();
+            cond.notify_all();
+        }
+    }
+
+  public:
+    AsyncDumper()
+        : stopping(false)
+    {
+        writer = std::thread(&AsyncDumper::writerLoop, this);
+    }
+
+    ~AsyncDumper()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cond.notify_all();
+        writer.join();
+    }
+
+    void
+    dump(const std::vector<Output *> &outputs,
+         const std::vector<Info *> &stats, const std::string &desc)
+    {
+        std::unique_ptr<SnapshotSet> set;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [this] { return pending.size() < maxPending; });
+            if (!spare.empty()) {
+                set = std::move(spare.back());
+                spare.pop_back();
+            }
+        }
+
+        if (!set)
+            set.reset(new SnapshotSet);
+        set->take(outputs, stats, desc);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.push_back(std::move(set));
+        }
+        cond.notify_all();
+    }
+
+    void
+    drain()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [this] { return pending.empty(); });
+    }
+};
+
+std::unique_ptr<AsyncDumper> dumper;
+
+} // anonymous namespace
+
+void
+dumpAsync(const std::vector<Output *> &outputs,
+          const std::vector<Info *> &stats, const std::string &desc)
+{
+    static bool registered = false;
+    if (!registered) {
+        // Write outstanding dumps before the outputs are destroyed
+        std::atexit(stopAsyncDumps);
+        registered = true;
+    }
+    if (!dumper)
+        dumper.reset(new AsyncDumper);
+    dumper->dump(outputs, stats, desc);
+}
+
+void
+drainAsyncDumps()
+{
+    if (dumper)
+        dumper->drain();
+}
+
+void
+stopAsyncDumps()
+{
+    dumper.reset();
+}
+
+} // namespace Stats
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Asynchronous stats dumps.
+ *
+ * dumpAsync() copies the values of a set of stats into snapshot Info
+ * objects, which mirror the live stats but hold the values from the time
+ * of the dump, and passes them to the outputs on a background thread.
+ * The outputs see the same values as in a synchronous dump, so their
+ * output is identical, while the simulation continues.
+ *
+ * An Output must not be used synchronously while asynchronous dumps to
+ * it are outstanding; call drainAsyncDumps() first.
+ */
+
+#ifndef __BASE_STATS_SNAPSHOT_HH__
+#define __BASE_STATS_SNAPSHOT_HH__
+
+#include <string>
+#include <vector>
+
+namespace Stats {
+
+class Info;
+struct Output;
+
+/**
+ * Dump stats to a set of outputs from a background thread.
+ *
+ * @param outputs Outputs to visit the stats with, after begin(desc).
+ * @param stats Prepared stats, in dump order.
+ * @param desc Description of the dump.
+ */
+void dumpAsync(const std::vector<Output *> &outputs,
+               const std::vector<Info *> &stats, const std::string &desc);
+
+/** Wait until all asynchronous dumps have been written. */
+void drainAsyncDumps();
+
+/**
+ * Write all asynchronous dumps and stop the background thread; the next
+ * dump starts a new one. Call this before forking the simulator: the
+ * thread wouldn't exist in the child, which could neither use nor
+ * destroy the dumper it inherited.
+ */
+void stopAsyncDumps();
+
+} // namespace Stats
+
+#endif // __BASE_STATS_SNAPSHOT_HH__
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/stats/snapshot.hh"
+#include "base/stats/text.hh"
+
+using namespace Stats;
+
+namespace {
+
+/**
+ * Stats are registered and enabled for the rest of the program, so the
+ * tests share one set of them.
+ */
+struct TestStats
+{
+    Scalar scalar;
+    Scalar unused;
+    Vector vector;
+    Vector2d vector2d;
+    Distribution dist;
+    Histogram hist;
+    VectorDistribution vdist;
+    SparseHistogram sparse;
+    Formula formula;
+
+    TestStats()
+    {
+        scalar.name("test.scalar").desc("scalar");
+        unused.name("test.unused").desc("never updated").flags(nozero);
+        vector.init(3).name("test.vector").desc("vector")
+            .subname(0, "zero").subname(1, "one").subname(2, "two")
+            .subdesc(0, "zeroth").subdesc(1, "first").subdesc(2, "second")
+            .flags(total | pdf | cdf);
+        static const char *ysubnames[] = { "a", "b" };
+        vector2d.init(2, 2).name("test.vector2d").desc("vector2d")
+            .ysubnames(ysubnames);
+        dist.init(0, 15, 2).name("test.dist").desc("dist")
+            .flags(pdf | cdf);
+        hist.init(8).name("test.hist").desc("hist");
+        vdist.init(2, 0, 7, 1).name("test.vdist").desc("vdist")
+            .subname(0, "even").subname(1, "odd")
+            .subdesc(0, "even steps").subdesc(1, "odd steps");
+        sparse.init(0).name("test.sparse").desc("sparse");
+        formula.name("test.formula").desc("formula").precision(3);
+        formula = scalar / (vector + 1);
+        enable();
+    }
+
+    void
+    update(int step)
+    {
+        scalar += step * 3 + 1;
+        vector[step % 3] += step;
+        vector2d[step % 2][(step / 2) % 2]++;
+        dist.sample(step % 19);
+        hist.sample(step * 7);
+        vdist[step % 2].sample(step % 8);
+        sparse.sample(step % 5);
+    }
+
+    /** Prepare all stats for a dump, as m5.stats.dump() does */
+    const std::vector<Info *> &
+    prepare()
+    {
+        for (Info *info : orderedStats())
+            info->prepare();
+        return orderedStats();
+    }
+};
+
+TestStats &
+testStats()
+{
+    static TestStats *stats = new TestStats;
+    return *stats;
+}
+
+/** A synchronous dump to a text output */
+std::string
+dumpSync(const std::vector<Info *> &stats, const std::string &desc)
+{
+    std::ostringstream stream;
+    Text text(stream);
+    text.begin(desc);
+    for (Info *info : stats)
+        info->visit(text);
+    text.end();
+    return stream.str();
+}
+
+} // anonymous namespace
+
+/**
+ * An asynchronous dump writes exactly what a synchronous dump of the
+ * same stats writes, even if the stats change before it is written.
+ */
+TEST(AsyncDumpTest, MatchesSyncDump)
+{
+    TestStats &stats = testStats();
+
+    const int num_dumps = 8;
+    std::vector<std::string> expected;
+    std::ostringstream streams[num_dumps];
+    std::vector<Text *> outputs;
+
+    for (int i = 0; i < num_dumps; ++i) {
+        stats.update(i);
+        const std::vector<Info *> &infos = stats.prepare();
+        std::string desc = "dump " + std::to_string(i);
+        expected.push_back(dumpSync(infos, desc));
+
+        outputs.push_back(new Text(streams[i]));
+        dumpAsync({ outputs.back() }, infos, desc);
+    }
+    drainAsyncDumps();
+
+    for (int i = 0; i < num_dumps; ++i) {
+        EXPECT_NE(expected[i].find("test.formula"), std::string::npos);
+        EXPECT_EQ(streams[i].str(), expected[i]) << "dump " << i;
+        delete outputs[i];
+    }
+}
+
+/** Several dumps to the same output are written in order. */
+TEST(AsyncDumpTest, SameOutput)
+{
+    TestStats &stats = testStats();
+
+    std::string expected;
+    std::ostringstream stream;
+    Text text(stream);
+
+    for (int i = 0; i < 5; ++i) {
+        stats.update(i + 100);
+        const std::vector<Info *> &infos = stats.prepare();
+        expected += dumpSync(infos, "");
+        dumpAsync({ &text }, infos, "");
+    }
+    drainAsyncDumps();
+    EXPECT_EQ(stream.str(), expected);
+}
+
+/** Dumps can continue after the background thread has been stopped. */
+TEST(AsyncDumpTest, Restart)
+{
+    TestStats &stats = testStats();
+
+    for (int i = 0; i < 3; ++i) {
+        std::ostringstream stream;
+        Text text(stream);
+        stats.update(i + 200);
+        const std::vector<Info *> &infos = stats.prepare();
+        std::string expected = dumpSync(infos, "restart");
+        dumpAsync({ &text }, infos, "restart");
+        stopAsyncDumps();
+        EXPECT_EQ(stream.str(), expected);
+    }
+}
@@ -1,8 +1,6 @@
-#include <cstring>
 #include <iosfwd>
 #include <iostream>
 #include <string>
-#include <sstream>
 
 #include "base/logging.hh"
 #include "base/stats/info.hh"
@@ -16,26 +14,48 @@
 
 namespace Stats {
 
-OutputSQL::OutputSQL() : db(nullptr), tables_created(false), dump_count(0) {}
+namespace {
 
-OutputSQL::OutputSQL(const std::string &filename)
-    : tables_created(false), dump_count(0) {
-  open(filename);
+// Binds a packed array, which is only read by the following step().
+void bind_blob(sqlite3_stmt *stmt, int param, const void *blob,
+               unsigned nbytes) {
+  if (nbytes)
+    sqlite3_bind_blob(stmt, param, blob, nbytes, SQLITE_STATIC);
+  else
+    sqlite3_bind_zeroblob(stmt, param, 0);
+}
+
+// Binds a string, or NULL if it is empty.
+void bind_text(sqlite3_stmt *stmt, int param, const std::string &text) {
+  if (text.empty())
+    sqlite3_bind_null(stmt, param);
+  else
+    sqlite3_bind_text(stmt, param, text.data(), text.size(), SQLITE_STATIC);
+}
+
+}  // anonymous namespace
+
+OutputSQL::OutputSQL()
+    : db(nullptr), insert_stat_stmt(nullptr), insert_scalar_stmt(nullptr),
+      insert_vector_stmt(nullptr), insert_dist_stmt(nullptr),
+      insert_dump_desc_stmt(nullptr), tables_created(false),
+      defer_indexes(false), dump_count(0), rows_written(0) {}
+
+OutputSQL::OutputSQL(const std::string &filename, bool defer_indexes)
+    : OutputSQL() {
+  open(filename, defer_indexes);
 }
 
 OutputSQL::~OutputSQL() {
-  if (db) {
-    int close_ret = sqlite3_close(db);
-    if (close_ret != SQLITE_OK)
-      print_errmsg(close_ret);
-    db = nullptr;
-  }
+  close();
 }
 
-void OutputSQL::open(const std::string &filename) {
+void OutputSQL::open(const std::string &filename, bool _defer_indexes) {
   if (db)
     panic("Database has already been opened!\n");
 
+  defer_indexes = _defer_indexes;
+
   int ret = sqlite3_open(filename.c_str(), &db);
   if (ret != SQLITE_OK) {
     print_errmsg(ret);
@@ -44,13 +64,59 @@ void OutputSQL::open(const std::string &filename) {
       print_errmsg(ret);
     db = nullptr;
   } else {
-    tables_created = create_tables();
+    // Write-ahead logging avoids rewriting the database file for every
+    // transaction, and with it, syncing at checkpoints is enough.
+    exec_sql("pragma journal_mode=WAL;");
+    exec_sql("pragma synchronous=NORMAL;");
+    tables_created = create_tables() &&
+                     (defer_indexes || create_indexes()) &&
+                     prepare_statements();
   }
 
   if (!valid())
     fatal("Unable to write to the statistics database\n");
 }
 
+void OutputSQL::close() {
+  if (!db)
+    return;
+
+  sqlite3_stmt *stmts[] = {
+    insert_stat_stmt, insert_scalar_stmt, insert_vector_stmt,
+    insert_dist_stmt, insert_dump_desc_stmt
+  };
+  for (sqlite3_stmt *stmt : stmts)
+    sqlite3_finalize(stmt);
+  insert_stat_stmt = nullptr;
+  insert_scalar_stmt = nullptr;
+  insert_vector_stmt = nullptr;
+  insert_dist_stmt = nullptr;
+  insert_dump_desc_stmt = nullptr;
+
+  if (tables_created && defer_indexes)
+    create_indexes();
+  tables_created = false;
+
+  int close_ret = sqlite3_close(db);
+  if (close_ret != SQLITE_OK)
+    print_errmsg(close_ret);
+  db = nullptr;
+}
+
+void OutputSQL::reopen(const std::string &filename) {
+  db = nullptr;
+  insert_stat_stmt = nullptr;
+  insert_scalar_stmt = nullptr;
+  insert_vector_stmt = nullptr;
+  insert_dist_stmt = nullptr;
+  insert_dump_desc_stmt = nullptr;
+  tables_created = false;
+  described.clear();
+  dump_count = 0;
+  rows_written = 0;
+  open(filename, defer_indexes);
+}
+
 int OutputSQL::exec_sql(const std::string& sql_cmd) {
   char* errmsg;
   int ret = sqlite3_exec(db, sql_cmd.c_str(), nullptr, nullptr, &errmsg);
@@ -61,6 +127,29 @@ int OutputSQL::exec_sql(const std::string& sql_cmd) {
   return ret;
 }
 
+sqlite3_stmt *OutputSQL::prepare(const std::string &sql) {
+  sqlite3_stmt *stmt = nullptr;
+  int ret = sqlite3_prepare_v2(db, sql.c_str(), sql.size(), &stmt, nullptr);
+  if (ret != SQLITE_OK) {
+    print_errmsg(ret);
+    sqlite3_finalize(stmt);
+    return nullptr;
+  }
+  return stmt;
+}
+
+int OutputSQL::step(sqlite3_stmt *stmt) {
+  int ret = sqlite3_step(stmt);
+  if (ret != SQLITE_DONE)
+    print_errmsg(ret);
+  else
+    rows_written++;
+  sqlite3_reset(stmt);
+  // Unbound parameters have to be NULL for the next insert.
+  sqlite3_clear_bindings(stmt);
+  return ret;
+}
+
 bool OutputSQL::valid() const {
   return (db != nullptr && tables_created);
 }
@@ -92,21 +181,21 @@ bool OutputSQL::create_tables() {
           "type text,"
           "formula text);";
 
+  // The (id, dump) keys of the value tables are unique indexes, rather
+  // than primary keys, so that they can be created after the inserts.
   std::string scalar_value_sql =
       "drop table if exists scalarValue;"
       "create table scalarValue ("
           "id int,"
           "dump int,"
-          "value real,"
-          "primary key (id, dump));";
+          "value real);";
 
   std::string vector_value_sql =
       "drop table if exists vectorValue;"
       "create table vectorValue ("
           "id int,"
           "dump int,"
-          "value blob,"
-          "primary key (id, dump));";
+          "value blob);";
 
   std::string dist_value_sql =
       "drop table if exists distValue;"
@@ -123,8 +212,7 @@ bool OutputSQL::create_tables() {
           "min_val real,"
           "max_val real,"
           "underflow real,"
-          "overflow real,"
-          "primary key (id, dump));";
+          "overflow real);";
 
   std::string dump_desc_sql =
       "drop table if exists dumpDesc;"
@@ -150,17 +238,46 @@ bool OutputSQL::create_tables() {
   }
 }
 
+bool OutputSQL::create_indexes() {
+  std::string index_sql =
+      "create unique index if not exists scalarValueKey "
+          "on scalarValue (id, dump);"
+      "create unique index if not exists vectorValueKey "
+          "on vectorValue (id, dump);"
+      "create unique index if not exists distValueKey "
+          "on distValue (id, dump);";
+  return exec_sql(index_sql) == SQLITE_OK;
+}
+
+bool OutputSQL::prepare_statements() {
+  insert_stat_stmt = prepare(
+      "insert into stats (id, name, desc, flags, precision, type, prereq, "
+      "subnames, subdescs, y_subnames, x, y, formula) values "
+      "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);");
+  insert_scalar_stmt = prepare(
+      "insert into scalarValue (id, dump, value) values (?, ?, ?);");
+  insert_vector_stmt = prepare(
+      "insert into vectorValue (id, dump, value) values (?, ?, ?);");
+  // Parameters that the type of distribution doesn't have stay NULL.
+  insert_dist_stmt = prepare(
+      "insert into distValue (id, dump, sum, squares, samples, min, max, "
+      "bucket_size, vector, min_val, max_val, underflow, overflow) values "
+      "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);");
+  insert_dump_desc_stmt = prepare(
+      "insert into dumpDesc (id, desc) values (?, ?);");
+
+  return insert_stat_stmt && insert_scalar_stmt && insert_vector_stmt &&
+         insert_dist_stmt && insert_dump_desc_stmt;
+}
+
 void OutputSQL::begin(std::string desc) {
-  if (exec_sql("begin deferred transaction;") != SQLITE_OK) {
+  if (exec_sql("begin transaction;") != SQLITE_OK) {
     return;
   }
-  std::string dump_desc_sql;
-  dump_desc_sql += "insert into dumpDesc (id, desc) values (";
-  dump_desc_sql += std::to_string(dump_count);
-  dump_desc_sql += ", \"";
-  dump_desc_sql += desc;
-  dump_desc_sql += "\");";
-  exec_sql(dump_desc_sql);
+  sqlite3_bind_int(insert_dump_desc_stmt, 1, dump_count);
+  sqlite3_bind_text(insert_dump_desc_stmt, 2, desc.data(), desc.size(),
+                    SQLITE_TRANSIENT);
+  step(insert_dump_desc_stmt);
 }
 
 void OutputSQL::end() {
@@ -168,111 +285,55 @@ void OutputSQL::end() {
   dump_count++;
 }
 
-int OutputSQL::insert_vector_value(int id, int dump, const unsigned char *blob,
-                                   unsigned nbytes) {
-  std::string sql =
-      "insert into vectorValue (id, dump, value) values (?, ?, ?);";
-  sqlite3_stmt *pstmt;
-  int ret = sqlite3_prepare_v2(db, sql.c_str(), sql.size(), &pstmt, nullptr);
-  if (ret != SQLITE_OK) {
-    print_errmsg(ret);
-    sqlite3_finalize(pstmt);
-    return ret;
-  }
+template <class T>
+void OutputSQL::describe(const T &info) {
+  if (info.id >= described.size())
+    described.resize(info.id + 1);
+  if (described[info.id])
+    return;
+  described[info.id] = true;
 
-  sqlite3_bind_int(pstmt, 1, id);
-  sqlite3_bind_int(pstmt, 2, dump);
-  sqlite3_bind_blob(pstmt, 3, blob, nbytes, SQLITE_TRANSIENT);
+  StatInfo metadata(info);
+  metadata.bind(insert_stat_stmt);
+  step(insert_stat_stmt);
+}
 
-  ret = sqlite3_step(pstmt);
-  if (ret != SQLITE_DONE) {
-    print_errmsg(ret);
-  }
-  ret = sqlite3_finalize(pstmt);
-  return ret;
+int OutputSQL::insert_vector_value(int id, int dump, const void *blob,
+                                   unsigned nbytes) {
+  sqlite3_bind_int(insert_vector_stmt, 1, id);
+  sqlite3_bind_int(insert_vector_stmt, 2, dump);
+  bind_blob(insert_vector_stmt, 3, blob, nbytes);
+  return step(insert_vector_stmt);
 }
 
 void OutputSQL::visit(const ScalarInfo &info) {
   if (no_output(info))
     return;
 
-  if (dump_count == 0) {
-    StatInfo metadata(info);
-    exec_sql(metadata.create_sql_cmd());
-  }
-  std::string sql = "insert into scalarValue (id, dump, value) values (?, ?, ?);";
-  sqlite3_stmt *pstmt;
-  int ret = sqlite3_prepare_v2(db, sql.c_str(), sql.size(), &pstmt, nullptr);
-  if (ret != SQLITE_OK) {
-    print_errmsg(ret);
-    sqlite3_finalize(pstmt);
-    return;
-  }
-  sqlite3_bind_int(pstmt, 1, info.id);
-  sqlite3_bind_int(pstmt, 2, dump_count);
-  sqlite3_bind_double(pstmt, 3, info.value());
-
-  ret = sqlite3_step(pstmt);
-  if (ret != SQLITE_DONE) {
-    print_errmsg(ret);
-  }
-  sqlite3_finalize(pstmt);
+  describe(info);
+  sqlite3_bind_int(insert_scalar_stmt, 1, info.id);
+  sqlite3_bind_int(insert_scalar_stmt, 2, dump_count);
+  sqlite3_bind_double(insert_scalar_stmt, 3, info.value());
+  step(insert_scalar_stmt);
 }
 
 void OutputSQL::visit(const VectorInfo &info) {
   if (no_output(info))
     return;
 
-  if (dump_count == 0) {
-    StatInfo metadata(info);
-    exec_sql(metadata.create_sql_cmd());
-  }
+  describe(info);
   // Store the vector of results as a simple blob - the backing C array itself.
-  //
-  const Result* vresult = info.result().data();
-  unsigned nbytes = info.size() * sizeof(Result);
-  unsigned char* blob = new unsigned char[nbytes];
-  std::memcpy(blob, vresult, nbytes);
-  insert_vector_value(info.id, dump_count, blob, nbytes);
-  delete[] blob;
+  insert_vector_value(info.id, dump_count, info.result().data(),
+                      info.size() * sizeof(Result));
 }
 
 void OutputSQL::visit(const DistInfo &info) {
   if (no_output(info))
     return;
 
-  if (dump_count == 0) {
-    StatInfo metadata(info);
-    exec_sql(metadata.create_sql_cmd());
-  }
-  const Counter* cvec = info.data.cvec.data();
-  unsigned nbytes = info.data.cvec.size() * sizeof(Counter);
-  unsigned char* blob = new unsigned char[nbytes];
-  std::memcpy(blob, cvec, nbytes);
-
-  std::string sql;
-  if (info.data.type == Stats::DistType::Deviation) {
-    sql = "insert into distValue (id, dump, sum, squares, samples) values (?, "
-          "?, ?, ?, ?);";
-  } else if (info.data.type == Stats::DistType::Dist) {
-    sql = "insert into distValue (id, dump, sum, squares, samples, "
-          "min, max, bucket_size, vector) values (?, ?, ?, ?, ?, "
-          "?, ?, ?, ?); ";
-  } else if (info.data.type == Stats::DistType::Hist) {
-    sql = "insert into distValue (id, dump, sum, squares, samples, "
-          "min, max, bucket_size, vector, min_val, max_val, "
-          "underflow, overflow) values (?, ?, ?, ?, ?, ?, ?, ?, ?, "
-          "?, ?, ?, ?); ";
-  }
-
-  sqlite3_stmt *pstmt;
-  int ret = sqlite3_prepare_v2(db, sql.c_str(), sql.size(), &pstmt, nullptr);
-  if (ret != SQLITE_OK) {
-    print_errmsg(ret);
-    sqlite3_finalize(pstmt);
-    return;
-  }
+  describe(info);
 
+  sqlite3_stmt *pstmt = insert_dist_stmt;
   sqlite3_bind_int(pstmt, 1, info.id);
   sqlite3_bind_int(pstmt, 2, dump_count);
   sqlite3_bind_double(pstmt, 3, info.data.sum);
@@ -283,7 +344,8 @@ void OutputSQL::visit(const DistInfo &info) {
     sqlite3_bind_double(pstmt, 6, info.data.min);
     sqlite3_bind_double(pstmt, 7, info.data.max);
     sqlite3_bind_double(pstmt, 8, info.data.bucket_size);
-    sqlite3_bind_blob(pstmt, 9, blob, nbytes, SQLITE_TRANSIENT);
+    bind_blob(pstmt, 9, info.data.cvec.data(),
+              info.data.cvec.size() * sizeof(Counter));
   }
   if (info.data.type == Stats::DistType::Hist) {
     sqlite3_bind_double(pstmt, 10, info.data.min_val);
@@ -291,46 +353,25 @@ void OutputSQL::visit(const DistInfo &info) {
     sqlite3_bind_double(pstmt, 12, info.data.underflow);
     sqlite3_bind_double(pstmt, 13, info.data.overflow);
   }
-
-  ret = sqlite3_step(pstmt);
-  if (ret != SQLITE_DONE) {
-    print_errmsg(ret);
-  }
-  sqlite3_finalize(pstmt);
-
-  delete[] blob;
+  step(pstmt);
 }
 
 void OutputSQL::visit(const Vector2dInfo &info) {
   if (no_output(info))
     return;
 
-  if (dump_count == 0) {
-    StatInfo metadata(info);
-    exec_sql(metadata.create_sql_cmd());
-  }
-  const Counter* cvec = info.cvec.data();
-  unsigned nbytes = info.cvec.size() * sizeof(Counter);
-  unsigned char* blob = new unsigned char[nbytes];
-  std::memcpy(blob, cvec, nbytes);
-  insert_vector_value(info.id, dump_count, blob, nbytes);
-  delete[] blob;
+  describe(info);
+  insert_vector_value(info.id, dump_count, info.cvec.data(),
+                      info.cvec.size() * sizeof(Counter));
 }
 
 void OutputSQL::visit(const FormulaInfo &info) {
   if (no_output(info))
     return;
 
-  if (dump_count == 0) {
-    StatInfo metadata(info);
-    exec_sql(metadata.create_sql_cmd());
-  }
-  const Result* vresult = info.result().data();
-  unsigned nbytes = info.size() * sizeof(Result);
-  unsigned char* blob = new unsigned char[nbytes];
-  std::memcpy(blob, vresult, nbytes);
-  insert_vector_value(info.id, dump_count, blob, nbytes);
-  delete[] blob;
+  describe(info);
+  insert_vector_value(info.id, dump_count, info.result().data(),
+                      info.size() * sizeof(Result));
 }
 
 void OutputSQL::visit(const VectorDistInfo &info) {}
@@ -403,48 +444,60 @@ std::string StatInfo::join(const std::vector<std::string> &array,
   return joined;
 }
 
-std::string StatInfo::create_sql_cmd() {
-  std::stringstream sql_col_creator, sql_val_creator;
-  sql_col_creator << "id, name, desc, flags, precision, type";
-  sql_val_creator << id << ", \""
-                  << name << "\", \""
-                  << desc << "\", "
-                  << flags << ", "
-                  << precision << ", \""
-                  << type << "\"";
-  if (prereq != StatInfo::NO_PREREQ) {
-    sql_col_creator << ", prereq";
-    sql_val_creator << ", " << prereq;
-  }
-  if (!subnames.empty()) {
-    sql_col_creator << ", subnames";
-    sql_val_creator << ", \"" << subnames << "\"";
-  }
-  if (!subdescs.empty()) {
-    sql_col_creator << ", subdescs";
-    sql_val_creator << ", \"" << subdescs << "\"";
-  }
+void StatInfo::bind(sqlite3_stmt *stmt) const {
+  sqlite3_bind_int(stmt, 1, id);
+  sqlite3_bind_text(stmt, 2, name.data(), name.size(), SQLITE_STATIC);
+  sqlite3_bind_text(stmt, 3, desc.data(), desc.size(), SQLITE_STATIC);
+  sqlite3_bind_int(stmt, 4, flags);
+  sqlite3_bind_int(stmt, 5, precision);
+  sqlite3_bind_text(stmt, 6, type.data(), type.size(), SQLITE_STATIC);
+  if (prereq != StatInfo::NO_PREREQ)
+    sqlite3_bind_int(stmt, 7, prereq);
+  bind_text(stmt, 8, subnames);
+  bind_text(stmt, 9, subdescs);
   if (!y_subnames.empty()) {
-    sql_col_creator << ", y_subnames, x, y";
-    sql_val_creator << ", \"" << y_subnames << "\", " << x << ", " << y;
+    bind_text(stmt, 10, y_subnames);
+    sqlite3_bind_int(stmt, 11, x);
+    sqlite3_bind_int(stmt, 12, y);
   }
-
-  std::string final_cmd = "insert into stats (" + sql_col_creator.str() +
-                          ") values (" + sql_val_creator.str() + ");";
-  return final_cmd;
+  bind_text(stmt, 13, formula);
 }
 
-Output *
-initOutputSQL(const std::string &filename) {
+namespace {
+
+OutputSQL &
+sqlOutput() {
   static OutputSQL sql;
-  static bool connected = false;
+  return sql;
+}
 
-  if (!connected) {
-    sql.open(filename);
-    connected = true;  // If it failed, it would have killed the sim.
+bool sqlConnected = false;
+
+}  // anonymous namespace
+
+Output *
+initOutputSQL(const std::string &filename, bool defer_indexes) {
+  if (!sqlConnected) {
+    sqlOutput().open(filename, defer_indexes);
+    sqlConnected = true;  // If it failed, it would have killed the sim.
   }
 
-  return &sql;
+  return &sqlOutput();
+}
+
+Output *
+reopenOutputSQL(const std::string &filename) {
+  if (!sqlConnected)
+    return nullptr;
+
+  sqlOutput().reopen(filename);
+  return &sqlOutput();
+}
+
+void
+closeOutputSQL() {
+  if (sqlConnected)
+    sqlOutput().close();
 }
 
 }  // namespace Stats
@@ -456,10 +509,19 @@ namespace Stats {
 // SQLite3 libraries and headers were not found.
 
 Output *
-initOutputSQL(const std::string &filename) {
+initOutputSQL(const std::string &filename, bool defer_indexes) {
+  return nullptr;
+}
+
+Output *
+reopenOutputSQL(const std::string &filename) {
   return nullptr;
 }
 
+void
+closeOutputSQL() {
+}
+
 }  // namespace Stats
 
 #endif  // ENABLE_SQLITE_STATS_OUTPUT
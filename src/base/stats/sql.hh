@@ -21,14 +21,20 @@
  * the value column. This would get the first double out of the total packed
  * vector (and the buffer will indicate the total size in bytes).
  *
+ * All inserts use statements that are prepared once when the database is
+ * opened, each dump is a single transaction, and the database uses
+ * write-ahead logging, so that frequent dumps are cheap.
+ *
  * Author: Sam Xi.
  */
 
 #ifndef __BASE_STATS_SQL_HH__
 #define __BASE_STATS_SQL_HH__
 
+#include <cstdint>
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 #include "base/stats/info.hh"
 #include "base/stats/output.hh"
@@ -44,14 +50,26 @@ class OutputSQL: public Output {
     // Constructor that does not create a database.
     OutputSQL();
     // Constructor that also creates a database by calling open().
-    OutputSQL(const std::string &filename);
+    OutputSQL(const std::string &filename, bool defer_indexes = false);
     // Closes the database connection.
     virtual ~OutputSQL();
 
     // Creates a new SQLite3 database with the given filename and all tables.
     //
-    // If a database already exists at the location, it is overwritten.
-    void open(const std::string &filename);
+    // If a database already exists at the location, it is overwritten. If
+    // defer_indexes is true, the value tables are only indexed by close(),
+    // which makes inserts cheaper but queries slower until then.
+    void open(const std::string &filename, bool defer_indexes = false);
+
+    // Creates any deferred indexes and closes the database.
+    void close();
+
+    // Writes the following dumps to a new database, e.g. in the output
+    // directory of a forked simulator.
+    //
+    // The connection to the current database belongs to the parent
+    // process, so it is left as it is rather than closed.
+    void reopen(const std::string &filename);
 
     // Statistic object visitors.
     virtual void visit(const ScalarInfo &info);
@@ -68,19 +86,39 @@ class OutputSQL: public Output {
     virtual void begin(std::string desc="");
     virtual void end();
 
+    // Number of rows inserted so far.
+    uint64_t rows() const { return rows_written; }
+
   protected:
     // Creates all the tables used to store statistics info and values.
     bool create_tables();
 
+    // Creates the unique (id, dump) indexes of the value tables.
+    bool create_indexes();
+
+    // Prepares the statements used for all inserts.
+    bool prepare_statements();
+
+    // Prepares one statement, returning nullptr on failure.
+    sqlite3_stmt *prepare(const std::string &sql);
+
+    // Executes a prepared statement and resets it for the next insert.
+    int step(sqlite3_stmt *stmt);
+
     // Executes a SQL command and returns the return code.
     //
     // This is just a wrapper for sqlite3_exec().
     int exec_sql(const std::string& sql_cmd);
 
     // Inserts a row of vector blob data into the vector stat table.
-    int insert_vector_value(int id, int dump_count, const unsigned char *blob,
+    int insert_vector_value(int id, int dump_count, const void *blob,
                             unsigned nbytes);
 
+    // Inserts the description of a stat into the stats table, the first
+    // time the stat is dumped.
+    template <class T>
+    void describe(const T &info);
+
     // Returns true if this stat should not be output.
     bool no_output(const Info &info);
 
@@ -93,14 +131,32 @@ class OutputSQL: public Output {
     // The SQLite3 database object.
     sqlite3* db;
 
+    // Statements prepared once per database and reused for every insert.
+    sqlite3_stmt* insert_stat_stmt;
+    sqlite3_stmt* insert_scalar_stmt;
+    sqlite3_stmt* insert_vector_stmt;
+    sqlite3_stmt* insert_dist_stmt;
+    sqlite3_stmt* insert_dump_desc_stmt;
+
     // True if the tables have been created successfully.
     bool tables_created;
 
+    // True if the indexes are only created by close().
+    bool defer_indexes;
+
+    // Whether each stat, by ID, has been described in the stats table.
+    //
+    // Stats can first appear after the first dump, e.g. in incremental
+    // dumps.
+    std::vector<bool> described;
+
     // How many times the stats have been dumped.
     //
     // This gets recorded along with each stat value so that stats for distinct
     // epochs of simulation can be distinguished.
     int dump_count;
+
+    uint64_t rows_written;
 };
 
 class StatInfo {
@@ -117,12 +173,15 @@ class StatInfo {
     StatInfo(const SparseHistInfo& info);
     StatInfo(const VectorDistInfo& info);
 
-    std::string create_sql_cmd();
+    // Binds the description to the parameters of an insert into the stats
+    // table: id, name, desc, flags, precision, type, prereq, subnames,
+    // subdescs, y_subnames, x, y and formula.
+    void bind(sqlite3_stmt *stmt) const;
 
   protected:
     static const int NO_PREREQ = -1;
 
-    std::string join(const std::vector<std::string> &array,
+    static std::string join(const std::vector<std::string> &array,
                      const std::string &sep = ",");
 
     int id;
@@ -148,7 +207,18 @@ class StatInfo {
 
 namespace Stats {
 
-Output *initOutputSQL(const std::string &filename);
+Output *initOutputSQL(const std::string &filename,
+                      bool defer_indexes = false);
+
+// Reopens the stats database at a new location, see OutputSQL::reopen().
+// Returns nullptr if it isn't an output.
+Output *reopenOutputSQL(const std::string &filename);
+
+// Closes the stats database, if it is an output, creating any deferred
+// indexes. Later dumps skip it. This has to be called when the simulation
+// exits, after the last dump: the database output is a static object,
+// which would otherwise only be closed by its destructor, if at all.
+void closeOutputSQL();
 
 }
 
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Unit tests for the SQLite stats output. The throughput of many small
+ * dumps is measured by unittest/sqlstatstime.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/stats/sql.hh"
+
+#ifdef ENABLE_SQLITE_STATS_OUTPUT
+
+using namespace Stats;
+
+namespace {
+
+/** A temporary database file, removed with its write-ahead log */
+class TempDB
+{
+  public:
+    std::string path;
+
+    TempDB()
+    {
+        char name[] = "/tmp/sql_testXXXXXX";
+        int fd = mkstemp(name);
+        EXPECT_GE(fd, 0);
+        ::close(fd);
+        path = name;
+    }
+
+    ~TempDB()
+    {
+        for (const char *suffix : { "", "-wal", "-shm" })
+            unlink((path + suffix).c_str());
+    }
+
+    /** Run a query that returns a single value as text */
+    std::string
+    query(const std::string &sql) const
+    {
+        sqlite3 *db;
+        EXPECT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+        sqlite3_stmt *stmt;
+        EXPECT_EQ(sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr),
+                  SQLITE_OK);
+        std::string result;
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            const unsigned char *text = sqlite3_column_text(stmt, 0);
+            result = text ? reinterpret_cast<const char *>(text) : "NULL";
+        }
+        sqlite3_finalize(stmt);
+        sqlite3_close(db);
+        return result;
+    }
+};
+
+/** The Info of a stat, of the type that the outputs visit */
+template <class Stat>
+const typename Stat::Info &
+infoOf(const Stat &stat)
+{
+    return *stat.info();
+}
+
+struct TestStats
+{
+    Scalar scalar;
+    Vector vector;
+    Distribution dist;
+
+    TestStats()
+    {
+        scalar.name("test.scalar").desc("A \"quoted\" scalar");
+        vector.init(2).name("test.vector").desc("vector");
+        dist.init(0, 9, 1).name("test.dist").desc("dist");
+    }
+
+    void
+    reset()
+    {
+        scalar.reset();
+        vector.reset();
+        dist.reset();
+    }
+
+    void
+    dump(OutputSQL &sql, const std::string &desc, bool all = true)
+    {
+        sql.begin(desc);
+        sql.visit(infoOf(scalar));
+        if (all) {
+            sql.visit(infoOf(vector));
+            dist.prepare();
+            sql.visit(infoOf(dist));
+        }
+        sql.end();
+    }
+};
+
+/**
+ * Stats are registered for the rest of the program, so the tests share
+ * one set of them
+ */
+TestStats &
+testStats()
+{
+    static TestStats *stats = new TestStats;
+    stats->reset();
+    return *stats;
+}
+
+} // anonymous namespace
+
+// Values and descriptions are stored verbatim, including quotes
+TEST(OutputSQLTest, Values)
+{
+    TempDB db;
+    TestStats &stats = testStats();
+    {
+        OutputSQL sql(db.path);
+        stats.scalar = 3;
+        stats.vector[1] = 2;
+        stats.dist.sample(4);
+        stats.dump(sql, "first \"dump\"");
+        stats.scalar = 5;
+        stats.dump(sql, "second");
+        EXPECT_EQ(sql.rows(), 2 + 3 + 2 * 3);
+    }
+
+    const std::string id = std::to_string(infoOf(stats.scalar).id);
+    EXPECT_EQ(db.query("select count(*) from stats"), "3");
+    EXPECT_EQ(db.query("select desc from stats where id = " + id),
+              "A \"quoted\" scalar");
+    EXPECT_EQ(db.query("select desc from dumpDesc where id = 0"),
+              "first \"dump\"");
+    EXPECT_EQ(db.query("select value from scalarValue where dump = 1"),
+              "5.0");
+    EXPECT_EQ(db.query("select length(value) from vectorValue"),
+              std::to_string(2 * sizeof(Result)));
+    EXPECT_EQ(db.query("select samples from distValue where dump = 1"),
+              "1.0");
+    EXPECT_EQ(db.query("select max_val from distValue"), "NULL");
+    EXPECT_EQ(db.query("pragma journal_mode"), "wal");
+}
+
+// Stats that first appear after the first dump, as with incremental
+// dumps, are described too
+TEST(OutputSQLTest, LateStats)
+{
+    TempDB db;
+    TestStats &stats = testStats();
+    {
+        OutputSQL sql(db.path);
+        stats.dump(sql, "", false);
+        EXPECT_EQ(db.query("select count(*) from stats"), "1");
+        stats.dump(sql, "");
+    }
+
+    EXPECT_EQ(db.query("select count(*) from stats"), "3");
+    EXPECT_EQ(db.query("select count(*) from scalarValue"), "2");
+}
+
+// Deferred indexes are only created when the database is closed
+TEST(OutputSQLTest, DeferredIndexes)
+{
+    const std::string index_count =
+        "select count(*) from sqlite_master where type = 'index' "
+        "and name like '%ValueKey'";
+
+    TempDB db;
+    TestStats &stats = testStats();
+    OutputSQL sql(db.path, true);
+    stats.dump(sql, "");
+    EXPECT_EQ(db.query(index_count), "0");
+    sql.close();
+    EXPECT_EQ(db.query(index_count), "3");
+
+    TempDB eager_db;
+    OutputSQL eager_sql(eager_db.path);
+    EXPECT_EQ(eager_db.query(index_count), "3");
+}
+
+// A reopened output, as in a forked simulator, describes the stats again
+// and numbers its dumps from zero in the new database
+TEST(OutputSQLTest, Reopen)
+{
+    TempDB db, forked_db;
+    TestStats &stats = testStats();
+    OutputSQL sql(db.path);
+    stats.dump(sql, "parent");
+    stats.dump(sql, "parent");
+
+    sql.reopen(forked_db.path);
+    EXPECT_EQ(sql.rows(), 0);
+    stats.dump(sql, "child");
+    sql.close();
+
+    EXPECT_EQ(db.query("select count(*) from dumpDesc"), "2");
+    EXPECT_EQ(forked_db.query("select count(*) from stats"), "3");
+    EXPECT_EQ(forked_db.query("select desc from dumpDesc where id = 0"),
+              "child");
+}
+
+#endif // ENABLE_SQLITE_STATS_OUTPUT
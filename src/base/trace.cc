@@ -72,6 +72,20 @@ getDebugLogger()
     return debug_logger;
 }
 
+std::string &
+rawArgBuffer()
+{
+    static thread_local std::string buf;
+    return buf;
+}
+
+void
+flushDebugLogger()
+{
+    if (debug_logger)
+        debug_logger->flush();
+}
+
 std::ostream &
 output()
 {
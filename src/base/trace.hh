@@ -41,11 +41,17 @@
 #include "base/cprintf.hh"
 #include "base/debug.hh"
 #include "base/match.hh"
+#include "base/trace_args.hh"
 #include "base/types.hh"
 #include "sim/core.hh"
 
 namespace Trace {
 
+class BinaryLogger;
+
+/** Per-thread scratch buffer for encoding raw message arguments */
+std::string &rawArgBuffer();
+
 /** Debug logging base class.  Handles formatting and outputting
  *  time/name/message messages */
 class Logger
@@ -54,7 +60,15 @@ class Logger
     /** Name match for objects to ignore */
     ObjectMatch ignore;
 
+    /**
+     * Set by loggers that want messages passed to logRaw() with their
+     * arguments encoded rather than formatted by dprintf().
+     */
+    bool rawArgs;
+
   public:
+    Logger() : rawArgs(false) { }
+
     /** Log a single message */
     template <typename ...Args>
     void dprintf(Tick when, const std::string &name, const char *fmt,
@@ -63,6 +77,14 @@ class Logger
         if (!name.empty() && ignore.match(name))
             return;
 
+        if (rawArgs) {
+            std::string &buf = rawArgBuffer();
+            buf.clear();
+            RawArg::encode(buf, args...);
+            logRaw(when, name, fmt, sizeof...(args), buf);
+            return;
+        }
+
         std::ostringstream line;
         ccprintf(line, fmt, args...);
         logMessage(when, name, line.str());
@@ -76,6 +98,23 @@ class Logger
     virtual void logMessage(Tick when, const std::string &name,
                             const std::string &message) = 0;
 
+    /**
+     * Log an unformatted message, only called if rawArgs is set.
+     *
+     * @param fmt cprintf format string.
+     * @param nargs Number of arguments.
+     * @param args Arguments encoded as described in base/trace_args.hh.
+     */
+    virtual void logRaw(Tick when, const std::string &name, const char *fmt,
+                        unsigned nargs, const std::string &args)
+    { }
+
+    /** Write out any buffered messages, e.g. before the process dies */
+    virtual void flush() { }
+
+    /** Return this logger if it records binary traces, or nullptr */
+    virtual BinaryLogger *binaryLogger() { return nullptr; }
+
     /** Return an ostream that can be used to send messages to
      *  the 'same place' as formatted logMessage messages.  This
      *  can be implemented to use a logger's underlying ostream,
@@ -116,6 +155,9 @@ std::ostream &output();
 /** Delete the current global logger and assign a new one */
 void setDebugLogger(Logger *logger);
 
+/** Flush the current global logger, if one has been set */
+void flushDebugLogger();
+
 /** Enable/disable debug logging */
 void enable();
 void disable();
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Raw encoding of debug message arguments.
+ *
+ * Loggers that store debug messages unformatted (see BinaryLogger) get
+ * the arguments of each DPRINTF as a compact byte string instead of a
+ * formatted line. Every argument is encoded as a one-byte tag followed by
+ * its value in host byte order:
+ *
+ *   Int, UInt  size (1 byte), value (8 bytes)
+ *   Float      value (8 bytes, double)
+ *   Char       value (1 byte)
+ *   Bool       value (1 byte)
+ *   Ptr        value (8 bytes)
+ *   Str        length (4 bytes), characters
+ *
+ * Types that are neither arithmetic, enums, pointers nor strings are
+ * formatted with their stream operator and stored as strings, so their
+ * cost is the same as with a text logger.
+ */
+
+#ifndef __BASE_TRACE_ARGS_HH__
+#define __BASE_TRACE_ARGS_HH__
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace Trace {
+namespace RawArg {
+
+enum Tag : uint8_t
+{
+    Int = 1,
+    UInt,
+    Float,
+    Char,
+    Bool,
+    Ptr,
+    Str,
+};
+
+template <typename T>
+inline void
+putBytes(std::string &buf, const T &val)
+{
+    buf.append(reinterpret_cast<const char *>(&val), sizeof(val));
+}
+
+inline void
+putString(std::string &buf, const char *str, size_t len)
+{
+    buf.push_back(Str);
+    putBytes(buf, static_cast<uint32_t>(len));
+    buf.append(str, len);
+}
+
+template <typename T>
+inline typename std::enable_if<
+    std::is_integral<T>::value || std::is_enum<T>::value>::type
+put(std::string &buf, const T &val)
+{
+    typedef typename std::conditional<std::is_enum<T>::value,
+        int64_t, T>::type Num;
+    if (std::is_signed<Num>::value) {
+        buf.push_back(Int);
+        buf.push_back(sizeof(T));
+        putBytes(buf, static_cast<int64_t>(val));
+    } else {
+        buf.push_back(UInt);
+        buf.push_back(sizeof(T));
+        putBytes(buf, static_cast<uint64_t>(val));
+    }
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value>::type
+put(std::string &buf, const T &val)
+{
+    buf.push_back(Float);
+    putBytes(buf, static_cast<double>(val));
+}
+
+inline void
+put(std::string &buf, char val)
+{
+    buf.push_back(Char);
+    buf.push_back(val);
+}
+
+inline void
+put(std::string &buf, bool val)
+{
+    buf.push_back(Bool);
+    buf.push_back(val ? 1 : 0);
+}
+
+inline void
+put(std::string &buf, const char *str)
+{
+    if (str)
+        putString(buf, str, std::strlen(str));
+    else
+        putString(buf, "(null)", 6);
+}
+
+inline void
+put(std::string &buf, char *str)
+{
+    put(buf, static_cast<const char *>(str));
+}
+
+template <size_t N>
+inline void
+put(std::string &buf, const char (&str)[N])
+{
+    put(buf, static_cast<const char *>(str));
+}
+
+inline void
+put(std::string &buf, const std::string &str)
+{
+    putString(buf, str.data(), str.size());
+}
+
+template <typename T>
+inline void
+put(std::string &buf, T *ptr)
+{
+    buf.push_back(Ptr);
+    putBytes(buf, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr)));
+}
+
+template <typename T>
+inline typename std::enable_if<
+    !std::is_arithmetic<T>::value && !std::is_enum<T>::value &&
+    !std::is_pointer<T>::value && !std::is_array<T>::value>::type
+put(std::string &buf, const T &val)
+{
+    std::ostringstream str;
+    str << val;
+    put(buf, str.str());
+}
+
+inline void
+encode(std::string &buf)
+{
+}
+
+template <typename T, typename ...Args>
+inline void
+encode(std::string &buf, const T &val, const Args &...args)
+{
+    put(buf, val);
+    encode(buf, args...);
+}
+
+} // namespace RawArg
+} // namespace Trace
+
+#endif // __BASE_TRACE_ARGS_HH__
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Unit tests for the raw encoding of debug message arguments.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "base/trace_args.hh"
+
+using namespace Trace;
+
+namespace {
+
+template <typename T>
+T
+get(const std::string &buf, size_t offset)
+{
+    T val;
+    std::memcpy(&val, buf.data() + offset, sizeof(val));
+    return val;
+}
+
+struct Streamable
+{
+};
+
+std::ostream &
+operator<<(std::ostream &os, const Streamable &)
+{
+    return os << "streamed";
+}
+
+} // anonymous namespace
+
+// Integers keep their signedness and original size
+TEST(TraceArgsTest, Integers)
+{
+    std::string buf;
+    RawArg::encode(buf, int16_t(-5), uint32_t(7));
+
+    ASSERT_EQ(buf.size(), 20);
+    EXPECT_EQ(buf[0], RawArg::Int);
+    EXPECT_EQ(buf[1], 2);
+    EXPECT_EQ(get<int64_t>(buf, 2), -5);
+    EXPECT_EQ(buf[10], RawArg::UInt);
+    EXPECT_EQ(buf[11], 4);
+    EXPECT_EQ(get<uint64_t>(buf, 12), 7);
+}
+
+// Characters, booleans and floating point values have their own tags
+TEST(TraceArgsTest, Scalars)
+{
+    std::string buf;
+    RawArg::encode(buf, 'x', true, 1.5f);
+
+    ASSERT_EQ(buf.size(), 2 + 2 + 9);
+    EXPECT_EQ(buf[0], RawArg::Char);
+    EXPECT_EQ(buf[1], 'x');
+    EXPECT_EQ(buf[2], RawArg::Bool);
+    EXPECT_EQ(buf[3], 1);
+    EXPECT_EQ(buf[4], RawArg::Float);
+    EXPECT_EQ(get<double>(buf, 5), 1.5);
+}
+
+// C strings, string literals and std::strings are all stored as strings,
+// other pointers are stored as addresses
+TEST(TraceArgsTest, StringsAndPointers)
+{
+    std::string buf;
+    const char *cstr = "ab";
+    int val = 0;
+    RawArg::encode(buf, cstr, "cde", std::string("f"), &val);
+
+    ASSERT_EQ(buf.size(), (5 + 2) + (5 + 3) + (5 + 1) + 9);
+    EXPECT_EQ(buf[0], RawArg::Str);
+    EXPECT_EQ(get<uint32_t>(buf, 1), 2);
+    EXPECT_EQ(buf.substr(5, 2), "ab");
+    EXPECT_EQ(buf[7], RawArg::Str);
+    EXPECT_EQ(buf.substr(12, 3), "cde");
+    EXPECT_EQ(buf[15], RawArg::Str);
+    EXPECT_EQ(buf.substr(20, 1), "f");
+    EXPECT_EQ(buf[21], RawArg::Ptr);
+    EXPECT_EQ(get<uint64_t>(buf, 22), reinterpret_cast<uintptr_t>(&val));
+}
+
+// Other types are formatted with their stream operator
+TEST(TraceArgsTest, Streamed)
+{
+    std::string buf;
+    RawArg::encode(buf, Streamable());
+
+    ASSERT_EQ(buf.size(), 5 + 8);
+    EXPECT_EQ(buf[0], RawArg::Str);
+    EXPECT_EQ(buf.substr(5), "streamed");
+}
@@ -0,0 +1,63 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.SimObject import *
+from m5.params import *
+
+class SamplingController(SimObject):
+    """SMARTS-style statistical sampling. The configuration script
+    alternates long periods of functional warming on a fast CPU with
+    short measurement windows on the detailed CPUs, and the controller
+    turns the per-window CPI into a mean and a confidence interval."""
+
+    type = 'SamplingController'
+    cxx_header = "cpu/sampling_controller.hh"
+
+    cxx_exports = [
+        PyBindMethod("beginWindow"),
+        PyBindMethod("endWindow"),
+        PyBindMethod("done"),
+        PyBindMethod("samples"),
+        PyBindMethod("cpiMean"),
+        PyBindMethod("cpiHalfWidth"),
+    ]
+
+    cpus = VectorParam.BaseCPU("Detailed CPUs measured in each window")
+
+    warming_insts = Param.Counter(1000000, "Instructions of functional "
+        "warming between two measurement windows")
+    warmup_insts = Param.Counter(2000, "Instructions of detailed warm-up "
+        "before each measurement window")
+    window_insts = Param.Counter(1000, "Instructions per measurement window")
+
+    min_samples = Param.Unsigned(30, "Windows measured before the "
+        "confidence target is checked")
+    max_samples = Param.Unsigned(10000, "Stop after this many windows")
+    z_score = Param.Float(3.0, "Standard score of the reported confidence "
+        "interval (3.0 is ~99.7%)")
+    target_error = Param.Float(0.03, "Stop once the confidence interval "
+        "half-width is within this fraction of the mean CPI (0 to always "
+        "measure max_samples windows)")
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Recycling allocator for dynamic instructions.
+ */
+
+#include "cpu/dyn_inst_pool.hh"
+
+#include <cstdlib>
+#include <new>
+
+DynInstPool::DynInstPool()
+    : objectSize(0), liveCount(0), highWaterCount(0)
+{
+}
+
+DynInstPool::~DynInstPool()
+{
+    for (auto header : freeBlocks)
+        std::free(header);
+}
+
+void *
+DynInstPool::allocate(size_t size)
+{
+    if (objectSize == 0)
+        objectSize = size;
+
+    // Every block has room for objectSize bytes so that any block can be
+    // reused for any later object. Larger objects, which do not occur
+    // with a single instruction class, bypass the pool.
+    if (size > objectSize)
+        return allocateUnpooled(size);
+
+    Header *header;
+    if (!freeBlocks.empty()) {
+        header = freeBlocks.back();
+        freeBlocks.pop_back();
+        ++statReused;
+    } else {
+        header = static_cast<Header *>(
+            std::malloc(sizeof(Header) + objectSize));
+        if (!header)
+            throw std::bad_alloc();
+        ++statAllocated;
+    }
+
+    header->pool = this;
+    ++liveCount;
+    if (liveCount > highWaterCount)
+        highWaterCount = liveCount;
+
+    return header + 1;
+}
+
+void *
+DynInstPool::allocateUnpooled(size_t size)
+{
+    Header *header = static_cast<Header *>(
+        std::malloc(sizeof(Header) + size));
+    if (!header)
+        throw std::bad_alloc();
+    header->pool = nullptr;
+    return header + 1;
+}
+
+void
+DynInstPool::release(void *ptr)
+{
+    if (!ptr)
+        return;
+
+    Header *header = static_cast<Header *>(ptr) - 1;
+    if (header->pool)
+        header->pool->releaseBlock(header);
+    else
+        std::free(header);
+}
+
+void
+DynInstPool::releaseBlock(Header *header)
+{
+    --liveCount;
+    freeBlocks.push_back(header);
+}
+
+void
+DynInstPool::regStats(const std::string &cpu_name)
+{
+    statLive
+        .method(this, &DynInstPool::live)
+        .name(cpu_name + ".dynInstPool.live")
+        .desc("Number of dynamic instructions currently allocated");
+
+    statHighWater
+        .method(this, &DynInstPool::highWater)
+        .name(cpu_name + ".dynInstPool.highWater")
+        .desc("Highest number of dynamic instructions allocated at once");
+
+    statReused
+        .name(cpu_name + ".dynInstPool.reused")
+        .desc("Number of dynamic instructions allocated from recycled "
+              "storage");
+
+    statAllocated
+        .name(cpu_name + ".dynInstPool.allocated")
+        .desc("Number of dynamic instruction blocks allocated from the "
+              "heap");
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Recycling allocator for dynamic instructions.
+ *
+ * Detailed CPU models create a dynamic instruction object for every fetched
+ * (micro-)instruction and free it again when it commits or is squashed.
+ * In branchy code most of them die young, so the general purpose heap sees
+ * a constant stream of same-sized allocations and frees. A DynInstPool keeps
+ * the storage of freed instructions on a free list owned by the CPU and
+ * hands it out again for the next instruction.
+ *
+ * Dynamic instruction classes opt in by declaring the class-specific
+ * operator new/delete from DYN_INST_POOL_ALLOCATED, and are then allocated
+ * from a CPU's pool with a placement new:
+ *
+ *   DynInstPtr inst = new (cpu->dynInstPool) DynInst(...);
+ *
+ * Each block carries a small header that records the pool it came from,
+ * so the refcounting `delete this` returns it to the right pool. Objects
+ * allocated with a plain `new` bypass the pool and use the heap.
+ */
+
+#ifndef __CPU_DYN_INST_POOL_HH__
+#define __CPU_DYN_INST_POOL_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+
+class DynInstPool
+{
+  public:
+    DynInstPool();
+
+    /** Release the storage on the free list. */
+    ~DynInstPool();
+
+    DynInstPool(const DynInstPool &) = delete;
+    DynInstPool &operator=(const DynInstPool &) = delete;
+
+    /**
+     * Get storage for an object of the given size, reusing a freed block
+     * if one is available.
+     */
+    void *allocate(size_t size);
+
+    /** Get storage for an object that is not tracked by any pool. */
+    static void *allocateUnpooled(size_t size);
+
+    /**
+     * Return the storage of an object allocated with allocate() or
+     * allocateUnpooled() to wherever it came from.
+     */
+    static void release(void *ptr);
+
+    /** Number of objects currently allocated from this pool. */
+    uint64_t live() const { return liveCount; }
+
+    /** Highest number of objects simultaneously allocated. */
+    uint64_t highWater() const { return highWaterCount; }
+
+    /** Register the pool's stats as children of a CPU. */
+    void regStats(const std::string &cpu_name);
+
+  private:
+    /**
+     * Prepended to every block. Padded so that the object that follows
+     * is suitably aligned for any type.
+     */
+    union Header
+    {
+        DynInstPool *pool;
+        std::max_align_t align;
+    };
+
+    void releaseBlock(Header *header);
+
+    /** Size of the objects handed out by this pool, set on first use. */
+    size_t objectSize;
+
+    /** Headers of blocks that are free for reuse. */
+    std::vector<Header *> freeBlocks;
+
+    uint64_t liveCount;
+    uint64_t highWaterCount;
+
+    Stats::Value statLive;
+    Stats::Value statHighWater;
+    Stats::Scalar statReused;
+    Stats::Scalar statAllocated;
+};
+
+/**
+ * Declare class-specific allocation functions that route allocations of a
+ * dynamic instruction class through DynInstPool. The placement form
+ * allocates from a given pool; the plain form uses the heap.
+ */
+#define DYN_INST_POOL_ALLOCATED                                             \
+    static void *                                                           \
+    operator new(size_t size, DynInstPool &pool)                            \
+    {                                                                       \
+        return pool.allocate(size);                                         \
+    }                                                                       \
+    static void *                                                           \
+    operator new(size_t size)                                               \
+    {                                                                       \
+        return DynInstPool::allocateUnpooled(size);                         \
+    }                                                                       \
+    static void                                                             \
+    operator delete(void *ptr, DynInstPool &)                               \
+    {                                                                       \
+        DynInstPool::release(ptr);                                          \
+    }                                                                       \
+    static void                                                             \
+    operator delete(void *ptr)                                              \
+    {                                                                       \
+        DynInstPool::release(ptr);                                          \
+    }
+
+#endif // __CPU_DYN_INST_POOL_HH__
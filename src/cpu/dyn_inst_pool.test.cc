@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "base/statistics.hh"
+#include "base/stats/info.hh"
+#include "cpu/dyn_inst_pool.hh"
+
+namespace {
+
+struct TestInst
+{
+    DYN_INST_POOL_ALLOCATED
+
+    uint64_t payload[4];
+};
+
+/** Larger than TestInst, so it doesn't fit in the pool's blocks */
+struct BigInst
+{
+    DYN_INST_POOL_ALLOCATED
+
+    uint64_t payload[16];
+};
+
+struct ThrowingInst
+{
+    DYN_INST_POOL_ALLOCATED
+
+    ThrowingInst() { throw std::runtime_error("constructor"); }
+
+    uint64_t payload[4];
+};
+
+/**
+ * Pools hold stats, which stay registered for the rest of the program, so
+ * they are never destroyed.
+ */
+DynInstPool &
+newPool(const std::string &name)
+{
+    DynInstPool *pool = new DynInstPool;
+    pool->regStats(name);
+    return *pool;
+}
+
+double
+statValue(const std::string &name)
+{
+    for (auto info : Stats::statsList()) {
+        if (info->name == name)
+            return dynamic_cast<Stats::ScalarInfo &>(*info).value();
+    }
+    ADD_FAILURE() << "No stat named " << name;
+    return 0;
+}
+
+} // anonymous namespace
+
+TEST(DynInstPoolTest, Reuse)
+{
+    DynInstPool &pool = newPool("reuse");
+
+    TestInst *first = new (pool) TestInst;
+    EXPECT_EQ(1, pool.live());
+    delete first;
+    EXPECT_EQ(0, pool.live());
+
+    TestInst *second = new (pool) TestInst;
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1, pool.live());
+    delete second;
+}
+
+TEST(DynInstPoolTest, Alignment)
+{
+    DynInstPool &pool = newPool("alignment");
+
+    TestInst *pooled = new (pool) TestInst;
+    TestInst *unpooled = new TestInst;
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(pooled) %
+                 alignof(std::max_align_t));
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(unpooled) %
+                 alignof(std::max_align_t));
+    delete pooled;
+    delete unpooled;
+}
+
+// Objects allocated with a plain new live on the heap, and deleting them
+// doesn't put their storage on any pool's free list.
+TEST(DynInstPoolTest, Unpooled)
+{
+    DynInstPool &pool = newPool("unpooled");
+
+    TestInst *pooled = new (pool) TestInst;
+    TestInst *unpooled = new TestInst;
+    EXPECT_EQ(1, pool.live());
+    delete unpooled;
+    EXPECT_EQ(1, pool.live());
+
+    delete pooled;
+    new (pool) TestInst;
+    new (pool) TestInst;
+    EXPECT_EQ(1, statValue("unpooled.dynInstPool.reused"));
+    EXPECT_EQ(2, statValue("unpooled.dynInstPool.allocated"));
+}
+
+// Every block goes back to the pool it came from, whoever deletes it.
+TEST(DynInstPoolTest, ReleaseToOwner)
+{
+    DynInstPool &a = newPool("owner_a");
+    DynInstPool &b = newPool("owner_b");
+
+    TestInst *from_a = new (a) TestInst;
+    TestInst *from_b = new (b) TestInst;
+    delete from_a;
+    EXPECT_EQ(0, a.live());
+    EXPECT_EQ(1, b.live());
+
+    EXPECT_NE(from_a, new (b) TestInst);
+    EXPECT_EQ(from_a, new (a) TestInst);
+    delete from_b;
+    EXPECT_EQ(from_b, new (b) TestInst);
+}
+
+// Objects bigger than the first one allocated from a pool bypass it.
+TEST(DynInstPoolTest, Oversized)
+{
+    DynInstPool &pool = newPool("oversized");
+
+    delete new (pool) TestInst;
+    BigInst *big = new (pool) BigInst;
+    EXPECT_EQ(0, pool.live());
+    delete big;
+    EXPECT_EQ(0, pool.live());
+    EXPECT_EQ(0, statValue("oversized.dynInstPool.reused"));
+    EXPECT_EQ(1, statValue("oversized.dynInstPool.allocated"));
+}
+
+// If a constructor throws, the placement delete returns the block.
+TEST(DynInstPoolTest, ConstructorThrows)
+{
+    DynInstPool &pool = newPool("throws");
+
+    EXPECT_THROW(new (pool) ThrowingInst, std::runtime_error);
+    EXPECT_EQ(0, pool.live());
+    new (pool) TestInst;
+    EXPECT_EQ(1, statValue("throws.dynInstPool.reused"));
+    EXPECT_EQ(1, statValue("throws.dynInstPool.allocated"));
+}
+
+TEST(DynInstPoolTest, Stats)
+{
+    DynInstPool &pool = newPool("stats");
+
+    TestInst *insts[5];
+    for (auto &inst : insts)
+        inst = new (pool) TestInst;
+    for (int i = 0; i < 3; ++i)
+        delete insts[i];
+    for (int i = 0; i < 2; ++i)
+        insts[i] = new (pool) TestInst;
+
+    EXPECT_EQ(4, pool.live());
+    EXPECT_EQ(5, pool.highWater());
+    EXPECT_EQ(4, statValue("stats.dynInstPool.live"));
+    EXPECT_EQ(5, statValue("stats.dynInstPool.highWater"));
+    EXPECT_EQ(2, statValue("stats.dynInstPool.reused"));
+    EXPECT_EQ(5, statValue("stats.dynInstPool.allocated"));
+
+    for (int i = 0; i < 2; ++i)
+        delete insts[i];
+    for (int i = 3; i < 5; ++i)
+        delete insts[i];
+    EXPECT_EQ(0, statValue("stats.dynInstPool.live"));
+    EXPECT_EQ(5, statValue("stats.dynInstPool.highWater"));
+}
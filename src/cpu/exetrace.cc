@@ -34,9 +34,12 @@
 #include "cpu/exetrace.hh"
 
 #include <iomanip>
+#include <unordered_map>
+#include <utility>
 
 #include "arch/isa_traits.hh"
 #include "arch/utility.hh"
+#include "base/binary_trace.hh"
 #include "base/loader/symtab.hh"
 #include "config/the_isa.hh"
 #include "cpu/base.hh"
@@ -56,17 +59,99 @@ ExeTracerRecord::dumpTicks(ostream &outs)
     ccprintf(outs, "%7d: ", when);
 }
 
+namespace {
+
+struct DisassemblyKey
+{
+    const StaticInst *inst;
+    Addr pc;
+
+    bool
+    operator==(const DisassemblyKey &other) const
+    {
+        return inst == other.inst && pc == other.pc;
+    }
+};
+
+struct DisassemblyKeyHash
+{
+    size_t
+    operator()(const DisassemblyKey &key) const
+    {
+        return std::hash<const StaticInst *>()(key.inst) ^
+            std::hash<Addr>()(key.pc);
+    }
+};
+
+/**
+ * Disassembly string IDs of the instructions traced so far. Disassembly
+ * can depend on the PC (e.g. branch targets), so the PC is part of the
+ * key. The StaticInstPtr keeps the instruction alive so that its address
+ * isn't reused by a different instruction.
+ */
+typedef std::unordered_map<DisassemblyKey,
+                           std::pair<StaticInstPtr, uint32_t>,
+                           DisassemblyKeyHash> DisassemblyCache;
+
+} // anonymous namespace
+
 void
-Trace::ExeTracerRecord::traceInst(const StaticInstPtr &inst, bool ran)
+Trace::ExeTracerRecord::traceInstBinary(BinaryLogger &logger,
+                                        const StaticInstPtr &inst, bool ran)
 {
-    ostream &outs = Trace::output();
+    // CPUs simulated on different threads trace concurrently, so each
+    // thread keeps its own cache
+    static thread_local DisassemblyCache disassembly;
+    static thread_local BinaryLogger *cache_logger = nullptr;
 
+    // String IDs belong to a logger, so start over if it changed
+    if (cache_logger != &logger) {
+        disassembly.clear();
+        cache_logger = &logger;
+    }
+
+    const Addr cur_pc = pc.instAddr();
+    const DisassemblyKey key = { inst.get(), cur_pc };
+    auto it = disassembly.find(key);
+    if (it == disassembly.end()) {
+        const uint32_t id = logger.internString(
+            inst->disassemble(cur_pc, debugSymbolTable));
+        it = disassembly.emplace(key, std::make_pair(inst, id)).first;
+    }
+
+    uint8_t flags = 0;
+    if (ran)
+        flags |= BinaryLogger::InstRan;
+    if (!predicate)
+        flags |= BinaryLogger::InstPredFalse;
+    if (data_status != DataInvalid)
+        flags |= BinaryLogger::InstDataValid;
+    if (getMemValid())
+        flags |= BinaryLogger::InstAddrValid;
+
+    logger.logInst(when, thread->getCpuPtr()->name(), thread->threadId(),
+                   cur_pc, inst->isMicroop() ? pc.microPC() : -1,
+                   it->second.second,
+                   logger.literalId(Enums::OpClassStrings[inst->opClass()]),
+                   flags, data.as_int, addr);
+}
+
+void
+Trace::ExeTracerRecord::traceInst(const StaticInstPtr &inst, bool ran)
+{
     if (!Debug::ExecUser || !Debug::ExecKernel) {
         bool in_user_mode = TheISA::inUserMode(thread);
         if (in_user_mode && !Debug::ExecUser) return;
         if (!in_user_mode && !Debug::ExecKernel) return;
     }
 
+    if (BinaryLogger *logger = Trace::getDebugLogger()->binaryLogger()) {
+        traceInstBinary(*logger, inst, ran);
+        return;
+    }
+
+    ostream &outs = Trace::output();
+
     if (Debug::ExecTicks)
         dumpTicks(outs);
 
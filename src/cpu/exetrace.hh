@@ -44,6 +44,8 @@ class ThreadContext;
 
 namespace Trace {
 
+class BinaryLogger;
+
 class ExeTracerRecord : public InstRecord
 {
   public:
@@ -56,6 +58,10 @@ class ExeTracerRecord : public InstRecord
 
     void traceInst(const StaticInstPtr &inst, bool ran);
 
+    /** Record an instruction with a binary debug logger */
+    void traceInstBinary(BinaryLogger &logger, const StaticInstPtr &inst,
+                         bool ran);
+
     void dump();
     virtual void dumpTicks(std::ostream &outs);
 };
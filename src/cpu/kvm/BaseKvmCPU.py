@@ -66,6 +66,10 @@ class BaseKvmCPU(BaseCPU):
 
     useCoalescedMMIO = Param.Bool(False, "Use coalesced MMIO (EXPERIMENTAL)")
     usePerfOverflow = Param.Bool(False, "Use perf event overflow counters (EXPERIMENTAL)")
+    usePerf = Param.Bool(True, "Use host performance counters to count guest "
+                         "cycles and instructions. Without them, guest time "
+                         "is measured with the host clock and guest "
+                         "instructions aren't counted.")
     alwaysSyncTC = Param.Bool(False,
                               "Always sync thread contexts on entry/exit")
 
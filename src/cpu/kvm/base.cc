@@ -46,6 +46,7 @@
 
 #include <cerrno>
 #include <csignal>
+#include <ctime>
 #include <ostream>
 
 #include "arch/mmapped_ipr.hh"
@@ -78,13 +79,18 @@ BaseKvmCPU::BaseKvmCPU(BaseKvmCPUParams *params)
                 false, Event::CPU_Tick_Pri),
       activeInstPeriod(0),
       perfControlledByTimer(params->usePerfOverflow),
+      usePerf(params->usePerf),
       hostFactor(params->hostFactor),
+      hostFreq(params->hostFreq),
       ctrInsts(0)
 {
     if (pageSize == -1)
         panic("KVM: Failed to determine host page size (%i)\n",
               errno);
 
+    fatal_if(perfControlledByTimer && !usePerf,
+             "KVM: Perf event overflow counters need usePerf.\n");
+
     if (FullSystem)
         thread = new SimpleThread(this, 0, params->system, params->itb, params->dtb,
                                   params->isa[0]);
@@ -253,7 +259,8 @@ BaseKvmCPU::startupThread()
     // created since it manipulates the vCPU signal mask.
     setupSignalHandler();
 
-    setupCounters();
+    if (usePerf)
+        setupCounters();
 
     if (p->usePerfOverflow)
         runTimer.reset(new PerfKvmTimer(hwCycles,
@@ -461,8 +468,10 @@ BaseKvmCPU::notifyFork()
         vcpuFD = -1;
         _kvmRun = NULL;
 
-        hwInstructions.detach();
-        hwCycles.detach();
+        if (usePerf) {
+            hwInstructions.detach();
+            hwCycles.detach();
+        }
     }
 }
 
@@ -722,7 +731,15 @@ BaseKvmCPU::kvmRunDrain()
 uint64_t
 BaseKvmCPU::getHostCycles() const
 {
-    return hwCycles.read();
+    if (usePerf)
+        return hwCycles.read();
+
+    // Without a cycle counter, count cycles of the nominal host clock
+    // instead.
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    const uint64_t ns(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+    return ns * SimClock::Float::ns / hostFreq;
 }
 
 Tick
@@ -778,20 +795,20 @@ BaseKvmCPU::kvmRun(Tick ticks)
         // Get hardware statistics after synchronizing contexts. The KVM
         // state update might affect guest cycle counters.
         uint64_t baseCycles(getHostCycles());
-        uint64_t baseInstrs(hwInstructions.read());
+        uint64_t baseInstrs(usePerf ? hwInstructions.read() : 0);
 
         // Arm the run timer and start the cycle timer if it isn't
         // controlled by the overflow timer. Starting/stopping the cycle
         // timer automatically starts the other perf timers as they are in
         // the same counter group.
         runTimer->arm(ticks);
-        if (!perfControlledByTimer)
+        if (usePerf && !perfControlledByTimer)
             hwCycles.start();
 
         ioctlRun();
 
         runTimer->disarm();
-        if (!perfControlledByTimer)
+        if (usePerf && !perfControlledByTimer)
             hwCycles.stop();
 
         // The control signal may have been delivered after we exited
@@ -803,7 +820,8 @@ BaseKvmCPU::kvmRun(Tick ticks)
 
         const uint64_t hostCyclesExecuted(getHostCycles() - baseCycles);
         const uint64_t simCyclesExecuted(hostCyclesExecuted * hostFactor);
-        const uint64_t instsExecuted(hwInstructions.read() - baseInstrs);
+        const uint64_t instsExecuted(
+            usePerf ? hwInstructions.read() - baseInstrs : 0);
         ticksExecuted = runTimer->ticksFromHostCycles(hostCyclesExecuted);
 
         /* Update statistics */
@@ -1349,6 +1367,15 @@ BaseKvmCPU::ioctlRun()
 void
 BaseKvmCPU::setupInstStop()
 {
+    if (!usePerf) {
+        // Guest instructions aren't counted, so instruction events
+        // never happen.
+        if (!comInstEventQueue[0]->empty())
+            warn_once("KVM: Instruction events need usePerf and are "
+                      "ignored.\n");
+        return;
+    }
+
     if (comInstEventQueue[0]->empty()) {
         setupInstCounter(0);
     } else {
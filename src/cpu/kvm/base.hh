@@ -243,8 +243,9 @@ class BaseKvmCPU : public BaseCPU
      * executed in hardware mode relative to some arbitrary point in
      * the past. It's mainly used when estimating the number of cycles
      * actually executed by the CPU in kvmRun(). The default behavior
-     * of this method is to use the cycles performance counter, but
-     * some architectures may want to use internal registers instead.
+     * of this method is to use the cycles performance counter, or the
+     * host clock if performance counters aren't used, but some
+     * architectures may want to use internal registers instead.
      *
      * @return Number of host cycles executed relative to an undefined
      * point in the past.
@@ -768,6 +769,16 @@ class BaseKvmCPU : public BaseCPU
      * exits.
      */
     bool perfControlledByTimer;
+
+    /**
+     * Are the performance counters used at all?
+     *
+     * Without them, guest cycles are derived from the host clock (see
+     * getHostCycles()), so that the CPU can run on hosts that don't
+     * expose hardware counters, e.g. virtual machines. Guest
+     * instructions aren't counted then.
+     */
+    const bool usePerf;
     /** @} */
 
     /**
@@ -781,6 +792,9 @@ class BaseKvmCPU : public BaseCPU
     /** Host factor as specified in the configuration */
     float hostFactor;
 
+    /** Clock period of the host as specified in the configuration */
+    const Tick hostFreq;
+
   public:
     /* @{ */
     Stats::Scalar numInsts;
@@ -127,6 +127,7 @@ MinorCPU::regStats()
 {
     BaseCPU::regStats();
     stats.regStats(name(), *this);
+    dynInstPool.regStats(name());
     pipeline->regStats();
 }
 
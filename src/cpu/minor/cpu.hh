@@ -49,6 +49,7 @@
 #include "cpu/minor/activity.hh"
 #include "cpu/minor/stats.hh"
 #include "cpu/base.hh"
+#include "cpu/dyn_inst_pool.hh"
 #include "cpu/simple_thread.hh"
 #include "enums/ThreadPolicy.hh"
 #include "params/MinorCPU.hh"
@@ -135,6 +136,9 @@ class MinorCPU : public BaseCPU
     /** Processor-specific statistics */
     Minor::MinorStats stats;
 
+    /** Storage for the dynamic instructions created by the pipeline */
+    DynInstPool dynInstPool;
+
     /** Stats interface from SimObject (by way of BaseCPU) */
     void regStats() override;
 
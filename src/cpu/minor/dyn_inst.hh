@@ -52,6 +52,7 @@
 
 #include "base/refcnt.hh"
 #include "cpu/minor/buffers.hh"
+#include "cpu/dyn_inst_pool.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/static_inst.hh"
 #include "cpu/timing_expr.hh"
@@ -232,6 +233,9 @@ class MinorDynInst : public RefCounted
         extraCommitDelayExpr(NULL), minimumCommitCycle(Cycles(0))
     { }
 
+    /** Allocate from the owning CPU's DynInstPool */
+    DYN_INST_POOL_ALLOCATED
+
   public:
     /** The BubbleIF interface. */
     bool isBubble() const { return id.fetchSeqNum == 0; }
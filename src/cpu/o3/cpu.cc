@@ -443,6 +443,8 @@ FullO3CPU<Impl>::regStats()
     BaseO3CPU::regStats();
 
     // Register any of the O3CPU's stats here.
+    dynInstPool.regStats(name());
+
     timesIdled
         .name(name() + ".timesIdled")
         .desc("Number of times that the entire CPU went into an idle state and"
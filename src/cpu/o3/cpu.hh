@@ -63,6 +63,7 @@
 #include "cpu/o3/thread_state.hh"
 #include "cpu/activity.hh"
 #include "cpu/base.hh"
+#include "cpu/dyn_inst_pool.hh"
 #include "cpu/simple_thread.hh"
 #include "cpu/timebuf.hh"
 //#include "cpu/o3/thread_context.hh"
@@ -555,6 +556,11 @@ class FullO3CPU : public BaseO3CPU
     void dumpInsts();
 
   public:
+    /** Storage for dynamic instructions. Declared ahead of everything that
+     *  can hold a DynInstPtr so that it is destroyed last.
+     */
+    DynInstPool dynInstPool;
+
 #ifndef NDEBUG
     /** Count of total number of dynamic instructions in flight. */
     int instcount;
@@ -51,6 +51,7 @@
 #include "cpu/o3/cpu.hh"
 #include "cpu/o3/isa_specific.hh"
 #include "cpu/base_dyn_inst.hh"
+#include "cpu/dyn_inst_pool.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/reg_class.hh"
 
@@ -88,6 +89,9 @@ class BaseO3DynInst : public BaseDynInst<Impl>
 
     ~BaseO3DynInst();
 
+    /** Allocate from the owning CPU's DynInstPool. */
+    DYN_INST_POOL_ALLOCATED
+
     /** Executes the instruction.*/
     Fault execute();
 
@@ -1084,7 +1084,8 @@ DefaultFetch<Impl>::buildInst(ThreadID tid, StaticInstPtr staticInst,
 
     // Create a new DynInst from the instruction fetched.
     DynInstPtr instruction =
-        new DynInst(staticInst, curMacroop, thisPC, nextPC, seq, cpu);
+        new (cpu->dynInstPool) DynInst(staticInst, curMacroop, thisPC,
+                                       nextPC, seq, cpu);
     instruction->setTid(tid);
 
     instruction->setASID(tid);
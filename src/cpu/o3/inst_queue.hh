@@ -45,13 +45,13 @@
 #define __CPU_O3_INST_QUEUE_HH__
 
 #include <list>
-#include <map>
-#include <queue>
+#include <utility>
 #include <vector>
 
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/o3/dep_graph.hh"
+#include "cpu/o3/ready_queue.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/op_class.hh"
 #include "cpu/timebuf.hh"
@@ -315,8 +315,15 @@ class InstructionQueue
     /** List of all the instructions in the IQ (some of which may be issued). */
     std::list<DynInstPtr> instList[Impl::MaxThreads];
 
-    /** List of instructions that are ready to be executed. */
-    std::list<DynInstPtr> instsToExecute;
+    /** Instructions that are ready to be executed, oldest first. IEW
+     *  drains this completely every cycle, so it is kept as a vector
+     *  that is consumed from instsToExecuteHead and cleared once empty;
+     *  its storage is reused from cycle to cycle.
+     */
+    std::vector<DynInstPtr> instsToExecute;
+
+    /** Index of the next instruction in instsToExecute. */
+    size_t instsToExecuteHead;
 
     /** List of instructions waiting for their DTB translation to
      *  complete (hw page table walk in progress).
@@ -331,72 +338,49 @@ class InstructionQueue
      */
     std::list<DynInstPtr> retryMemInsts;
 
-    /**
-     * Struct for comparing entries to be added to the priority queue.
-     * This gives reverse ordering to the instructions in terms of
-     * sequence numbers: the instructions with smaller sequence
-     * numbers (and hence are older) will be at the top of the
-     * priority queue.
-     */
-    struct pqCompare {
-        bool operator() (const DynInstPtr &lhs, const DynInstPtr &rhs) const
-        {
-            return lhs->seqNum > rhs->seqNum;
-        }
-    };
-
-    typedef std::priority_queue<DynInstPtr, std::vector<DynInstPtr>, pqCompare>
-    ReadyInstQueue;
-
     /** List of ready instructions, per op class.  They are separated by op
      *  class to allow for easy mapping to FUs.
      */
-    ReadyInstQueue readyInsts[Num_OpClasses];
+    ReadyInstQueue<DynInstPtr> readyInsts[Num_OpClasses];
 
-    /** List of non-speculative instructions that will be scheduled
+    /** Entry of the table of non-speculative instructions. */
+    typedef std::pair<InstSeqNum, DynInstPtr> NonSpecEntry;
+
+    /** Table of non-speculative instructions that will be scheduled
      *  once the IQ gets a signal from commit.  While it's redundant to
      *  have the key be a part of the value (the sequence number is stored
      *  inside of DynInst), when these instructions are woken up only
      *  the sequence number will be available.  Thus it is most efficient to be
-     *  able to search by the sequence number alone.
+     *  able to search by the sequence number alone.  The table is a flat
+     *  vector sorted by sequence number with storage reserved for a full IQ;
+     *  instructions arrive in program order, so insertion is an append.
      */
-    std::map<InstSeqNum, DynInstPtr> nonSpecInsts;
+    std::vector<NonSpecEntry> nonSpecInsts;
 
-    typedef typename std::map<InstSeqNum, DynInstPtr>::iterator NonSpecMapIt;
+    typedef typename std::vector<NonSpecEntry>::iterator NonSpecMapIt;
 
-    /** Entry for the list age ordering by op class. */
-    struct ListOrderEntry {
-        OpClass queueType;
-        InstSeqNum oldestInst;
-    };
+    /** Find a non-speculative instruction, or return end() if absent. */
+    NonSpecMapIt findNonSpec(InstSeqNum seq_num);
 
-    /** List that contains the age order of the oldest instruction of each
-     *  ready queue.  Used to select the oldest instruction available
-     *  among op classes.
-     *  @todo: Might be better to just move these entries around instead
-     *  of creating new ones every time the position changes due to an
-     *  instruction issuing.  Not sure std::list supports this.
+    /** Age order of the oldest instruction of each ready queue.  Used to
+     *  select the oldest instruction available among op classes.
      */
-    std::list<ListOrderEntry> listOrder;
-
-    typedef typename std::list<ListOrderEntry>::iterator ListOrderIt;
+    AgeOrderList<OpClass, Num_OpClasses> listOrder;
 
-    /** Tracks if each ready queue is on the age order list. */
-    bool queueOnList[Num_OpClasses];
-
-    /** Iterators of each ready queue.  Points to their spot in the age order
-     *  list.
+    /**
+     * Called when a ready instruction has been pushed onto its queue; this
+     * puts the queue on the age order list, or moves it towards the front
+     * if the new instruction is the oldest in the queue.
      */
-    ListOrderIt readyIt[Num_OpClasses];
-
-    /** Add an op class to the age order list. */
-    void addToOrderList(OpClass op_class);
+    void updateOrderList(OpClass op_class, const DynInstPtr &inst);
 
     /**
-     * Called when the oldest instruction has been removed from a ready queue;
-     * this places that ready queue into the proper spot in the age order list.
+     * Called when the oldest instruction has been popped from the queue at
+     * pos of the age order list; this moves the queue to its new place, or
+     * removes it if it is empty. Either way, the entry at pos afterwards
+     * is the one that used to follow it.
      */
-    void moveToYoungerInst(ListOrderIt age_order_it);
+    void popOrderList(unsigned pos);
 
     DependencyGraph<DynInstPtr> dependGraph;
 
@@ -45,6 +45,7 @@
 #ifndef __CPU_O3_INST_QUEUE_IMPL_HH__
 #define __CPU_O3_INST_QUEUE_IMPL_HH__
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -113,6 +114,13 @@ InstructionQueue<Impl>::InstructionQueue(O3CPU *cpu_ptr, IEW *iew_ptr,
     // Resize the register scoreboard.
     regScoreboard.resize(numPhysRegs);
 
+    // Allocate storage for a full IQ in the ready queues and the
+    // non-speculative table so that issuing never allocates.
+    for (int i = 0; i < Num_OpClasses; ++i)
+        readyInsts[i].init(numEntries);
+    nonSpecInsts.reserve(numEntries);
+    instsToExecute.reserve(numEntries);
+
     //Initialize Mem Dependence Units
     for (ThreadID tid = 0; tid < Impl::MaxThreads; tid++) {
         memDepUnit[tid].init(params, tid);
@@ -417,14 +425,12 @@ InstructionQueue<Impl>::resetState()
         squashedSeqNum[tid] = 0;
     }
 
-    for (int i = 0; i < Num_OpClasses; ++i) {
-        while (!readyInsts[i].empty())
-            readyInsts[i].pop();
-        queueOnList[i] = false;
-        readyIt[i] = listOrder.end();
-    }
+    for (int i = 0; i < Num_OpClasses; ++i)
+        readyInsts[i].clear();
     nonSpecInsts.clear();
     listOrder.clear();
+    instsToExecute.clear();
+    instsToExecuteHead = 0;
     deferredMemInsts.clear();
     blockedMemInsts.clear();
     retryMemInsts.clear();
@@ -636,7 +642,19 @@ InstructionQueue<Impl>::insertNonSpec(const DynInstPtr &new_inst)
 
     assert(new_inst);
 
-    nonSpecInsts[new_inst->seqNum] = new_inst;
+    // Instructions are normally inserted in program order, in which case
+    // this is an append.
+    auto ns_pos = nonSpecInsts.end();
+    while (ns_pos != nonSpecInsts.begin() &&
+           (ns_pos - 1)->first > new_inst->seqNum) {
+        --ns_pos;
+    }
+    if (ns_pos != nonSpecInsts.begin() &&
+        (ns_pos - 1)->first == new_inst->seqNum) {
+        (ns_pos - 1)->second = new_inst;
+    } else {
+        nonSpecInsts.insert(ns_pos, NonSpecEntry(new_inst->seqNum, new_inst));
+    }
 
     DPRINTF(IQ, "Adding non-speculative instruction [sn:%lli] PC %s "
             "to the IQ.\n",
@@ -681,8 +699,12 @@ typename Impl::DynInstPtr
 InstructionQueue<Impl>::getInstToExecute()
 {
     assert(!instsToExecute.empty());
-    DynInstPtr inst = std::move(instsToExecute.front());
-    instsToExecute.pop_front();
+    DynInstPtr inst = std::move(instsToExecute[instsToExecuteHead++]);
+    if (instsToExecuteHead == instsToExecute.size()) {
+        // Everything has been handed out, recycle the storage
+        instsToExecute.clear();
+        instsToExecuteHead = 0;
+    }
     if (inst->isFloating()) {
         fpInstQueueReads++;
     } else if (inst->isVector()) {
@@ -694,56 +716,45 @@ InstructionQueue<Impl>::getInstToExecute()
 }
 
 template <class Impl>
-void
-InstructionQueue<Impl>::addToOrderList(OpClass op_class)
+typename InstructionQueue<Impl>::NonSpecMapIt
+InstructionQueue<Impl>::findNonSpec(InstSeqNum seq_num)
 {
-    assert(!readyInsts[op_class].empty());
-
-    ListOrderEntry queue_entry;
-
-    queue_entry.queueType = op_class;
-
-    queue_entry.oldestInst = readyInsts[op_class].top()->seqNum;
-
-    ListOrderIt list_it = listOrder.begin();
-    ListOrderIt list_end_it = listOrder.end();
-
-    while (list_it != list_end_it) {
-        if ((*list_it).oldestInst > queue_entry.oldestInst) {
-            break;
-        }
+    auto it = std::lower_bound(nonSpecInsts.begin(), nonSpecInsts.end(),
+                               seq_num,
+                               [](const NonSpecEntry &entry, InstSeqNum sn)
+                               { return entry.first < sn; });
+    if (it != nonSpecInsts.end() && it->first != seq_num)
+        return nonSpecInsts.end();
+    return it;
+}
 
-        list_it++;
+template <class Impl>
+void
+InstructionQueue<Impl>::updateOrderList(OpClass op_class,
+                                        const DynInstPtr &inst)
+{
+    // Will need to reorder the list if either a queue is not on the list,
+    // or it has an older instruction than last time.
+    if (!listOrder.contains(op_class)) {
+        listOrder.insert(op_class, readyInsts[op_class].top()->seqNum);
+    } else if (readyInsts[op_class].top()->seqNum == inst->seqNum) {
+        // The new instruction is the oldest in its queue, so the queue's
+        // entry has to move towards the front of the age order list.
+        listOrder.remove(op_class);
+        listOrder.insert(op_class, inst->seqNum);
     }
-
-    readyIt[op_class] = listOrder.insert(list_it, queue_entry);
-    queueOnList[op_class] = true;
 }
 
 template <class Impl>
 void
-InstructionQueue<Impl>::moveToYoungerInst(ListOrderIt list_order_it)
+InstructionQueue<Impl>::popOrderList(unsigned pos)
 {
-    // Get iterator of next item on the list
-    // Delete the original iterator
-    // Determine if the next item is either the end of the list or younger
-    // than the new instruction.  If so, then add in a new iterator right here.
-    // If not, then move along.
-    ListOrderEntry queue_entry;
-    OpClass op_class = (*list_order_it).queueType;
-    ListOrderIt next_it = list_order_it;
-
-    ++next_it;
-
-    queue_entry.queueType = op_class;
-    queue_entry.oldestInst = readyInsts[op_class].top()->seqNum;
-
-    while (next_it != listOrder.end() &&
-           (*next_it).oldestInst < queue_entry.oldestInst) {
-        ++next_it;
-    }
+    OpClass op_class = listOrder.queue(pos);
 
-    readyIt[op_class] = listOrder.insert(next_it, queue_entry);
+    if (!readyInsts[op_class].empty())
+        listOrder.moveToYounger(pos, readyInsts[op_class].top()->seqNum);
+    else
+        listOrder.erase(pos);
 }
 
 template <class Impl>
@@ -798,11 +809,10 @@ InstructionQueue<Impl>::scheduleReadyInsts()
     // This will avoid trying to schedule a certain op class if there are no
     // FUs that handle it.
     int total_issued = 0;
-    ListOrderIt order_it = listOrder.begin();
-    ListOrderIt order_end_it = listOrder.end();
+    unsigned order_pos = 0;
 
-    while (total_issued < totalWidth && order_it != order_end_it) {
-        OpClass op_class = (*order_it).queueType;
+    while (total_issued < totalWidth && order_pos < listOrder.size()) {
+        OpClass op_class = listOrder.queue(order_pos);
 
         assert(!readyInsts[op_class].empty());
 
@@ -816,19 +826,12 @@ InstructionQueue<Impl>::scheduleReadyInsts()
             intInstQueueReads++;
         }
 
-        assert(issuing_inst->seqNum == (*order_it).oldestInst);
+        assert(issuing_inst->seqNum == listOrder.oldest(order_pos));
 
         if (issuing_inst->isSquashed()) {
+            // order_pos now refers to the entry that followed this one.
             readyInsts[op_class].pop();
-
-            if (!readyInsts[op_class].empty()) {
-                moveToYoungerInst(order_it);
-            } else {
-                readyIt[op_class] = listOrder.end();
-                queueOnList[op_class] = false;
-            }
-
-            listOrder.erase(order_it++);
+            popOrderList(order_pos);
 
             ++iqSquashedInstsIssued;
 
@@ -890,13 +893,7 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                     issuing_inst->seqNum);
 
             readyInsts[op_class].pop();
-
-            if (!readyInsts[op_class].empty()) {
-                moveToYoungerInst(order_it);
-            } else {
-                readyIt[op_class] = listOrder.end();
-                queueOnList[op_class] = false;
-            }
+            popOrderList(order_pos);
 
             issuing_inst->setIssued();
             ++total_issued;
@@ -915,12 +912,11 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                 memDepUnit[tid].issue(issuing_inst);
             }
 
-            listOrder.erase(order_it++);
             statIssuedInstType[tid][op_class]++;
         } else {
             statFuBusy[op_class]++;
             fuBusy[tid]++;
-            ++order_it;
+            ++order_pos;
         }
     }
 
@@ -945,7 +941,7 @@ InstructionQueue<Impl>::scheduleNonSpec(const InstSeqNum &inst)
     DPRINTF(IQ, "Marking nonspeculative instruction [sn:%lli] as ready "
             "to execute.\n", inst);
 
-    NonSpecMapIt inst_it = nonSpecInsts.find(inst);
+    NonSpecMapIt inst_it = findNonSpec(inst);
 
     assert(inst_it != nonSpecInsts.end());
 
@@ -1075,16 +1071,7 @@ InstructionQueue<Impl>::addReadyMemInst(const DynInstPtr &ready_inst)
     OpClass op_class = ready_inst->opClass();
 
     readyInsts[op_class].push(ready_inst);
-
-    // Will need to reorder the list if either a queue is not on the list,
-    // or it has an older instruction than last time.
-    if (!queueOnList[op_class]) {
-        addToOrderList(op_class);
-    } else if (readyInsts[op_class].top()->seqNum  <
-               (*readyIt[op_class]).oldestInst) {
-        listOrder.erase(readyIt[op_class]);
-        addToOrderList(op_class);
-    }
+    updateOrderList(op_class, ready_inst);
 
     DPRINTF(IQ, "Instruction is ready to issue, putting it onto "
             "the ready list, PC %s opclass:%i [sn:%lli].\n",
@@ -1288,7 +1275,7 @@ InstructionQueue<Impl>::doSquash(ThreadID tid)
             } else if (!squashed_inst->isStoreConditional() ||
                        !squashed_inst->isCompleted()) {
                 NonSpecMapIt ns_inst_it =
-                    nonSpecInsts.find(squashed_inst->seqNum);
+                    findNonSpec(squashed_inst->seqNum);
 
                 // we remove non-speculative instructions from
                 // nonSpecInsts already when they are ready, and so we
@@ -1461,16 +1448,7 @@ InstructionQueue<Impl>::addIfReady(const DynInstPtr &inst)
                 inst->pcState(), op_class, inst->seqNum);
 
         readyInsts[op_class].push(inst);
-
-        // Will need to reorder the list if either a queue is not on the list,
-        // or it has an older instruction than last time.
-        if (!queueOnList[op_class]) {
-            addToOrderList(op_class);
-        } else if (readyInsts[op_class].top()->seqNum  <
-                   (*readyIt[op_class]).oldestInst) {
-            listOrder.erase(readyIt[op_class]);
-            addToOrderList(op_class);
-        }
+        updateOrderList(op_class, inst);
     }
 }
 
@@ -1535,18 +1513,11 @@ InstructionQueue<Impl>::dumpLists()
 
     cprintf("\n");
 
-    ListOrderIt list_order_it = listOrder.begin();
-    ListOrderIt list_order_end_it = listOrder.end();
-    int i = 1;
-
     cprintf("List order: ");
 
-    while (list_order_it != list_order_end_it) {
-        cprintf("%i OpClass:%i [sn:%lli] ", i, (*list_order_it).queueType,
-                (*list_order_it).oldestInst);
-
-        ++list_order_it;
-        ++i;
+    for (unsigned i = 0; i < listOrder.size(); ++i) {
+        cprintf("%i OpClass:%i [sn:%lli] ", i + 1, listOrder.queue(i),
+                listOrder.oldest(i));
     }
 
     cprintf("\n");
@@ -1600,7 +1571,7 @@ InstructionQueue<Impl>::dumpInsts()
 
     int num = 0;
     int valid_num = 0;
-    ListIt inst_list_it = instsToExecute.begin();
+    auto inst_list_it = instsToExecute.begin() + instsToExecuteHead;
 
     while (inst_list_it != instsToExecute.end())
     {
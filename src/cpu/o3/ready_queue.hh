@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Fixed-capacity ready structures used by the O3 instruction queue to
+ * select the oldest ready instruction among op classes.
+ */
+
+#ifndef __CPU_O3_READY_QUEUE_HH__
+#define __CPU_O3_READY_QUEUE_HH__
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "cpu/inst_seq.hh"
+
+/**
+ * Ready instructions of one op class, oldest first. This is a binary
+ * min-heap on sequence number kept in storage that is allocated once for
+ * a full IQ, so pushing and popping never touch the heap allocator.
+ *
+ * Squashed instructions are only discarded when they reach the top of
+ * their queue at issue, after their IQ entries have been freed, so a
+ * queue may briefly hold more than an IQ's worth of instructions. When
+ * that happens the storage is doubled and the larger size is kept.
+ */
+template <class DynInstPtr>
+class ReadyInstQueue
+{
+  public:
+    ReadyInstQueue()
+        : count(0)
+    { }
+
+    /** Allocate storage for the given number of instructions. */
+    void
+    init(size_t capacity)
+    {
+        assert(count == 0);
+        heap.assign(capacity ? capacity : 1, DynInstPtr());
+    }
+
+    bool empty() const { return count == 0; }
+
+    size_t size() const { return count; }
+
+    size_t capacity() const { return heap.size(); }
+
+    /** The oldest instruction in the queue. */
+    const DynInstPtr &
+    top() const
+    {
+        assert(count != 0);
+        return heap[0];
+    }
+
+    void
+    push(const DynInstPtr &inst)
+    {
+        if (count == heap.size())
+            heap.resize(heap.size() * 2);
+
+        size_t pos = count++;
+        while (pos != 0) {
+            size_t parent = (pos - 1) / 2;
+            if (!older(inst, heap[parent]))
+                break;
+            heap[pos] = std::move(heap[parent]);
+            pos = parent;
+        }
+        heap[pos] = inst;
+    }
+
+    /** Remove the oldest instruction. */
+    void
+    pop()
+    {
+        assert(count != 0);
+        --count;
+        DynInstPtr last = std::move(heap[count]);
+        heap[count] = DynInstPtr();
+        if (count == 0)
+            return;
+
+        size_t pos = 0;
+        while (true) {
+            size_t child = 2 * pos + 1;
+            if (child >= count)
+                break;
+            if (child + 1 < count && older(heap[child + 1], heap[child]))
+                ++child;
+            if (!older(heap[child], last))
+                break;
+            heap[pos] = std::move(heap[child]);
+            pos = child;
+        }
+        heap[pos] = std::move(last);
+    }
+
+    /** Drop all instructions, keeping the storage. */
+    void
+    clear()
+    {
+        for (size_t i = 0; i < count; ++i)
+            heap[i] = DynInstPtr();
+        count = 0;
+    }
+
+  private:
+    static bool
+    older(const DynInstPtr &lhs, const DynInstPtr &rhs)
+    {
+        return lhs->seqNum < rhs->seqNum;
+    }
+
+    /** Heap storage; only the first count entries are valid. */
+    std::vector<DynInstPtr> heap;
+
+    /** Number of instructions in the queue. */
+    size_t count;
+};
+
+/**
+ * Age order of the ready queues: one entry per non-empty queue holding
+ * the sequence number of its oldest instruction, sorted oldest first.
+ * Each queue appears at most once, so the list lives in a fixed array
+ * and entries are shifted in place when their position changes.
+ */
+template <class QueueId, unsigned NumQueues>
+class AgeOrderList
+{
+  public:
+    AgeOrderList()
+        : _size(0)
+    {
+        onList.fill(false);
+    }
+
+    unsigned size() const { return _size; }
+
+    bool empty() const { return _size == 0; }
+
+    /** The queue at a position of the list. */
+    QueueId queue(unsigned pos) const { return entries[pos].queue; }
+
+    /** The oldest instruction of the queue at a position of the list. */
+    InstSeqNum oldest(unsigned pos) const { return entries[pos].oldest; }
+
+    /** Whether a queue is on the list. */
+    bool contains(QueueId queue) const { return onList[queue]; }
+
+    /** Add a queue whose oldest instruction is oldest to the list. */
+    void
+    insert(QueueId queue, InstSeqNum oldest)
+    {
+        assert(!onList[queue]);
+        assert(_size < NumQueues);
+
+        unsigned pos = 0;
+        while (pos < _size && entries[pos].oldest <= oldest)
+            ++pos;
+
+        for (unsigned i = _size; i > pos; --i)
+            entries[i] = entries[i - 1];
+        entries[pos].queue = queue;
+        entries[pos].oldest = oldest;
+        ++_size;
+        onList[queue] = true;
+    }
+
+    /**
+     * Remove the entry at a position of the list. The entry at pos
+     * afterwards is the one that used to follow it.
+     */
+    void
+    erase(unsigned pos)
+    {
+        assert(pos < _size);
+
+        onList[entries[pos].queue] = false;
+        for (unsigned i = pos + 1; i < _size; ++i)
+            entries[i - 1] = entries[i];
+        --_size;
+    }
+
+    /** Remove a queue from the list. */
+    void
+    remove(QueueId queue)
+    {
+        for (unsigned pos = 0; pos < _size; ++pos) {
+            if (entries[pos].queue == queue) {
+                erase(pos);
+                return;
+            }
+        }
+        assert(false);
+    }
+
+    /**
+     * Called when the oldest instruction has been removed from the queue
+     * at pos and oldest is the sequence number of its new oldest
+     * instruction; this moves the queue to its new place. Entries between
+     * the old and new position move up by one, so the entry at pos
+     * afterwards is the one that used to follow it.
+     */
+    void
+    moveToYounger(unsigned pos, InstSeqNum oldest)
+    {
+        assert(pos < _size);
+
+        QueueId queue = entries[pos].queue;
+        unsigned next = pos + 1;
+        while (next < _size && entries[next].oldest < oldest) {
+            entries[next - 1] = entries[next];
+            ++next;
+        }
+        entries[next - 1].queue = queue;
+        entries[next - 1].oldest = oldest;
+    }
+
+    void
+    clear()
+    {
+        _size = 0;
+        onList.fill(false);
+    }
+
+  private:
+    struct Entry {
+        QueueId queue;
+        InstSeqNum oldest;
+    };
+
+    /** The list; only the first _size entries are valid. */
+    std::array<Entry, NumQueues> entries;
+
+    /** Number of queues on the list. */
+    unsigned _size;
+
+    /** Tracks if each queue is on the list. */
+    std::array<bool, NumQueues> onList;
+};
+
+#endif // __CPU_O3_READY_QUEUE_HH__
@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <list>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "cpu/o3/ready_queue.hh"
+
+namespace {
+
+struct Inst
+{
+    InstSeqNum seqNum;
+    int queue;
+    bool squashed;
+};
+
+typedef Inst *InstPtr;
+
+const unsigned NumQueues = 8;
+
+/**
+ * Functional units for one cycle, shared by both selection models so
+ * that they see the same units as long as they ask for them in the same
+ * order.
+ */
+struct Units
+{
+    std::vector<int> free;
+
+    bool
+    get(int queue)
+    {
+        if (free[queue] == 0)
+            return false;
+        --free[queue];
+        return true;
+    }
+};
+
+/**
+ * The selection logic the IQ used before the fixed-capacity structures:
+ * std::priority_queue ready queues and a std::list age order with an
+ * iterator per queue.
+ */
+class ListModel
+{
+  public:
+    ListModel()
+    {
+        for (unsigned i = 0; i < NumQueues; ++i)
+            queueOnList[i] = false;
+    }
+
+    void
+    ready(InstPtr inst)
+    {
+        int q = inst->queue;
+        readyInsts[q].push(inst);
+        if (!queueOnList[q]) {
+            addToOrderList(q);
+        } else if (readyInsts[q].top()->seqNum < readyIt[q]->oldestInst) {
+            listOrder.erase(readyIt[q]);
+            addToOrderList(q);
+        }
+    }
+
+    std::vector<InstSeqNum>
+    issue(Units units, int width)
+    {
+        std::vector<InstSeqNum> issued;
+        int total_issued = 0;
+        ListOrderIt order_it = listOrder.begin();
+        while (total_issued < width && order_it != listOrder.end()) {
+            int q = order_it->queueType;
+            InstPtr inst = readyInsts[q].top();
+            bool squashed = inst->squashed;
+            if (!squashed && !units.get(q)) {
+                ++order_it;
+                continue;
+            }
+            readyInsts[q].pop();
+            if (!readyInsts[q].empty()) {
+                moveToYoungerInst(order_it);
+            } else {
+                queueOnList[q] = false;
+            }
+            listOrder.erase(order_it++);
+            if (!squashed) {
+                issued.push_back(inst->seqNum);
+                ++total_issued;
+            }
+        }
+        return issued;
+    }
+
+  private:
+    struct pqCompare {
+        bool operator() (const InstPtr &lhs, const InstPtr &rhs) const
+        {
+            return lhs->seqNum > rhs->seqNum;
+        }
+    };
+
+    struct ListOrderEntry {
+        int queueType;
+        InstSeqNum oldestInst;
+    };
+
+    typedef std::list<ListOrderEntry>::iterator ListOrderIt;
+
+    void
+    addToOrderList(int q)
+    {
+        ListOrderEntry entry = { q, readyInsts[q].top()->seqNum };
+        ListOrderIt it = listOrder.begin();
+        while (it != listOrder.end() && it->oldestInst <= entry.oldestInst)
+            ++it;
+        readyIt[q] = listOrder.insert(it, entry);
+        queueOnList[q] = true;
+    }
+
+    void
+    moveToYoungerInst(ListOrderIt it)
+    {
+        int q = it->queueType;
+        ListOrderEntry entry = { q, readyInsts[q].top()->seqNum };
+        ListOrderIt next = it;
+        ++next;
+        while (next != listOrder.end() &&
+               next->oldestInst < entry.oldestInst) {
+            ++next;
+        }
+        readyIt[q] = listOrder.insert(next, entry);
+    }
+
+    std::priority_queue<InstPtr, std::vector<InstPtr>, pqCompare>
+        readyInsts[NumQueues];
+    std::list<ListOrderEntry> listOrder;
+    ListOrderIt readyIt[NumQueues];
+    bool queueOnList[NumQueues];
+};
+
+/** The same selection on top of ReadyInstQueue and AgeOrderList. */
+class ArrayModel
+{
+  public:
+    explicit ArrayModel(size_t capacity)
+    {
+        for (unsigned i = 0; i < NumQueues; ++i)
+            readyInsts[i].init(capacity);
+    }
+
+    void
+    ready(InstPtr inst)
+    {
+        int q = inst->queue;
+        readyInsts[q].push(inst);
+        if (!listOrder.contains(q)) {
+            listOrder.insert(q, readyInsts[q].top()->seqNum);
+        } else if (readyInsts[q].top()->seqNum == inst->seqNum) {
+            listOrder.remove(q);
+            listOrder.insert(q, inst->seqNum);
+        }
+    }
+
+    std::vector<InstSeqNum>
+    issue(Units units, int width)
+    {
+        std::vector<InstSeqNum> issued;
+        int total_issued = 0;
+        unsigned pos = 0;
+        while (total_issued < width && pos < listOrder.size()) {
+            int q = listOrder.queue(pos);
+            InstPtr inst = readyInsts[q].top();
+            EXPECT_EQ(inst->seqNum, listOrder.oldest(pos));
+            bool squashed = inst->squashed;
+            if (!squashed && !units.get(q)) {
+                ++pos;
+                continue;
+            }
+            readyInsts[q].pop();
+            if (!readyInsts[q].empty())
+                listOrder.moveToYounger(pos, readyInsts[q].top()->seqNum);
+            else
+                listOrder.erase(pos);
+            if (!squashed) {
+                issued.push_back(inst->seqNum);
+                ++total_issued;
+            }
+        }
+        return issued;
+    }
+
+    ReadyInstQueue<InstPtr> readyInsts[NumQueues];
+    AgeOrderList<int, NumQueues> listOrder;
+};
+
+} // anonymous namespace
+
+TEST(ReadyInstQueueTest, PopsOldestFirst)
+{
+    std::mt19937 rng(1);
+    std::vector<Inst> insts(100);
+    for (unsigned i = 0; i < insts.size(); ++i)
+        insts[i].seqNum = i + 1;
+    std::vector<InstPtr> order;
+    for (auto &inst : insts)
+        order.push_back(&inst);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    ReadyInstQueue<InstPtr> queue;
+    queue.init(16);
+    for (auto inst : order)
+        queue.push(inst);
+
+    // Pushing more than the initial capacity grows the storage.
+    EXPECT_EQ(queue.size(), insts.size());
+    EXPECT_GE(queue.capacity(), insts.size());
+
+    for (unsigned i = 0; i < insts.size(); ++i) {
+        ASSERT_FALSE(queue.empty());
+        EXPECT_EQ(queue.top()->seqNum, i + 1);
+        queue.pop();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ReadyInstQueueTest, ClearKeepsStorage)
+{
+    Inst a = { 2, 0, false }, b = { 1, 0, false };
+    ReadyInstQueue<InstPtr> queue;
+    queue.init(4);
+    queue.push(&a);
+    queue.push(&b);
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.capacity(), 4);
+
+    queue.push(&a);
+    EXPECT_EQ(queue.top(), &a);
+}
+
+TEST(AgeOrderListTest, InsertRemoveAndMove)
+{
+    AgeOrderList<int, 4> list;
+    list.insert(2, 30);
+    list.insert(0, 10);
+    list.insert(1, 20);
+    ASSERT_EQ(list.size(), 3);
+    EXPECT_EQ(list.queue(0), 0);
+    EXPECT_EQ(list.queue(1), 1);
+    EXPECT_EQ(list.queue(2), 2);
+    EXPECT_TRUE(list.contains(1));
+    EXPECT_FALSE(list.contains(3));
+
+    // Queue 0's new oldest instruction is younger than queue 1's but
+    // older than queue 2's; the entry at 0 is then queue 1.
+    list.moveToYounger(0, 25);
+    EXPECT_EQ(list.queue(0), 1);
+    EXPECT_EQ(list.queue(1), 0);
+    EXPECT_EQ(list.oldest(1), 25);
+    EXPECT_EQ(list.queue(2), 2);
+
+    list.remove(0);
+    EXPECT_FALSE(list.contains(0));
+    ASSERT_EQ(list.size(), 2);
+    EXPECT_EQ(list.queue(0), 1);
+    EXPECT_EQ(list.queue(1), 2);
+
+    list.erase(0);
+    EXPECT_FALSE(list.contains(1));
+    EXPECT_EQ(list.queue(0), 2);
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(list.contains(2));
+}
+
+/**
+ * Drive both selection models with the same randomised sequences of
+ * instructions becoming ready, being squashed and issuing against busy
+ * functional units, and check that they issue the same instructions in
+ * the same order.
+ */
+TEST(AgeOrderListTest, MatchesListSelection)
+{
+    const unsigned num_insts = 20000;
+    const size_t iq_size = 64;
+
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> queue_dist(0, NumQueues - 1);
+        std::uniform_int_distribution<int> percent(0, 99);
+        std::uniform_int_distribution<int> units_dist(0, 2);
+        std::uniform_int_distribution<int> width_dist(1, 8);
+
+        std::vector<Inst> insts(num_insts);
+        for (unsigned i = 0; i < num_insts; ++i) {
+            insts[i].seqNum = i + 1;
+            insts[i].queue = queue_dist(rng);
+            insts[i].squashed = false;
+        }
+
+        ListModel list_model;
+        ArrayModel array_model(iq_size);
+
+        // Instructions in flight become ready out of order.
+        std::vector<InstPtr> waiting;
+        std::vector<InstPtr> ready;
+        unsigned next = 0;
+        unsigned total_issued = 0;
+
+        while (next < num_insts || !waiting.empty()) {
+            while (next < num_insts && waiting.size() < iq_size)
+                waiting.push_back(&insts[next++]);
+
+            std::shuffle(waiting.begin(), waiting.end(), rng);
+            size_t num_ready = std::min<size_t>(waiting.size(),
+                                                units_dist(rng) * 3);
+            for (size_t i = 0; i < num_ready; ++i) {
+                InstPtr inst = waiting.back();
+                waiting.pop_back();
+                list_model.ready(inst);
+                array_model.ready(inst);
+                ready.push_back(inst);
+            }
+
+            // Occasionally squash some ready instructions that have not
+            // issued yet; both models discard them when they reach the top
+            // of their queue.
+            if (percent(rng) < 5) {
+                for (auto inst : ready) {
+                    if (percent(rng) < 30)
+                        inst->squashed = true;
+                }
+            }
+
+            Units units;
+            for (unsigned q = 0; q < NumQueues; ++q)
+                units.free.push_back(units_dist(rng));
+            int width = width_dist(rng);
+
+            std::vector<InstSeqNum> expected = list_model.issue(units, width);
+            std::vector<InstSeqNum> actual = array_model.issue(units, width);
+            ASSERT_EQ(expected, actual) << "seed " << seed;
+            total_issued += actual.size();
+
+            ready.erase(std::remove_if(ready.begin(), ready.end(),
+                            [](InstPtr inst) { return inst->squashed; }),
+                        ready.end());
+        }
+
+        // Drain what is left.
+        while (!array_model.listOrder.empty()) {
+            Units units;
+            units.free.assign(NumQueues, 1);
+            std::vector<InstSeqNum> expected = list_model.issue(units, 8);
+            std::vector<InstSeqNum> actual = array_model.issue(units, 8);
+            ASSERT_EQ(expected, actual) << "seed " << seed;
+            total_issued += actual.size();
+        }
+        EXPECT_GT(total_issued, num_insts / 2);
+    }
+}
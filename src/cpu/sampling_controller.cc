@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Statistical sampling controller.
+ */
+
+#include "cpu/sampling_controller.hh"
+
+#include <cmath>
+
+#include "base/logging.hh"
+#include "cpu/base.hh"
+
+SamplingController::SamplingController(const Params *p)
+    : SimObject(p), cpus(p->cpus), minSamples(p->min_samples),
+      maxSamples(p->max_samples), zScore(p->z_score),
+      targetError(p->target_error), inWindow(false),
+      startCycles(cpus.size()), startInsts(cpus.size()),
+      numSamples(0), mean(0), m2(0)
+{
+    fatal_if(cpus.empty(), "%s: no CPUs to sample\n", name());
+    fatal_if(maxSamples < 2, "%s: need at least two samples for a "
+             "confidence interval\n", name());
+}
+
+void
+SamplingController::beginWindow()
+{
+    panic_if(inWindow, "%s: window already open\n", name());
+    inWindow = true;
+
+    for (size_t i = 0; i < cpus.size(); ++i) {
+        startCycles[i] = cpus[i]->curCycle();
+        startInsts[i] = cpus[i]->totalInsts();
+    }
+}
+
+void
+SamplingController::endWindow()
+{
+    panic_if(!inWindow, "%s: no window open\n", name());
+    inWindow = false;
+
+    Counter insts = 0;
+    Cycles cycles(0);
+    for (size_t i = 0; i < cpus.size(); ++i) {
+        insts += cpus[i]->totalInsts() - startInsts[i];
+        cycles += cpus[i]->curCycle() - startCycles[i];
+    }
+
+    // The workload may have ended right at the start of the window
+    if (insts == 0)
+        return;
+
+    windowInsts += insts;
+    windowCycles += cycles;
+
+    const double cpi = double(cycles) / insts;
+    ++numSamples;
+    const double delta = cpi - mean;
+    mean += delta / numSamples;
+    m2 += delta * (cpi - mean);
+}
+
+bool
+SamplingController::done() const
+{
+    if (numSamples >= maxSamples)
+        return true;
+    if (numSamples < minSamples || numSamples < 2 || targetError <= 0)
+        return false;
+    return cpiRelError() <= targetError;
+}
+
+double
+SamplingController::cpiStdev() const
+{
+    return numSamples < 2 ? 0 : std::sqrt(m2 / (numSamples - 1));
+}
+
+double
+SamplingController::cpiHalfWidth() const
+{
+    return numSamples < 2 ? 0 : zScore * cpiStdev() / std::sqrt(numSamples);
+}
+
+double
+SamplingController::cpiRelError() const
+{
+    return mean == 0 ? 0 : cpiHalfWidth() / mean;
+}
+
+void
+SamplingController::regStats()
+{
+    SimObject::regStats();
+
+    windowInsts
+        .name(name() + ".windowInsts")
+        .desc("Instructions committed in measurement windows");
+
+    windowCycles
+        .name(name() + ".windowCycles")
+        .desc("Cycles spent in measurement windows");
+
+    statSamples
+        .method(this, &SamplingController::samples)
+        .name(name() + ".samples")
+        .desc("Number of measurement windows");
+
+    statCpi
+        .method(this, &SamplingController::cpiMean)
+        .name(name() + ".cpi")
+        .desc("Mean CPI over all measurement windows");
+
+    statCpiStdev
+        .method(this, &SamplingController::cpiStdev)
+        .name(name() + ".cpiStdev")
+        .desc("Standard deviation of the per-window CPI");
+
+    statCpiHalfWidth
+        .method(this, &SamplingController::cpiHalfWidth)
+        .name(name() + ".cpiConfidence")
+        .desc("Half-width of the confidence interval of the mean CPI");
+
+    statCpiRelError
+        .method(this, &SamplingController::cpiRelError)
+        .name(name() + ".cpiRelError")
+        .desc("Confidence interval half-width relative to the mean CPI");
+}
+
+SamplingController *
+SamplingControllerParams::create()
+{
+    return new SamplingController(this);
+}
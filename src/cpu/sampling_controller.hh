@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Statistical sampling controller.
+ *
+ * Implements the measurement side of SMARTS-style sampling: the
+ * configuration script (see configs/common/Simulation.py) alternates
+ * functional warming on a fast CPU, which keeps the caches and the
+ * shared branch predictor warm, with short detailed windows. Around each
+ * window it calls beginWindow()/endWindow(), and the controller records
+ * the window's CPI as one sample. Sampling stops once the confidence
+ * interval of the mean CPI is within the requested relative error, or
+ * the sample budget has been used up.
+ */
+
+#ifndef __CPU_SAMPLING_CONTROLLER_HH__
+#define __CPU_SAMPLING_CONTROLLER_HH__
+
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "params/SamplingController.hh"
+#include "sim/sim_object.hh"
+
+class BaseCPU;
+
+class SamplingController : public SimObject
+{
+  public:
+    typedef SamplingControllerParams Params;
+
+    SamplingController(const Params *p);
+
+    /** Start a measurement window on the detailed CPUs. */
+    void beginWindow();
+
+    /** End the current window and record its CPI as a sample. */
+    void endWindow();
+
+    /**
+     * Check if sampling can stop, either because the confidence target
+     * has been met or because max_samples windows have been measured.
+     */
+    bool done() const;
+
+    /** Number of windows measured so far. */
+    unsigned samples() const { return numSamples; }
+
+    /** Mean CPI over all windows. */
+    double cpiMean() const { return mean; }
+
+    /** Sample standard deviation of the per-window CPI. */
+    double cpiStdev() const;
+
+    /** Half-width of the confidence interval of the mean CPI. */
+    double cpiHalfWidth() const;
+
+    /** Half-width of the confidence interval relative to the mean. */
+    double cpiRelError() const;
+
+    void regStats() override;
+
+  private:
+    const std::vector<BaseCPU *> cpus;
+    const unsigned minSamples;
+    const unsigned maxSamples;
+    const double zScore;
+    const double targetError;
+
+    /** Whether beginWindow() has been called without endWindow(). */
+    bool inWindow;
+
+    /** Per-CPU cycle and instruction counts at the start of a window. */
+    std::vector<Cycles> startCycles;
+    std::vector<Counter> startInsts;
+
+    /** Running mean and squared deviation (Welford's method). @{ */
+    unsigned numSamples;
+    double mean;
+    double m2;
+    /** @} */
+
+    Stats::Scalar windowInsts;
+    Stats::Scalar windowCycles;
+    Stats::Value statSamples;
+    Stats::Value statCpi;
+    Stats::Value statCpiStdev;
+    Stats::Value statCpiHalfWidth;
+    Stats::Value statCpiRelError;
+};
+
+#endif // __CPU_SAMPLING_CONTROLLER_HH__
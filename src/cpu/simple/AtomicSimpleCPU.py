@@ -61,8 +61,19 @@ class AtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    memory_backdoor = Param.Bool(False, "Access memory directly through a "
+        "host pointer when no caches or snoopers are in the way "
+        "(bypasses memory stats)")
+    block_cache = Param.Bool(False, "Execute straight-line code that was "
+        "decoded before without fetching and decoding it again (skips its "
+        "instruction fetches; relies on snooping to see writes to code)")
+    block_cache_size = Param.Unsigned(65536, "Maximum number of "
+        "instructions in the block cache of each thread")
 
-    def addSimPointProbe(self, interval):
+    def addSimPointProbe(self, interval, clusters=0):
         simpoint = SimPoint()
         simpoint.interval = interval
+        if clusters:
+            simpoint.clusters = clusters
+            simpoint.checkpoint_representatives = True
         self.probeListener = simpoint
@@ -52,6 +52,7 @@
 #include "debug/Drain.hh"
 #include "debug/ExecFaulting.hh"
 #include "debug/SimpleCPU.hh"
+#include "mem/abstract_mem.hh"
 #include "mem/packet.hh"
 #include "mem/packet_access.hh"
 #include "mem/physical.hh"
@@ -81,6 +82,7 @@ AtomicSimpleCPU::AtomicSimpleCPU(AtomicSimpleCPUParams *p)
       width(p->width), locked(false),
       simulate_data_stalls(p->simulate_data_stalls),
       simulate_inst_stalls(p->simulate_inst_stalls),
+      memoryBackdoor(p->memory_backdoor),
       icachePort(name() + ".icache_port", this),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
@@ -90,6 +92,14 @@ AtomicSimpleCPU::AtomicSimpleCPU(AtomicSimpleCPUParams *p)
     ifetch_req = std::make_shared<Request>();
     data_read_req = std::make_shared<Request>();
     data_write_req = std::make_shared<Request>();
+
+    if (p->block_cache) {
+        if (simulate_inst_stalls)
+            fatal("%s: block_cache skips the instruction fetches that "
+                  "simulate_inst_stalls accounts for.\n", name());
+        for (ThreadID tid = 0; tid < numThreads; tid++)
+            blockCaches.emplace_back(new BlockCache(p->block_cache_size));
+    }
 }
 
 
@@ -150,6 +160,11 @@ AtomicSimpleCPU::drainResume()
     DPRINTF(SimpleCPU, "Resume\n");
     verifyMemoryMode();
 
+    // the memory system may have been reconfigured while drained
+    invalidateBackdoors();
+    // and memory may have been written without the CPU snooping it
+    clearBlocks();
+
     assert(!threadContexts.empty());
 
     _status = BaseSimpleCPU::Idle;
@@ -198,6 +213,8 @@ AtomicSimpleCPU::switchOut()
     assert(!tickEvent.scheduled());
     assert(_status == BaseSimpleCPU::Running || _status == Idle);
     assert(isDrained());
+
+    invalidateBackdoors();
 }
 
 
@@ -208,6 +225,9 @@ AtomicSimpleCPU::takeOverFrom(BaseCPU *oldCPU)
 
     // The tick event should have been descheduled by drain()
     assert(!tickEvent.scheduled());
+
+    invalidateBackdoors();
+    clearBlocks();
 }
 
 void
@@ -274,9 +294,55 @@ AtomicSimpleCPU::suspendContext(ThreadID thread_num)
 Tick
 AtomicSimpleCPU::sendPacket(MasterPort &port, const PacketPtr &pkt)
 {
+    if (memoryBackdoor) {
+        if (&port == &icachePort) {
+            if (!simulate_inst_stalls &&
+                tryBackdoorAccess(port, icacheBackdoor, pkt))
+                return 0;
+        } else if (!simulate_data_stalls &&
+                   tryBackdoorAccess(port, dcacheBackdoor, pkt)) {
+            return 0;
+        }
+    }
+
     return port.sendAtomic(pkt);
 }
 
+bool
+AtomicSimpleCPU::tryBackdoorAccess(MasterPort &port, MemBackdoor &backdoor,
+                                   const PacketPtr &pkt)
+{
+    // only plain reads and writes, anything else has side effects in
+    // the memory (LL/SC tracking, swaps) or may target a device
+    const bool is_read = pkt->cmd == MemCmd::ReadReq;
+    if (!is_read && pkt->cmd != MemCmd::WriteReq)
+        return false;
+    if (pkt->req->isUncacheable())
+        return false;
+
+    const Addr addr = pkt->getAddr();
+    const unsigned size = pkt->getSize();
+    if (!backdoor.covers(addr, size)) {
+        // keep the old backdoor if this is a one-off access elsewhere
+        MemBackdoor fresh;
+        if (!port.getBackdoor(addr, fresh) || !fresh.covers(addr, size))
+            return false;
+        backdoor = fresh;
+    }
+
+    if (is_read) {
+        pkt->setData(backdoor.hostAddr(addr));
+    } else {
+        // a direct write would not clear load-locked reservations
+        if (backdoor.mem->hasLockedAddrs())
+            return false;
+        pkt->writeData(backdoor.hostAddr(addr));
+    }
+
+    pkt->makeResponse();
+    return true;
+}
+
 Tick
 AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
 {
@@ -302,6 +368,7 @@ AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
         for (auto &t_info : cpu->threadInfo) {
             TheISA::handleLockedSnoop(t_info->thread, pkt, cacheBlockMask);
         }
+        cpu->invalidateBlocks(pkt->getAddr(), pkt->getSize());
     }
 
     return 0;
@@ -329,6 +396,10 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
             TheISA::handleLockedSnoop(t_info->thread, pkt, cacheBlockMask);
         }
     }
+
+    // functional writes, e.g. by system calls, may change code
+    if (pkt->isInvalidate() || pkt->isWrite())
+        cpu->invalidateBlocks(pkt->getAddr(), pkt->getSize());
 }
 
 Fault
@@ -489,6 +560,9 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
 
                     // Notify other threads on this CPU of write
                     threadSnoop(&pkt, curThread);
+
+                    // Self-modifying code is decoded again
+                    invalidateBlocks(req->getPaddr(), req->getSize());
                 }
                 dcache_access = true;
                 assert(!pkt.isError());
@@ -554,6 +628,8 @@ AtomicSimpleCPU::tick()
 
     SimpleExecContext& t_info = *threadInfo[curThread];
     SimpleThread* thread = t_info.thread;
+    BlockCache *block_cache =
+        blockCaches.empty() ? nullptr : blockCaches[curThread].get();
 
     Tick latency = 0;
 
@@ -578,11 +654,27 @@ AtomicSimpleCPU::tick()
 
         bool needToFetch = !isRomMicroPC(pcState.microPC()) &&
                            !curMacroStaticInst;
+        // Straight-line code that was decoded before is neither fetched
+        // nor decoded again
+        const BlockCache::Inst *cached = nullptr;
+        if (needToFetch && block_cache) {
+            cached = block_cache->next(pcState,
+                                       thread->decoder.contextVersion());
+            needToFetch = !cached;
+        }
         if (needToFetch) {
             ifetch_req->taskId(taskId());
             setupFetchRequest(ifetch_req);
             fault = thread->itb->translateAtomic(ifetch_req, thread->getTC(),
                                                  BaseTLB::Execute);
+
+            if (fault == NoFault && block_cache && t_info.fetchOffset == 0 &&
+                !ifetch_req->isUncacheable()) {
+                cached = block_cache->enter(
+                    ifetch_req->getPaddr() + (pcState.instAddr() & ~PCMask),
+                    pcState, thread->decoder.contextVersion());
+                needToFetch = !cached;
+            }
         }
 
         if (fault == NoFault) {
@@ -611,7 +703,18 @@ AtomicSimpleCPU::tick()
                 //}
             }
 
-            preExecute();
+            preExecute(cached);
+
+            if (needToFetch && block_cache && !t_info.stayAtPC) {
+                // Only instructions whose bytes were all fetched from the
+                // page of the block are added to it
+                Addr last_byte = (pcState.instAddr() & PCMask) +
+                    t_info.fetchOffset + sizeof(MachInst) - 1;
+                block_cache->record(pcState, thread->pcState(),
+                    curMacroStaticInst ? curMacroStaticInst : curStaticInst,
+                    roundDown(last_byte, PageBytes) ==
+                    roundDown(pcState.instAddr(), PageBytes));
+            }
 
             Tick stall_ticks = 0;
             if (curStaticInst) {
@@ -658,6 +761,10 @@ AtomicSimpleCPU::tick()
             }
 
         }
+        // A fault may change the address space, so the next instruction
+        // is translated again
+        if (fault != NoFault && block_cache)
+            block_cache->leave();
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
     }
@@ -673,6 +780,33 @@ AtomicSimpleCPU::tick()
         reschedule(tickEvent, curTick() + latency, true);
 }
 
+void
+AtomicSimpleCPU::regStats()
+{
+    BaseSimpleCPU::regStats();
+
+    for (ThreadID tid = 0; tid < blockCaches.size(); tid++) {
+        std::string thread_str = name();
+        if (numThreads > 1)
+            thread_str += ".thread" + std::to_string(tid);
+
+        BlockCache &block_cache = *blockCaches[tid];
+        block_cache.hits
+            .name(thread_str + ".block_cache.hits")
+            .desc("Number of decoded blocks that were executed again")
+            ;
+        block_cache.misses
+            .name(thread_str + ".block_cache.misses")
+            .desc("Number of blocks that were decoded")
+            ;
+        block_cache.invalidations
+            .name(thread_str + ".block_cache.invalidations")
+            .desc("Number of decoded blocks dropped because their page "
+                  "was written")
+            ;
+    }
+}
+
 void
 AtomicSimpleCPU::regProbePoints()
 {
@@ -43,8 +43,13 @@
 #ifndef __CPU_SIMPLE_ATOMIC_HH__
 #define __CPU_SIMPLE_ATOMIC_HH__
 
+#include <memory>
+#include <vector>
+
 #include "cpu/simple/base.hh"
+#include "cpu/simple/block_cache.hh"
 #include "cpu/simple/exec_context.hh"
+#include "mem/backdoor.hh"
 #include "mem/request.hh"
 #include "params/AtomicSimpleCPU.hh"
 #include "sim/probe/probe.hh"
@@ -66,6 +71,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     bool locked;
     const bool simulate_data_stalls;
     const bool simulate_inst_stalls;
+    const bool memoryBackdoor;
 
     // main simulation loop (one cycle)
     void tick();
@@ -105,6 +111,47 @@ class AtomicSimpleCPU : public BaseSimpleCPU
 
     virtual Tick sendPacket(MasterPort &port, const PacketPtr &pkt);
 
+    /**
+     * Perform a plain read or write directly on host memory if the
+     * memory behind the port has granted a backdoor. Accesses with
+     * side effects (LL/SC, swaps, uncacheable, prefetches) and ports
+     * whose stall cycles are simulated always take the normal path.
+     *
+     * @return true if the access was completed through the backdoor.
+     */
+    bool tryBackdoorAccess(MasterPort &port, MemBackdoor &backdoor,
+                           const PacketPtr &pkt);
+
+    /**
+     * Decoded blocks of each thread, if the CPU executes straight-line
+     * code without fetching and decoding it again.
+     */
+    std::vector<std::unique_ptr<BlockCache>> blockCaches;
+
+    /** Drop the decoded blocks of all threads that a write may change. */
+    void
+    invalidateBlocks(Addr paddr, Addr size)
+    {
+        for (auto &block_cache : blockCaches)
+            block_cache->invalidate(paddr, size);
+    }
+
+    /** Drop all decoded blocks, e.g. after the memory system changed. */
+    void
+    clearBlocks()
+    {
+        for (auto &block_cache : blockCaches)
+            block_cache->clear();
+    }
+
+    /** Forget all cached backdoors, e.g. after the memory system changed. */
+    void
+    invalidateBackdoors()
+    {
+        icacheBackdoor.invalidate();
+        dcacheBackdoor.invalidate();
+    }
+
     /**
      * An AtomicCPUPort overrides the default behaviour of the
      * recvAtomicSnoop and ignores the packet instead of panicking. It
@@ -159,6 +206,9 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     AtomicCPUPort icachePort;
     AtomicCPUDPort dcachePort;
 
+    /** Most recently granted backdoor per port. */
+    MemBackdoor icacheBackdoor;
+    MemBackdoor dcacheBackdoor;
 
     RequestPtr ifetch_req;
     RequestPtr data_read_req;
@@ -203,6 +253,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     Fault writeMem(uint8_t *data, unsigned size,
                    Addr addr, Request::Flags flags, uint64_t *res) override;
 
+    void regStats() override;
     void regProbePoints() override;
 
     /**
@@ -52,6 +52,7 @@
 #include "cpu/checker/cpu.hh"
 #include "cpu/exec_context.hh"
 #include "cpu/pc_event.hh"
+#include "cpu/simple/block_cache.hh"
 #include "cpu/simple_thread.hh"
 #include "cpu/static_inst.hh"
 #include "mem/packet.hh"
@@ -130,7 +131,13 @@ class BaseSimpleCPU : public BaseCPU
 
     void checkForInterrupts();
     void setupFetchRequest(const RequestPtr &req);
-    void preExecute();
+    /**
+     * Decode the current instruction and prepare it for execution.
+     *
+     * @param cached The instruction at the current PC state if it was
+     *        found in a BlockCache, in which case it isn't decoded again.
+     */
+    void preExecute(const BlockCache::Inst *cached = nullptr);
     void postExecute();
     void advancePC(const Fault &fault);
 
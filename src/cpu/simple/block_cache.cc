@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A cache of decoded basic blocks for the simple CPUs.
+ */
+
+#include "cpu/simple/block_cache.hh"
+
+namespace {
+
+/** Whether a block has to end after an instruction or micro-op */
+bool
+endsBlock(const StaticInst &inst)
+{
+    return inst.isControl() || inst.isSerializing() ||
+        inst.isNonSpeculative() || inst.isSquashAfter() ||
+        inst.isSyscall() || inst.isQuiesce() || inst.isIprAccess();
+}
+
+/** Whether a block has to end after an instruction or any of its micro-ops */
+bool
+endsBlock(const StaticInstPtr &inst)
+{
+    if (endsBlock(*inst))
+        return true;
+    if (!inst->isMacroop())
+        return false;
+
+    for (MicroPC upc = 0; ; ++upc) {
+        StaticInstPtr microop = inst->fetchMicroop(upc);
+        if (endsBlock(*microop))
+            return true;
+        if (microop->isLastMicroop())
+            return false;
+    }
+}
+
+} // anonymous namespace
+
+BlockCache::BlockCache(size_t max_insts)
+    : current(nullptr), index(0), numInsts(0), maxInsts(max_insts)
+{
+}
+
+const BlockCache::Inst *
+BlockCache::enter(Addr paddr, const TheISA::PCState &pc, uint64_t context)
+{
+    if (current && !current->complete) {
+        // Keep recording if the instruction follows the last one in the
+        // same page
+        if (current->insts.empty() ? paddr == current->paddr :
+            pageOf(paddr) == pageOf(current->paddr) &&
+            current->context == context &&
+            pc.instAddr() == current->insts.back().decodedPC.nextInstAddr()) {
+            return nullptr;
+        }
+    }
+    leave();
+
+    auto it = blocks.find(paddr);
+    if (it == blocks.end()) {
+        if (numInsts >= maxInsts)
+            clear();
+        it = blocks.emplace(paddr, Block()).first;
+        it->second.paddr = paddr;
+        pages[pageOf(paddr)].push_back(paddr);
+    } else {
+        Block &block = it->second;
+        if (block.context == context && !block.insts.empty() &&
+            block.insts[0].pc == pc) {
+            ++hits;
+            current = &block;
+            index = 1;
+            return &block.insts[0];
+        }
+        // Decoded in another context, record it again
+        numInsts -= block.insts.size();
+        block.insts.clear();
+    }
+
+    ++misses;
+    current = &it->second;
+    current->context = context;
+    current->complete = false;
+    index = 0;
+    return nullptr;
+}
+
+void
+BlockCache::record(const TheISA::PCState &pc,
+                   const TheISA::PCState &decoded_pc,
+                   const StaticInstPtr &inst, bool in_page)
+{
+    if (!current || current->complete || index != current->insts.size())
+        return;
+    if (!in_page) {
+        leave();
+        return;
+    }
+
+    current->insts.push_back(Inst{pc, decoded_pc, inst});
+    ++index;
+    ++numInsts;
+    if (endsBlock(inst))
+        leave();
+}
+
+void
+BlockCache::invalidatePage(Addr page)
+{
+    auto page_it = pages.find(page);
+    if (page_it == pages.end())
+        return;
+
+    for (Addr paddr : page_it->second) {
+        auto it = blocks.find(paddr);
+        if (&it->second == current)
+            current = nullptr;
+        numInsts -= it->second.insts.size();
+        blocks.erase(it);
+        ++invalidations;
+    }
+    pages.erase(page_it);
+}
+
+void
+BlockCache::clear()
+{
+    blocks.clear();
+    pages.clear();
+    current = nullptr;
+    index = 0;
+    numInsts = 0;
+}
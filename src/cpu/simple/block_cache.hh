@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A cache of decoded basic blocks for the simple CPUs.
+ *
+ * A block is a sequence of decoded instructions that follow each other in
+ * memory. It is found by the physical address of its first instruction and
+ * ends at the first instruction that may change the control flow or the
+ * decoding context, e.g. branches, system calls and serializing
+ * instructions, or at the end of a page. Macro-ops are stored as such, as
+ * fetching their micro-ops doesn't involve the decoder.
+ *
+ * Each instruction is stored with the PC state it was decoded at, and it
+ * is only used again if the thread is at exactly that PC state and the
+ * decoding context of the thread's decoder hasn't changed. Writes to a
+ * page drop the blocks in it, so that self-modifying code is decoded
+ * again.
+ */
+
+#ifndef __CPU_SIMPLE_BLOCK_CACHE_HH__
+#define __CPU_SIMPLE_BLOCK_CACHE_HH__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "arch/isa_traits.hh"
+#include "arch/types.hh"
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+
+class BlockCache
+{
+  public:
+    struct Inst
+    {
+        /** The PC state that the instruction was decoded at */
+        TheISA::PCState pc;
+        /** The PC state that the decoder left the thread in */
+        TheISA::PCState decodedPC;
+        StaticInstPtr staticInst;
+    };
+
+    /**
+     * @param max_insts The maximum number of instructions to hold before
+     *        the whole cache is flushed.
+     */
+    BlockCache(size_t max_insts);
+
+    /**
+     * The next instruction of the block that the thread is executing, if
+     * the thread is at the PC state it was decoded at. Leaves the block
+     * otherwise, unless it is still being recorded.
+     */
+    const Inst *
+    next(const TheISA::PCState &pc, uint64_t context)
+    {
+        if (!current)
+            return nullptr;
+        if (index < current->insts.size()) {
+            const Inst &inst = current->insts[index];
+            if (current->context == context && inst.pc == pc) {
+                ++index;
+                return &inst;
+            }
+        } else if (!current->complete) {
+            return nullptr;
+        }
+        leave();
+        return nullptr;
+    }
+
+    /**
+     * Start executing the block at paddr, the physical address of the
+     * instruction at PC state pc, and return its first instruction. If there
+     * is no valid block, or the thread is recording a block that the
+     * instruction continues, start or continue recording instead and
+     * return nullptr.
+     */
+    const Inst *enter(Addr paddr, const TheISA::PCState &pc,
+                      uint64_t context);
+
+    /**
+     * Add an instruction to the block that is being recorded.
+     *
+     * @param pc The PC state the instruction was decoded at.
+     * @param decoded_pc The PC state after decoding it.
+     * @param inst The instruction or macro-op.
+     * @param in_page Whether all its bytes are in the page of the block.
+     */
+    void record(const TheISA::PCState &pc, const TheISA::PCState &decoded_pc,
+                const StaticInstPtr &inst, bool in_page);
+
+    /** Stop following or recording a block, e.g. after a fault. */
+    void
+    leave()
+    {
+        if (current)
+            current->complete = true;
+        current = nullptr;
+    }
+
+    /** Drop the blocks in the pages that overlap [paddr, paddr + size). */
+    void
+    invalidate(Addr paddr, Addr size)
+    {
+        if (pages.empty() || size == 0)
+            return;
+        for (Addr page = pageOf(paddr); page <= pageOf(paddr + size - 1);
+             page += TheISA::PageBytes) {
+            invalidatePage(page);
+        }
+    }
+
+    /** Drop all blocks. */
+    void clear();
+
+    /** Blocks that were found valid by enter() */
+    Stats::Scalar hits;
+    /** Blocks that were recorded */
+    Stats::Scalar misses;
+    /** Blocks that were dropped because of writes to their page */
+    Stats::Scalar invalidations;
+
+  protected:
+    struct Block
+    {
+        Addr paddr;
+        /** The decoding context the block was recorded in */
+        uint64_t context;
+        std::vector<Inst> insts;
+        /** Whether the block has ended */
+        bool complete;
+    };
+
+    static Addr
+    pageOf(Addr paddr)
+    {
+        return paddr & ~(TheISA::PageBytes - 1);
+    }
+
+    void invalidatePage(Addr page);
+
+    /** Blocks by the physical address of their first instruction */
+    std::unordered_map<Addr, Block> blocks;
+    /** The addresses of the blocks in each physical page */
+    std::unordered_map<Addr, std::vector<Addr>> pages;
+
+    /** The block being executed or recorded */
+    Block *current;
+    /** The index of the next instruction of the current block */
+    size_t index;
+
+    size_t numInsts;
+    const size_t maxInsts;
+};
+
+#endif // __CPU_SIMPLE_BLOCK_CACHE_HH__
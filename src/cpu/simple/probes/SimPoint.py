@@ -35,6 +35,7 @@
 #
 # Authors: Curtis Dunham
 
+from m5.SimObject import *
 from m5.params import *
 from Probe import ProbeListenerObject
 
@@ -46,3 +47,22 @@ class SimPoint(ProbeListenerObject):
 
     interval = Param.UInt64(100000000, "Interval Size (insts)")
     profile_file = Param.String("simpoint.bb.gz", "BBV (output) file")
+
+    cxx_exports = [
+        PyBindMethod("checkpointInterval"),
+        PyBindMethod("checkpointInst"),
+        PyBindMethod("writeClusters"),
+    ]
+
+    clusters = Param.Unsigned(0, "Maximum number of phases found by "
+        "clustering BBVs online (0 to only write BBVs)")
+    projection_dims = Param.Unsigned(15, "Dimensions of the random "
+        "projection of BBVs used for clustering")
+    new_cluster_distance = Param.Float(0.1, "Distance in projected space "
+        "from all centroids beyond which an interval opens a new cluster")
+    seed = Param.UInt64(1, "Seed of the random projection")
+    checkpoint_representatives = Param.Bool(False, "Stop the simulation "
+        "to checkpoint candidate representative intervals")
+    simpoints_file = Param.String("simpoints", "Representative interval "
+        "of each cluster (output)")
+    weights_file = Param.String("weights", "Weight of each cluster (output)")
@@ -40,7 +40,10 @@
 
 #include "cpu/simple/probes/simpoint.hh"
 
+#include <cmath>
+
 #include "base/output.hh"
+#include "sim/sim_exit.hh"
 
 SimPoint::SimPoint(const SimPointParams *p)
     : ProbeListenerObject(p),
@@ -49,8 +52,24 @@ SimPoint::SimPoint(const SimPointParams *p)
       intervalDrift(0),
       simpointStream(NULL),
       currentBBV(0, 0),
-      currentBBVInstCount(0)
+      currentBBVInstCount(0),
+      maxClusters(p->clusters),
+      projectionDims(p->projection_dims),
+      newClusterDistance(p->new_cluster_distance),
+      checkpointRepresentatives(p->checkpoint_representatives),
+      simpointsFile(p->simpoints_file),
+      weightsFile(p->weights_file),
+      rng(p->seed),
+      totalInsts(0),
+      intervalIndex(0),
+      pendingCheckpoint(-1),
+      pendingCheckpointInst(0)
 {
+    fatal_if(maxClusters && !projectionDims,
+             "SimPoint clustering needs at least one projection dimension");
+    fatal_if(checkpointRepresentatives && !maxClusters,
+             "SimPoint checkpoints need online clustering (clusters > 0)");
+
     simpointStream = simout.create(p->profile_file, false);
     if (!simpointStream)
         fatal("unable to open SimPoint profile_file");
@@ -88,6 +107,7 @@ SimPoint::profile(const std::pair<SimpleThread*, StaticInstPtr>& p)
 
     ++intervalCount;
     ++currentBBVInstCount;
+    ++totalInsts;
 
     // If inst is control inst, assume end of basic block.
     if (inst->isControl()) {
@@ -102,6 +122,12 @@ SimPoint::profile(const std::pair<SimpleThread*, StaticInstPtr>& p)
             info.insts = currentBBVInstCount;
             info.count = currentBBVInstCount;
             bbMap.insert(std::make_pair(currentBBV, info));
+
+            if (maxClusters) {
+                std::uniform_real_distribution<double> dist(-1.0, 1.0);
+                for (unsigned d = 0; d < projectionDims; ++d)
+                    projection.push_back(dist(rng));
+            }
         } else {
             // If basic block is seen before, just increment the count by the
             // number of insts in basic block.
@@ -135,12 +161,105 @@ SimPoint::profile(const std::pair<SimpleThread*, StaticInstPtr>& p)
             }
             *simpointStream->stream() << "\n";
 
+            if (maxClusters)
+                classifyInterval(counts);
+
             intervalDrift = (intervalCount + intervalDrift) - intervalSize;
             intervalCount = 0;
         }
     }
 }
 
+void
+SimPoint::classifyInterval(
+    const std::vector<std::pair<uint64_t, uint64_t>> &counts)
+{
+    // Project the BBV, normalised to instruction frequencies
+    uint64_t total = 0;
+    for (const auto &cnt : counts)
+        total += cnt.second;
+
+    std::vector<double> point(projectionDims, 0.0);
+    for (const auto &cnt : counts) {
+        const double freq = double(cnt.second) / total;
+        const double *row = &projection[(cnt.first - 1) * projectionDims];
+        for (unsigned d = 0; d < projectionDims; ++d)
+            point[d] += freq * row[d];
+    }
+
+    size_t best = clusters.size();
+    double best_dist = 0;
+    for (size_t i = 0; i < clusters.size(); ++i) {
+        double dist = 0;
+        for (unsigned d = 0; d < projectionDims; ++d) {
+            const double diff = point[d] - clusters[i].centroid[d];
+            dist += diff * diff;
+        }
+        if (best == clusters.size() || dist < best_dist) {
+            best = i;
+            best_dist = dist;
+        }
+    }
+
+    if (best == clusters.size() ||
+        (clusters.size() < maxClusters &&
+         std::sqrt(best_dist) > newClusterDistance)) {
+        clusters.push_back(Cluster{point, 0, -1});
+        best = clusters.size() - 1;
+    }
+
+    Cluster &cluster = clusters[best];
+    ++cluster.size;
+    for (unsigned d = 0; d < projectionDims; ++d)
+        cluster.centroid[d] += (point[d] - cluster.centroid[d]) / cluster.size;
+
+    if (pendingCheckpoint == intervalIndex) {
+        if (cluster.representative < 0)
+            cluster.representative = intervalIndex;
+        pendingCheckpoint = -1;
+    }
+
+    ++intervalIndex;
+
+    // Phases usually span several intervals, so the next interval is
+    // likely to belong to this cluster as well.
+    if (checkpointRepresentatives && cluster.representative < 0) {
+        pendingCheckpoint = intervalIndex;
+        pendingCheckpointInst = totalInsts;
+        exitSimLoop("simpoint checkpoint");
+    }
+}
+
+void
+SimPoint::writeClusters()
+{
+    uint64_t covered = 0;
+    for (const auto &cluster : clusters) {
+        if (cluster.representative >= 0)
+            covered += cluster.size;
+    }
+
+    warn_if(covered < intervalIndex, "SimPoint: %d of %d intervals belong "
+            "to clusters without a representative and are not weighted",
+            intervalIndex - covered, intervalIndex);
+
+    OutputStream *simpoints = simout.create(simpointsFile, false);
+    OutputStream *weights = simout.create(weightsFile, false);
+    fatal_if(!simpoints || !weights, "unable to open SimPoint cluster files");
+
+    for (size_t i = 0; i < clusters.size(); ++i) {
+        const Cluster &cluster = clusters[i];
+        if (cluster.representative < 0)
+            continue;
+        *simpoints->stream() << cluster.representative << " " << i << "\n";
+        *weights->stream() << double(cluster.size) / covered << " "
+                           << i << "\n";
+    }
+
+    simout.close(simpoints);
+    simout.close(weights);
+}
+
 /** SimPoint SimObject */
 SimPoint*
 SimPointParams::create()
@@ -41,7 +41,9 @@
 #ifndef __CPU_SIMPLE_PROBES_SIMPOINT_HH__
 #define __CPU_SIMPLE_PROBES_SIMPOINT_HH__
 
+#include <random>
 #include <unordered_map>
+#include <vector>
 
 #include "base/output.hh"
 #include "cpu/simple_thread.hh"
@@ -50,6 +52,23 @@
 
 /**
  * Probe for SimPoints BBV generation
+ *
+ * Optionally, the probe also clusters the BBVs itself while profiling,
+ * so that representative intervals can be checkpointed in the same run
+ * instead of running the external SimPoint tool and then simulating the
+ * workload a second time. Each BBV is normalised, reduced to a few
+ * dimensions with a random projection, and assigned to the nearest
+ * centroid of an online k-means; an interval that is too far from every
+ * centroid opens a new cluster while fewer than the requested number
+ * exist.
+ *
+ * Since a checkpoint must be taken before the interval it represents is
+ * known, the probe relies on phases usually lasting longer than one
+ * interval: after an interval of a cluster without a representative, it
+ * stops the simulation ("simpoint checkpoint") so that the script can
+ * checkpoint the start of the next interval. That checkpoint becomes the
+ * representative of whichever cluster the next interval turns out to be
+ * in, if that cluster does not have one yet.
  */
 
 /**
@@ -89,7 +108,32 @@ class SimPoint : public ProbeListenerObject
      */
     void profile(const std::pair<SimpleThread*, StaticInstPtr>&);
 
+    /**
+     * Index of the interval starting at the checkpoint the simulation
+     * was last stopped for, or -1 if none is pending.
+     */
+    int64_t checkpointInterval() const { return pendingCheckpoint; }
+
+    /** Number of instructions profiled before that interval. */
+    uint64_t checkpointInst() const { return pendingCheckpointInst; }
+
+    /**
+     * Write the representative interval and the weight of every cluster
+     * that has one, in the format of the SimPoint tool's simpoints and
+     * weights files.
+     */
+    void writeClusters();
+
   private:
+    /**
+     * Assign the BBV of the interval that just ended to a cluster and
+     * decide whether to checkpoint the start of the next interval.
+     *
+     * @param counts Pairs of basic block ID and instruction count.
+     */
+    void classifyInterval(
+        const std::vector<std::pair<uint64_t, uint64_t>> &counts);
+
     /** SimPoint profiling interval size in instructions */
     const uint64_t intervalSize;
 
@@ -116,6 +160,41 @@ class SimPoint : public ProbeListenerObject
     BasicBlockRange currentBBV;
     /** inst count in current basic block */
     uint64_t currentBBVInstCount;
+
+    /** Online clustering; all unused if maxClusters is 0. @{ */
+    const unsigned maxClusters;
+    const unsigned projectionDims;
+    const double newClusterDistance;
+    const bool checkpointRepresentatives;
+    const std::string simpointsFile;
+    const std::string weightsFile;
+
+    struct Cluster {
+        /** Mean of the projected BBVs assigned to the cluster */
+        std::vector<double> centroid;
+        /** Number of intervals assigned to the cluster */
+        uint64_t size;
+        /** Interval checkpointed as representative, -1 if none yet */
+        int64_t representative;
+    };
+    std::vector<Cluster> clusters;
+
+    /**
+     * Random projection matrix, one row of projectionDims values in
+     * [-1, 1] per basic block, indexed by basic block ID - 1. Rows are
+     * drawn when a basic block is first seen.
+     */
+    std::vector<double> projection;
+    std::mt19937_64 rng;
+
+    /** Macro instructions profiled so far */
+    uint64_t totalInsts;
+    /** Index of the interval currently being profiled */
+    int64_t intervalIndex;
+    /** Interval starting at the outstanding checkpoint, or -1 */
+    int64_t pendingCheckpoint;
+    uint64_t pendingCheckpointInst;
+    /** @} */
 };
 
 #endif // __CPU_SIMPLE_PROBES_SIMPOINT_HH__
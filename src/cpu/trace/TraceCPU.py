@@ -87,3 +87,9 @@ class TraceCPU(BaseCPU):
     progressMsgInterval = Param.Unsigned(0, "Interval of committed "\
                                          "instructions at which to print a"\
                                          " progress msg")
+
+    # Number of trace records to inflate and parse ahead of the replay on a
+    # separate decoder thread. Set to zero to decode on the simulation
+    # thread when a record is needed.
+    traceReadAhead = Param.Unsigned(4096, "Number of trace records decoded "\
+                                    "ahead of the replay")
@@ -54,7 +54,8 @@ TraceCPU::TraceCPU(TraceCPUParams *params)
         dataMasterID(params->system->getMasterId(this, "data")),
         instTraceFile(params->instTraceFile),
         dataTraceFile(params->dataTraceFile),
-        icacheGen(*this, ".iside", icachePort, instMasterID, instTraceFile),
+        icacheGen(*this, ".iside", icachePort, instMasterID, instTraceFile,
+                  params->traceReadAhead),
         dcacheGen(*this, ".dside", dcachePort, dataMasterID, dataTraceFile,
                   params),
         icacheNextEvent([this]{ schedIcacheNext(); }, name()),
@@ -162,6 +163,14 @@ TraceCPU::init()
 
 }
 
+DrainState
+TraceCPU::drain()
+{
+    icacheGen.stopReadAhead();
+    dcacheGen.stopReadAhead();
+    return DrainState::Drained;
+}
+
 void
 TraceCPU::schedIcacheNext()
 {
@@ -373,13 +382,14 @@ TraceCPU::ElasticDataGen::readNextWindow()
     while (num_read != windowSize) {
 
         // Create a new graph node
-        GraphNode* new_node = new GraphNode;
+        GraphNode* new_node = allocNode();
 
         // Read the next line to get the next record. If that fails then end of
         // trace has been reached and traceComplete needs to be set in addition
         // to returning false.
         if (!trace.read(new_node)) {
             DPRINTF(TraceCPUData, "\tTrace complete!\n");
+            freeNode(new_node);
             traceComplete = true;
             return false;
         }
@@ -406,6 +416,33 @@ TraceCPU::ElasticDataGen::readNextWindow()
     return true;
 }
 
+TraceCPU::ElasticDataGen::~ElasticDataGen()
+{
+    for (auto& graph_entry : depGraph)
+        delete graph_entry.second;
+    for (auto node_ptr : freeNodes)
+        delete node_ptr;
+}
+
+TraceCPU::ElasticDataGen::GraphNode*
+TraceCPU::ElasticDataGen::allocNode()
+{
+    if (freeNodes.empty())
+        return new GraphNode;
+
+    GraphNode* node_ptr = freeNodes.back();
+    freeNodes.pop_back();
+    return node_ptr;
+}
+
+void
+TraceCPU::ElasticDataGen::freeNode(GraphNode* node_ptr)
+{
+    // clear the set of dependents, keeping its storage for reuse
+    node_ptr->dependents.clear();
+    freeNodes.push_back(node_ptr);
+}
+
 template<typename T> void
 TraceCPU::ElasticDataGen::addDepsOnParent(GraphNode *new_node,
                                             T& dep_array, uint8_t& num_dep)
@@ -568,12 +605,10 @@ TraceCPU::ElasticDataGen::execute()
         if (!node_ptr->isLoad() || node_ptr->isStrictlyOrdered()) {
             // Release all resources occupied by the completed node
             hwResource.release(node_ptr);
-            // clear the dynamically allocated set of dependents
-            (node_ptr->dependents).clear();
             // Update the stat for numOps simulated
             owner.updateNumOps(node_ptr->robNum);
-            // delete node
-            delete node_ptr;
+            // return node to the pool
+            freeNode(node_ptr);
             // remove from graph
             depGraph.erase(graph_itr);
         }
@@ -774,12 +809,10 @@ TraceCPU::ElasticDataGen::completeMemAccess(PacketPtr pkt)
             }
         }
 
-        // clear the dynamically allocated set of dependents
-        (node_ptr->dependents).clear();
         // Update the stat for numOps completed
         owner.updateNumOps(node_ptr->robNum);
-        // delete node
-        delete node_ptr;
+        // return node to the pool
+        freeNode(node_ptr);
         // remove from graph
         depGraph.erase(graph_itr);
     }
@@ -1266,7 +1299,7 @@ TraceCPU::DcachePort::recvReqRetry()
 
 TraceCPU::ElasticDataGen::InputStream::InputStream(
     const std::string& filename,
-    const double time_multiplier)
+    const double time_multiplier, unsigned read_ahead)
     : trace(filename),
       timeMultiplier(time_multiplier),
       microOpCount(0)
@@ -1285,19 +1318,36 @@ TraceCPU::ElasticDataGen::InputStream::InputStream(
         // when the data dependency trace was captured in the o3cpu model
         windowSize = header_msg.window_size();
     }
+
+    // Now that the header is consumed, hand the stream over to the
+    // decoder thread if read-ahead is enabled
+    if (read_ahead != 0) {
+        readAhead.reset(new AsyncProtoReader<ProtoMessage::InstDepRecord>(
+            &trace, read_ahead));
+    }
 }
 
 void
 TraceCPU::ElasticDataGen::InputStream::reset()
 {
-    trace.reset();
+    if (readAhead)
+        readAhead->reset();
+    else
+        trace.reset();
+}
+
+void
+TraceCPU::ElasticDataGen::InputStream::stopReadAhead()
+{
+    if (readAhead)
+        readAhead->stop();
 }
 
 bool
 TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
 {
     ProtoMessage::InstDepRecord pkt_msg;
-    if (trace.read(pkt_msg)) {
+    if (readAhead ? readAhead->read(pkt_msg) : trace.read(pkt_msg)) {
         // Required fields
         element->seqNum = pkt_msg.seq_num();
         element->type = pkt_msg.type();
@@ -1479,7 +1529,8 @@ TraceCPU::ElasticDataGen::GraphNode::typeToStr() const
     return Record::RecordType_Name(type);
 }
 
-TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename)
+TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename,
+                                                  unsigned read_ahead)
     : trace(filename)
 {
     // Create a protobuf message for the header and read it from the stream
@@ -1492,19 +1543,34 @@ TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename)
                   header_msg.tick_freq());
         }
     }
+
+    if (read_ahead != 0) {
+        readAhead.reset(new AsyncProtoReader<ProtoMessage::Packet>(
+            &trace, read_ahead));
+    }
 }
 
 void
 TraceCPU::FixedRetryGen::InputStream::reset()
 {
-    trace.reset();
+    if (readAhead)
+        readAhead->reset();
+    else
+        trace.reset();
+}
+
+void
+TraceCPU::FixedRetryGen::InputStream::stopReadAhead()
+{
+    if (readAhead)
+        readAhead->stop();
 }
 
 bool
 TraceCPU::FixedRetryGen::InputStream::read(TraceElement* element)
 {
     ProtoMessage::Packet pkt_msg;
-    if (trace.read(pkt_msg)) {
+    if (readAhead ? readAhead->read(pkt_msg) : trace.read(pkt_msg)) {
         element->cmd = pkt_msg.cmd();
         element->addr = pkt_msg.addr();
         element->blocksize = pkt_msg.size();
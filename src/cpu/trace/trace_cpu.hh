@@ -44,9 +44,11 @@
 
 #include <array>
 #include <cstdint>
+#include <memory>
 #include <queue>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #include "arch/registers.hh"
 #include "base/statistics.hh"
@@ -55,6 +57,7 @@
 #include "debug/TraceCPUInst.hh"
 #include "params/TraceCPU.hh"
 #include "proto/inst_dep_record.pb.h"
+#include "proto/async_protoio.hh"
 #include "proto/packet.pb.h"
 #include "proto/protoio.hh"
 #include "sim/sim_events.hh"
@@ -150,6 +153,12 @@ class TraceCPU : public BaseCPU
 
     void init();
 
+    /**
+     * Stop the threads that read the traces ahead, as a forked process
+     * doesn't inherit them. They restart when the traces are read again.
+     */
+    DrainState drain() override;
+
     /**
      * This is a pure virtual function in BaseCPU. As we don't know how many
      * insts are in the trace but only know how how many micro-ops are we
@@ -398,14 +407,20 @@ class TraceCPU : public BaseCPU
             // Input file stream for the protobuf trace
             ProtoInputStream trace;
 
+            /** Optional decoder thread reading ahead of the replay */
+            std::unique_ptr<AsyncProtoReader<ProtoMessage::Packet>>
+                readAhead;
+
           public:
 
             /**
              * Create a trace input stream for a given file name.
              *
              * @param filename Path to the file to read from
+             * @param read_ahead Number of records to decode ahead on a
+             *                   separate thread, 0 to decode on demand
              */
-            InputStream(const std::string& filename);
+            InputStream(const std::string& filename, unsigned read_ahead);
 
             /**
              * Reset the stream such that it can be played once
@@ -413,6 +428,12 @@ class TraceCPU : public BaseCPU
              */
             void reset();
 
+            /**
+             * Stop the decoder thread if reading ahead. It restarts on
+             * the next read.
+             */
+            void stopReadAhead();
+
             /**
              * Attempt to read a trace element from the stream,
              * and also notify the caller if the end of the file
@@ -428,11 +449,11 @@ class TraceCPU : public BaseCPU
         /* Constructor */
         FixedRetryGen(TraceCPU& _owner, const std::string& _name,
                    MasterPort& _port, MasterID master_id,
-                   const std::string& trace_file)
+                   const std::string& trace_file, unsigned read_ahead)
             : owner(_owner),
               port(_port),
               masterID(master_id),
-              trace(trace_file),
+              trace(trace_file, read_ahead),
               genName(owner.name() + ".fixedretry" + _name),
               retryPkt(nullptr),
               delta(0),
@@ -478,6 +499,9 @@ class TraceCPU : public BaseCPU
         /** Exit the FixedRetryGen. */
         void exit();
 
+        /** Stop reading the trace ahead on a separate thread. */
+        void stopReadAhead() { trace.stopReadAhead(); }
+
         /**
          * Reads a line of the trace file. Returns the tick
          * when the next request should be generated. If the end
@@ -800,6 +824,10 @@ class TraceCPU : public BaseCPU
             /** Input file stream for the protobuf trace */
             ProtoInputStream trace;
 
+            /** Optional decoder thread reading ahead of the replay */
+            std::unique_ptr<AsyncProtoReader<ProtoMessage::InstDepRecord>>
+                readAhead;
+
             /**
              * A multiplier for the compute delays in the trace to modulate
              * the Trace CPU frequency either up or down. The Trace CPU's
@@ -823,9 +851,11 @@ class TraceCPU : public BaseCPU
              *
              * @param filename Path to the file to read from
              * @param time_multiplier used to scale the compute delays
+             * @param read_ahead Number of records to decode ahead on a
+             *                   separate thread, 0 to decode on demand
              */
             InputStream(const std::string& filename,
-                        const double time_multiplier);
+                        const double time_multiplier, unsigned read_ahead);
 
             /**
              * Reset the stream such that it can be played once
@@ -833,6 +863,12 @@ class TraceCPU : public BaseCPU
              */
             void reset();
 
+            /**
+             * Stop the decoder thread if reading ahead. It restarts on
+             * the next read.
+             */
+            void stopReadAhead();
+
             /**
              * Attempt to read a trace element from the stream,
              * and also notify the caller if the end of the file
@@ -859,7 +895,8 @@ class TraceCPU : public BaseCPU
             : owner(_owner),
               port(_port),
               masterID(master_id),
-              trace(trace_file, 1.0 / params->freqMultiplier),
+              trace(trace_file, 1.0 / params->freqMultiplier,
+                    params->traceReadAhead),
               genName(owner.name() + ".elastic" + _name),
               retryPkt(nullptr),
               traceComplete(false),
@@ -873,6 +910,9 @@ class TraceCPU : public BaseCPU
                     windowSize);
         }
 
+        /** Free the nodes still in the graph and the node pool. */
+        ~ElasticDataGen();
+
         /**
          * Called from TraceCPU init(). Reads the first message from the
          * input trace file and returns the send tick.
@@ -895,6 +935,9 @@ class TraceCPU : public BaseCPU
         /** Exit the ElasticDataGen. */
         void exit();
 
+        /** Stop reading the trace ahead on a separate thread. */
+        void stopReadAhead() { trace.stopReadAhead(); }
+
         /**
          * Reads a line of the trace file. Returns the tick when the next
          * request should be generated. If the end of the file has been
@@ -904,6 +947,17 @@ class TraceCPU : public BaseCPU
          */
         bool readNextWindow();
 
+        /**
+         * Get a node from the pool of recycled nodes, or allocate a new one
+         * if the pool is empty. All fields are overwritten when a record
+         * is read into the node, and the dependents vector keeps its
+         * capacity, so recycled nodes avoid heap traffic entirely.
+         */
+        GraphNode* allocNode();
+
+        /** Return a completed node to the pool. */
+        void freeNode(GraphNode* node);
+
         /**
          * Iterate over the dependencies of a new node and add the new node
          * to the list of dependents of the parent node.
@@ -1034,6 +1088,13 @@ class TraceCPU : public BaseCPU
         /** Store the depGraph of GraphNodes */
         std::unordered_map<NodeSeqNum, GraphNode*> depGraph;
 
+        /**
+         * Completed nodes available for reuse. Its size is bounded by the
+         * peak number of nodes in flight, which in turn is bounded by the
+         * dependency window rather than by the length of the trace.
+         */
+        std::vector<GraphNode*> freeNodes;
+
         /**
          * Queue of dependency-free nodes that are pending issue because
          * resources are not available. This is chosen to be FIFO so that
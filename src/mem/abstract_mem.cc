@@ -49,6 +49,7 @@
 #include "arch/locked_mem.hh"
 #include "cpu/base.hh"
 #include "cpu/thread_context.hh"
+#include "debug/Backdoor.hh"
 #include "debug/LLSC.hh"
 #include "debug/MemoryAccess.hh"
 #include "mem/packet_access.hh"
@@ -314,6 +315,19 @@ tracePacket(System *sys, const char *label, PacketPtr pkt)
 #   define TRACE_PACKET(A)
 #endif
 
+bool
+AbstractMemory::getBackdoor(MemBackdoor &backdoor)
+{
+    if (isNull() || !pmemAddr || range.interleaved())
+        return false;
+
+    DPRINTF(Backdoor, "Granting backdoor to %s\n", range.to_string());
+    backdoor.range = range;
+    backdoor.ptr = pmemAddr;
+    backdoor.mem = this;
+    return true;
+}
+
 void
 AbstractMemory::access(PacketPtr pkt)
 {
@@ -49,6 +49,7 @@
 #ifndef __MEM_ABSTRACT_MEMORY_HH__
 #define __MEM_ABSTRACT_MEMORY_HH__
 
+#include "mem/backdoor.hh"
 #include "mem/mem_object.hh"
 #include "params/AbstractMemory.hh"
 #include "sim/stats.hh"
@@ -229,6 +230,22 @@ class AbstractMemory : public MemObject
      */
     void addLockedAddr(LockedAddr addr) { lockedAddrList.push_back(addr); }
 
+    /**
+     * Check if any context holds a load-locked reservation. Direct
+     * writes through a backdoor do not clear reservations, so they
+     * must take the normal path while this is true.
+     */
+    bool hasLockedAddrs() const { return !lockedAddrList.empty(); }
+
+    /**
+     * Describe the backing store of this memory for direct access.
+     *
+     * @param backdoor Descriptor populated on success.
+     * @return false if the memory is null, interleaved or has no
+     *         backing store.
+     */
+    bool getBackdoor(MemBackdoor &backdoor);
+
     /** read the system pointer
      * Implemented for completeness with the setter
      * @return pointer to the system object */
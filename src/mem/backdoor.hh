@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Direct host-memory access ("backdoor") descriptors.
+ *
+ * A backdoor describes a range of simulated physical memory that is
+ * backed by a contiguous block of host memory and that may be read and
+ * written directly through a host pointer, bypassing the port and packet
+ * machinery. Backdoors are requested with MasterPort::getBackdoor() and
+ * are only granted when every component between the requester and the
+ * memory can be safely bypassed, i.e. when none of them keeps state
+ * (caches, snooping masters, monitors) that a direct access would leave
+ * stale. A coherent crossbar only grants one if every master that snoops
+ * it is owned by the requester, such as the data port of the CPU whose
+ * instruction port asks for the backdoor.
+ *
+ * Accesses through a backdoor are functional: they update the memory
+ * contents only, they are not counted in the memory statistics, and they
+ * do not interact with load-locked/store-conditional monitors. Users must
+ * fall back to the regular port path for any access with side effects,
+ * and must check hasLockedAddrs() on the owning memory before writing.
+ */
+
+#ifndef __MEM_BACKDOOR_HH__
+#define __MEM_BACKDOOR_HH__
+
+#include <cstdint>
+
+#include "base/addr_range.hh"
+#include "base/types.hh"
+
+class AbstractMemory;
+
+struct MemBackdoor
+{
+    /** Simulated physical address range covered by the backdoor. */
+    AddrRange range;
+
+    /** Host address of the first byte of the range. */
+    uint8_t *ptr;
+
+    /** Memory that owns the backing store. */
+    AbstractMemory *mem;
+
+    MemBackdoor() : ptr(nullptr), mem(nullptr) {}
+
+    /** Is this backdoor populated? */
+    bool valid() const { return ptr != nullptr; }
+
+    /** Forget the backdoor, e.g. after a drain or a CPU switch. */
+    void invalidate() { ptr = nullptr; mem = nullptr; range = AddrRange(); }
+
+    /** Does the backdoor cover [addr, addr + size)? */
+    bool
+    covers(Addr addr, Addr size) const
+    {
+        return valid() && addr >= range.start() &&
+            size != 0 && addr + size - 1 <= range.end() &&
+            addr + size - 1 >= addr;
+    }
+
+    /** Host pointer for a simulated address covered by the backdoor. */
+    uint8_t *hostAddr(Addr addr) const { return ptr + (addr - range.start()); }
+};
+
+#endif // __MEM_BACKDOOR_HH__
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+
+#include "mem/backdoor.hh"
+
+TEST(MemBackdoorTest, Invalid)
+{
+    MemBackdoor backdoor;
+    EXPECT_FALSE(backdoor.valid());
+    EXPECT_FALSE(backdoor.covers(0, 1));
+}
+
+TEST(MemBackdoorTest, Covers)
+{
+    uint8_t store[0x100];
+    MemBackdoor backdoor;
+    backdoor.range = AddrRange(0x1000, 0x10ff);
+    backdoor.ptr = store;
+    ASSERT_TRUE(backdoor.valid());
+
+    EXPECT_TRUE(backdoor.covers(0x1000, 1));
+    EXPECT_TRUE(backdoor.covers(0x1000, 0x100));
+    EXPECT_TRUE(backdoor.covers(0x10f8, 8));
+    EXPECT_TRUE(backdoor.covers(0x10ff, 1));
+
+    // Accesses that start or end outside the range
+    EXPECT_FALSE(backdoor.covers(0xfff, 1));
+    EXPECT_FALSE(backdoor.covers(0xfff, 2));
+    EXPECT_FALSE(backdoor.covers(0x10f8, 9));
+    EXPECT_FALSE(backdoor.covers(0x1100, 1));
+    EXPECT_FALSE(backdoor.covers(0x1000, 0x101));
+
+    // Empty accesses
+    EXPECT_FALSE(backdoor.covers(0x1000, 0));
+}
+
+TEST(MemBackdoorTest, CoversAtTheEndOfTheAddressSpace)
+{
+    const Addr max = std::numeric_limits<Addr>::max();
+    uint8_t store[0x10];
+    MemBackdoor backdoor;
+    backdoor.range = AddrRange(max - 0xf, max);
+    backdoor.ptr = store;
+
+    EXPECT_TRUE(backdoor.covers(max - 0xf, 0x10));
+    EXPECT_TRUE(backdoor.covers(max, 1));
+
+    // The end of the access wraps around
+    EXPECT_FALSE(backdoor.covers(max, 2));
+    EXPECT_FALSE(backdoor.covers(max - 0xf, max));
+}
+
+TEST(MemBackdoorTest, HostAddr)
+{
+    uint8_t store[0x100];
+    MemBackdoor backdoor;
+    backdoor.range = AddrRange(0x1000, 0x10ff);
+    backdoor.ptr = store;
+
+    EXPECT_EQ(store, backdoor.hostAddr(0x1000));
+    EXPECT_EQ(store + 0x42, backdoor.hostAddr(0x1042));
+    EXPECT_EQ(store + 0xff, backdoor.hostAddr(0x10ff));
+}
+
+TEST(MemBackdoorTest, Invalidate)
+{
+    uint8_t store[0x100];
+    MemBackdoor backdoor;
+    backdoor.range = AddrRange(0x1000, 0x10ff);
+    backdoor.ptr = store;
+
+    backdoor.invalidate();
+    EXPECT_FALSE(backdoor.valid());
+    EXPECT_EQ(nullptr, backdoor.mem);
+    EXPECT_FALSE(backdoor.covers(0x1000, 1));
+}
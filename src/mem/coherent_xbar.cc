@@ -53,6 +53,7 @@
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/AddrRanges.hh"
+#include "debug/Backdoor.hh"
 #include "debug/CoherentXBar.hh"
 #include "sim/system.hh"
 
@@ -1015,6 +1016,28 @@ CoherentXBar::recvFunctional(PacketPtr pkt, PortID slave_port_id)
     }
 }
 
+bool
+CoherentXBar::recvGetBackdoor(Addr addr, MemBackdoor &backdoor,
+                              PortID slave_port_id)
+{
+    // a direct access is invisible to snoopers, so only allow it if
+    // they all belong to the requester, e.g. the data port of a CPU
+    // that asks for a backdoor for its instruction port
+    const MemObject &requester =
+        slavePorts[slave_port_id]->getMasterPort().getOwner();
+    for (const auto& p : snoopPorts) {
+        const BaseMasterPort &snooper = p->getMasterPort();
+        if (&snooper.getOwner() != &requester) {
+            DPRINTF(Backdoor, "Refusing backdoor for %s, snooped by %s\n",
+                    slavePorts[slave_port_id]->getMasterPort().name(),
+                    snooper.name());
+            return false;
+        }
+    }
+
+    return forwardBackdoor(addr, backdoor);
+}
+
 void
 CoherentXBar::recvFunctionalSnoop(PacketPtr pkt, PortID master_port_id)
 {
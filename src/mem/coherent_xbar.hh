@@ -132,6 +132,12 @@ class CoherentXBar : public BaseXBar
         virtual void recvFunctional(PacketPtr pkt)
         { xbar.recvFunctional(pkt, id); }
 
+        /**
+         * When receiving a backdoor request, pass it to the crossbar.
+         */
+        virtual bool recvGetBackdoor(Addr addr, MemBackdoor &backdoor)
+        { return xbar.recvGetBackdoor(addr, backdoor, id); }
+
         /**
          * Return the union of all adress ranges seen by this crossbar.
          */
@@ -386,6 +392,13 @@ class CoherentXBar : public BaseXBar
         transaction.*/
     void recvFunctional(PacketPtr pkt, PortID slave_port_id);
 
+    /** Function called by the port when the crossbar is recieving a
+        backdoor request. Direct accesses bypass the snooping protocol,
+        so it is only granted if all snooping masters are owned by the
+        requesting one, e.g. are ports of the same CPU. */
+    bool recvGetBackdoor(Addr addr, MemBackdoor &backdoor,
+                         PortID slave_port_id);
+
     /** Function called by the port when the crossbar is recieving a functional
         snoop transaction.*/
     void recvFunctionalSnoop(PacketPtr pkt, PortID master_port_id);
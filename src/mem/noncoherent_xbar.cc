@@ -312,6 +312,13 @@ NoncoherentXBar::recvFunctional(PacketPtr pkt, PortID slave_port_id)
     masterPorts[dest_id]->sendFunctional(pkt);
 }
 
+bool
+NoncoherentXBar::recvGetBackdoor(Addr addr, MemBackdoor &backdoor,
+                                 PortID slave_port_id)
+{
+    return forwardBackdoor(addr, backdoor);
+}
+
 NoncoherentXBar*
 NoncoherentXBarParams::create()
 {
@@ -388,32 +388,28 @@ PhysicalMemory::unserialize(CheckpointIn &cp)
     unsigned int nbr_of_stores;
     UNSERIALIZE_SCALAR(nbr_of_stores);
 
+    vector<StoreFile> files;
     for (unsigned int i = 0; i < nbr_of_stores; ++i) {
         ScopedCheckpointSection sec(cp, csprintf("store%d", i));
-        unserializeStore(cp);
+        files.push_back(unserializeStore(cp));
     }
 
+    // Decompressing the stores takes most of the time, and they are
+    // independent of each other
+    parallelRestore(files.size(), [&](size_t i) {
+        restoreStore(files[i]);
+    });
 }
 
-void
+PhysicalMemory::StoreFile
 PhysicalMemory::unserializeStore(CheckpointIn &cp)
 {
-    const uint32_t chunk_size = 16384;
-
     unsigned int store_id;
     UNSERIALIZE_SCALAR(store_id);
 
     string filename;
     UNSERIALIZE_SCALAR(filename);
-    string filepath = cp.cptDir + "/" + filename;
-
-    // mmap memoryfile
-    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'", filename);
 
-    // we've already got the actual backing store mapped
-    uint8_t* pmem = backingStore[store_id].pmem;
     AddrRange range = backingStore[store_id].range;
 
     long range_size;
@@ -426,6 +422,24 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Memory range size has changed! Saw %lld, expected %lld\n",
               range_size, range.size());
 
+    return StoreFile{ store_id, filename, cp.cptDir + "/" + filename };
+}
+
+void
+PhysicalMemory::restoreStore(const StoreFile &file)
+{
+    const uint32_t chunk_size = 16384;
+    const string &filename = file.filename;
+
+    // mmap memoryfile
+    gzFile compressed_mem = gzopen(file.path.c_str(), "rb");
+    if (compressed_mem == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'", filename);
+
+    // we've already got the actual backing store mapped
+    uint8_t* pmem = backingStore[file.storeId].pmem;
+    AddrRange range = backingStore[file.storeId].range;
+
     uint64_t curr_size = 0;
     long* temp_page = new long[chunk_size];
     long* pmem_current;
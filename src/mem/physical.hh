@@ -260,10 +260,25 @@ class PhysicalMemory : public Serializable
      */
     void unserialize(CheckpointIn &cp) override;
 
+    /** A backing store and the file to restore its contents from */
+    struct StoreFile
+    {
+        unsigned int storeId;
+        std::string filename;
+        std::string path;
+    };
+
     /**
      * Unserialize a specific backing store, identified by a section.
+     *
+     * @return The file to restore the contents of the store from
+     */
+    StoreFile unserializeStore(CheckpointIn &cp);
+
+    /**
+     * Restore the contents of a backing store from its file.
      */
-    void unserializeStore(CheckpointIn &cp);
+    void restoreStore(const StoreFile &file);
 
 };
 
@@ -176,6 +176,12 @@ MasterPort::sendFunctional(PacketPtr pkt)
     return _slavePort->recvFunctional(pkt);
 }
 
+bool
+MasterPort::getBackdoor(Addr addr, MemBackdoor &backdoor)
+{
+    return _slavePort->recvGetBackdoor(addr, backdoor);
+}
+
 bool
 MasterPort::sendTimingReq(PacketPtr pkt)
 {
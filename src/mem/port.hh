@@ -51,6 +51,7 @@
 #define __MEM_PORT_HH__
 
 #include "base/addr_range.hh"
+#include "mem/backdoor.hh"
 #include "mem/packet.hh"
 
 class MemObject;
@@ -101,6 +102,9 @@ class Port
     /** Get the port id. */
     PortID getId() const { return id; }
 
+    /** Get the MemObject that owns the port. */
+    MemObject &getOwner() const { return owner; }
+
 };
 
 /** Forward declaration */
@@ -210,6 +214,18 @@ class MasterPort : public BaseMasterPort
      */
     void sendFunctional(PacketPtr pkt);
 
+    /**
+     * Ask for direct host access to the memory containing an
+     * address. This only succeeds if every component on the path to
+     * the memory can be bypassed without losing state.
+     *
+     * @param addr Physical address that the backdoor should cover.
+     * @param backdoor Descriptor populated on success.
+     *
+     * @return true if a backdoor was granted.
+     */
+    bool getBackdoor(Addr addr, MemBackdoor &backdoor);
+
     /**
      * Attempt to send a timing request to the slave port by calling
      * its corresponding receive function. If the send does not
@@ -459,6 +475,15 @@ class SlavePort : public BaseSlavePort
      */
     virtual void recvFunctional(PacketPtr pkt) = 0;
 
+    /**
+     * Receive a backdoor request from the master port. Components
+     * that cannot be bypassed keep the default, which refuses.
+     */
+    virtual bool recvGetBackdoor(Addr addr, MemBackdoor &backdoor)
+    {
+        return false;
+    }
+
     /**
      * Receive a timing request from the master port.
      */
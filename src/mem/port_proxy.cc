@@ -40,11 +40,43 @@
 #include "mem/port_proxy.hh"
 
 #include "base/chunk_generator.hh"
+#include "base/trace.hh"
+#include "debug/Backdoor.hh"
+#include "mem/abstract_mem.hh"
+#include "sim/system.hh"
+
+bool
+PortProxy::useBackdoor(Addr addr, Request::Flags flags, int size) const
+{
+    // secure and uncacheable accesses keep their packet semantics
+    if (flags != 0 || size <= 0)
+        return false;
+
+    if (!_backdoor.covers(addr, size)) {
+        MemBackdoor fresh;
+        if (!_port.getBackdoor(addr, fresh) || !fresh.covers(addr, size))
+            return false;
+        DPRINTFS(Backdoor, (&_port), "Proxy backdoor to %s\n",
+                 fresh.range.to_string());
+        _backdoor = fresh;
+    }
+
+    // in timing mode the memory may hold responses in flight that a
+    // functional write would have to update, so only bypass it when
+    // the memory system is atomic
+    const System *sys = _backdoor.mem->system();
+    return sys && sys->isAtomicMode();
+}
 
 void
 PortProxy::readBlobPhys(Addr addr, Request::Flags flags,
                         uint8_t *p, int size) const
 {
+    if (useBackdoor(addr, flags, size)) {
+        std::memcpy(p, _backdoor.hostAddr(addr), size);
+        return;
+    }
+
     for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
          gen.next()) {
 
@@ -62,6 +94,11 @@ void
 PortProxy::writeBlobPhys(Addr addr, Request::Flags flags,
                          const uint8_t *p, int size) const
 {
+    if (useBackdoor(addr, flags, size)) {
+        std::memcpy(_backdoor.hostAddr(addr), p, size);
+        return;
+    }
+
     for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
          gen.next()) {
 
@@ -79,6 +116,11 @@ void
 PortProxy::memsetBlobPhys(Addr addr, Request::Flags flags,
                           uint8_t v, int size) const
 {
+    if (useBackdoor(addr, flags, size)) {
+        std::memset(_backdoor.hostAddr(addr), v, size);
+        return;
+    }
+
     // quick and dirty...
     uint8_t *buf = new uint8_t[size];
 
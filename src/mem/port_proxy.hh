@@ -78,6 +78,12 @@
  *
  * The addresses are interpreted as physical addresses.
  *
+ * When the memory behind the port grants a backdoor (no caches or
+ * other snoopers in the way) and the system is in atomic mode, blob
+ * accesses that fall within a single memory are performed directly on
+ * the host backing store instead of being split into line-sized
+ * functional packets.
+ *
  * @sa SETranslatingProxy
  * @sa FSTranslatingProxy
  */
@@ -91,6 +97,15 @@ class PortProxy
     /** Granularity of any transactions issued through this proxy. */
     const unsigned int _cacheLineSize;
 
+    /** Most recently granted backdoor, refreshed on demand. */
+    mutable MemBackdoor _backdoor;
+
+    /**
+     * Check if a physical access can bypass the port, fetching a new
+     * backdoor if the cached one does not cover it.
+     */
+    bool useBackdoor(Addr addr, Request::Flags flags, int size) const;
+
   public:
     PortProxy(MasterPort &port, unsigned int cacheLineSize) :
         _port(port), _cacheLineSize(cacheLineSize) { }
@@ -35,6 +35,7 @@
 #
 # Authors: Andreas Sandberg
 
+from m5.SimObject import *
 from m5.params import *
 from m5.proxy import *
 from BaseMemProbe import BaseMemProbe
@@ -54,3 +55,24 @@ class MemTraceProbe(BaseMemProbe):
 
     # System object to look up the name associated with a master ID
     system = Param.System(Parent.any, "System the probe belongs to")
+
+    # Build and compress trace messages on a background thread instead of
+    # the simulation thread. The trace format is unchanged.
+    async_write = Param.Bool(False, "Write the trace on a background thread")
+    async_buffer_size = Param.Unsigned(65536,
+        "Number of packets queued for the background writer")
+
+    # Record packets from the start of simulation. If disabled, tracing
+    # only starts once startTrace() is called, e.g. at the start of a
+    # region of interest.
+    start_enabled = Param.Bool(True, "Record packets from the start")
+
+    @cxxMethod
+    def startTrace(self):
+        """Start recording packets"""
+        pass
+
+    @cxxMethod
+    def stopTrace(self):
+        """Stop recording packets"""
+        pass
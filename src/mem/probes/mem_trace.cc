@@ -50,7 +50,10 @@ MemTraceProbe::MemTraceProbe(MemTraceProbeParams *p)
     : BaseMemProbe(p),
       traceStream(nullptr),
       system(p->system),
-      withPC(p->with_pc)
+      withPC(p->with_pc),
+      asyncWrite(p->async_write),
+      asyncBufferSize(p->async_buffer_size),
+      tracing(p->start_enabled)
 {
     std::string filename;
     if (p->trace_file != "") {
@@ -97,30 +100,82 @@ MemTraceProbe::startup()
     }
 
     traceStream->write(header_msg);
+
+    // The header has to be the first message in the stream, so only
+    // hand the stream over to the writer thread once it is written.
+    if (asyncWrite)
+        startAsyncWriter();
+}
+
+void
+MemTraceProbe::startAsyncWriter()
+{
+    const bool with_pc = withPC;
+    asyncWriter.reset(new AsyncProtoWriter<PacketRecord>(
+        traceStream, asyncBufferSize,
+        [with_pc](const PacketRecord &rec, ProtoOutputStream &out) {
+            writeRecord(rec, out, with_pc);
+        }));
+}
+
+DrainState
+MemTraceProbe::drain()
+{
+    asyncWriter.reset();
+    return DrainState::Drained;
 }
 
 void
 MemTraceProbe::closeStreams()
 {
+    // Drain the background writer before closing the stream it uses
+    asyncWriter.reset();
+
     if (traceStream != NULL)
         delete traceStream;
+    traceStream = NULL;
 }
 
 void
-MemTraceProbe::handleRequest(const ProbePoints::PacketInfo &pkt_info)
+MemTraceProbe::writeRecord(const PacketRecord &rec, ProtoOutputStream &out,
+                           bool with_pc)
 {
     ProtoMessage::Packet pkt_msg;
 
-    pkt_msg.set_tick(curTick());
-    pkt_msg.set_cmd(pkt_info.cmd.toInt());
-    pkt_msg.set_flags(pkt_info.flags);
-    pkt_msg.set_addr(pkt_info.addr);
-    pkt_msg.set_size(pkt_info.size);
-    if (withPC && pkt_info.pc != 0)
-        pkt_msg.set_pc(pkt_info.pc);
-    pkt_msg.set_pkt_id(pkt_info.master);
+    pkt_msg.set_tick(rec.tick);
+    pkt_msg.set_cmd(rec.cmd);
+    pkt_msg.set_flags(rec.flags);
+    pkt_msg.set_addr(rec.addr);
+    pkt_msg.set_size(rec.size);
+    if (with_pc && rec.pc != 0)
+        pkt_msg.set_pc(rec.pc);
+    pkt_msg.set_pkt_id(rec.master);
 
-    traceStream->write(pkt_msg);
+    out.write(pkt_msg);
+}
+
+void
+MemTraceProbe::handleRequest(const ProbePoints::PacketInfo &pkt_info)
+{
+    if (!tracing)
+        return;
+
+    PacketRecord rec;
+    rec.tick = curTick();
+    rec.addr = pkt_info.addr;
+    rec.pc = pkt_info.pc;
+    rec.cmd = pkt_info.cmd.toInt();
+    rec.flags = pkt_info.flags;
+    rec.size = pkt_info.size;
+    rec.master = pkt_info.master;
+
+    if (asyncWrite) {
+        if (!asyncWriter)
+            startAsyncWriter();
+        asyncWriter->write(rec);
+    } else {
+        writeRecord(rec, *traceStream, withPC);
+    }
 }
 
 
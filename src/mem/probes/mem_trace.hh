@@ -40,8 +40,11 @@
 #ifndef __MEM_PROBES_MEM_TRACE_HH__
 #define __MEM_PROBES_MEM_TRACE_HH__
 
+#include <memory>
+
 #include "mem/packet.hh"
 #include "mem/probes/base.hh"
+#include "proto/async_protoio.hh"
 #include "proto/protoio.hh"
 
 struct MemTraceProbeParams;
@@ -52,6 +55,16 @@ class MemTraceProbe : public BaseMemProbe
   public:
     MemTraceProbe(MemTraceProbeParams *params);
 
+    /**
+     * Start or stop recording packets, e.g. at the boundaries of a
+     * region of interest. The trace header is always written, so a
+     * trace that is never started is still a valid (empty) trace.
+     * @{
+     */
+    void startTrace() { tracing = true; }
+    void stopTrace() { tracing = false; }
+    /** @} */
+
   protected:
     void handleRequest(const ProbePoints::PacketInfo &pkt_info) override;
 
@@ -63,17 +76,61 @@ class MemTraceProbe : public BaseMemProbe
 
     void startup() override;
 
+    /**
+     * Write the queued packets and stop the background writer, as a
+     * forked process doesn't inherit its thread. The next traced packet
+     * starts a new one.
+     */
+    DrainState drain() override;
+
   protected:
 
+    /** Hand the trace stream to a new background writer. */
+    void startAsyncWriter();
+
+    /**
+     * Fixed-size copy of the fields of a traced packet, handed to the
+     * background writer when asynchronous writing is enabled.
+     */
+    struct PacketRecord
+    {
+        Tick tick;
+        Addr addr;
+        Addr pc;
+        Request::FlagsType flags;
+        uint32_t cmd;
+        uint32_t size;
+        MasterID master;
+    };
+
+    /** Convert a record to a packet message and write it to a stream. */
+    static void writeRecord(const PacketRecord &rec, ProtoOutputStream &out,
+                            bool with_pc);
+
     /** Trace output stream */
     ProtoOutputStream *traceStream;
 
+    /**
+     * Background writer, only used if async_write is set. Null while
+     * the simulator is drained.
+     */
+    std::unique_ptr<AsyncProtoWriter<PacketRecord>> asyncWriter;
+
     System *system;
 
   private:
 
     /** Include the Program Counter in the memory trace */
     const bool withPC;
+
+    /** Hand packets to a background writer thread */
+    const bool asyncWrite;
+
+    /** Number of records the background writer can queue */
+    const unsigned asyncBufferSize;
+
+    /** Whether packets are currently being recorded */
+    bool tracing;
 };
 
 #endif //__MEM_PROBES_MEM_TRACE_HH__
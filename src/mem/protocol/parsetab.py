@@ -0,0 +1,171 @@
+
+# parsetab.py
+# This file is automatically generated. Do not edit.
+_tabversion = '3.2'
+
+_lr_method = 'LALR'
+
+_lr_signature = 'F\xb9rw\x86\x08k\xa6(\xc2\xb6\xf2\x85\x8bQj'
+    
+_lr_action_items = {'PEEK':([181,251,252,257,297,304,326,346,351,358,361,372,374,375,376,378,381,382,],[245,245,-98,-82,-81,-88,-97,-95,-89,-94,-99,-90,-92,-100,-101,-93,-91,-96,]),'TRANS':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[9,9,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,9,-18,-16,-81,-20,9,-19,-21,-13,-8,-12,-15,-9,-11,]),'STAR':([5,11,20,22,62,82,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,177,187,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,228,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,33,-62,-61,-60,130,-139,-138,-115,-107,-104,-137,-106,-110,-142,148,-140,-109,148,148,148,-105,-133,-130,148,-141,243,130,148,-111,-134,148,148,-116,148,148,148,148,148,148,148,148,-117,148,148,33,148,-135,-113,-136,-108,148,-137,148,148,148,-112,-102,-114,148,-103,148,]),'SLASH':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,158,-140,-109,158,158,158,-105,-133,-130,158,-141,158,-111,-134,158,158,-116,158,158,158,158,158,158,158,158,-117,158,158,158,-135,-113,-136,-108,158,-137,158,158,158,-112,-102,-114,158,-103,158,]),'FLOATNUMBER':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,-98,-82,84,84,84,84,-81,84,-88,84,-97,84,-95,-89,-94,-99,84,-90,-92,-100,-101,-93,-91,-96,]),'VOID':([0,1,2,5,8,15,46,56,63,74,123,150,162,174,180,221,230,231,234,236,238,239,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[3,3,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,3,-10,-33,-17,3,-26,3,-27,-28,-14,-82,-41,-36,-38,-40,-35,-37,3,-18,-16,-81,-20,3,-19,-21,-13,-8,-12,-15,-9,-11,]),'GLOBAL':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[4,4,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,4,-18,-16,-81,-20,4,-19,-21,-13,-8,-12,-15,-9,-11,]),'NUMBER':([54,89,90,92,99,104,106,125,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,190,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[85,85,85,85,85,85,85,184,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,261,85,85,-98,-82,85,85,85,85,-81,85,-88,85,-97,85,-95,-89,-94,-99,85,-90,-92,-100,-101,-93,-91,-96,]),',':([5,20,22,32,44,45,46,47,49,55,58,60,61,62,64,65,66,70,76,78,79,82,84,85,88,94,95,97,98,100,101,103,118,119,123,128,129,132,134,137,138,142,144,161,164,165,167,173,182,183,184,191,193,196,199,201,202,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,240,260,261,262,265,267,270,272,276,283,285,289,307,310,325,329,330,333,334,336,337,341,357,359,362,363,],[-70,-62,-61,51,51,68,-65,69,51,51,51,51,51,-60,51,51,116,122,-80,126,127,131,-139,-138,-115,-107,-104,-137,-106,-110,-142,-140,175,177,-64,51,-51,51,-109,-132,-131,-105,-133,-130,51,51,-141,233,-78,-77,-79,-52,131,-142,266,-111,269,-134,-126,-129,-116,-125,-124,-122,-123,-119,-120,-121,-118,-117,-128,-127,51,-56,-54,-55,-135,-113,-136,-108,51,51,319,51,-53,335,345,348,349,352,-112,-102,-114,51,51,367,370,-103,]),'GT':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,156,-140,-109,156,156,156,-105,-133,-130,156,-141,156,-111,-134,156,-129,-116,156,156,-122,-123,-119,-120,-121,-118,-117,-128,156,156,-135,-113,-136,-108,156,-137,156,156,156,-112,-102,-114,156,-103,156,]),'NEW':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,-98,-82,87,87,87,87,-81,87,-88,87,-97,87,-95,-89,-94,-99,87,-90,-92,-100,-101,-93,-91,-96,]),'RIGHTSHIFT':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,159,-140,-109,159,159,159,-105,-133,-130,159,-141,159,-111,-134,159,-129,-116,159,159,159,159,-119,159,159,-118,-117,-128,159,159,-135,-113,-136,-108,159,-137,159,159,159,-112,-102,-114,159,-103,159,]),'CHECK_NEXT_CYCLE':([181,251,252,257,297,304,326,346,351,358,361,372,374,375,376,378,381,382,],[248,248,-98,-82,-81,-88,-97,-95,-89,-94,-99,-90,-92,-100,-101,-93,-91,-96,]),'DOT':([5,20,22,62,84,85,88,94,95,97,98,100,101,103,134,142,167,201,203,265,267,270,272,310,334,336,337,363,],[-70,-62,-61,-60,-139,-138,136,-107,-104,-137,-106,-110,-142,-140,-109,-105,-141,-111,-134,-135,-113,-136,-108,-137,-112,-102,-114,-103,]),'LEFTSHIFT':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,147,-140,-109,147,147,147,-105,-133,-130,147,-141,147,-111,-134,147,-129,-116,147,147,147,147,-119,147,147,-118,-117,-128,147,147,-135,-113,-136,-108,147,-137,147,147,147,-112,-102,-114,147,-103,147,]),'INCR':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,-98,-82,90,90,90,90,-81,90,-88,90,-97,90,-95,-89,-94,-99,90,-90,-92,-100,-101,-93,-91,-96,]),'LE':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,152,-140,-109,152,152,152,-105,-133,-130,152,-141,152,-111,-134,152,-129,-116,152,152,-122,-123,-119,-120,-121,-118,-117,-128,152,152,-135,-113,-136,-108,152,-137,152,152,152,-112,-102,-114,152,-103,152,]),'SEMI':([5,20,22,32,34,40,50,52,55,62,70,76,77,78,84,85,88,94,95,97,98,100,101,102,103,105,128,132,134,137,138,142,144,161,163,164,165,167,170,182,183,184,185,189,195,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,222,223,255,265,267,270,272,276,283,296,313,323,327,332,334,336,337,341,347,355,363,368,380,],[-70,-62,-61,-2,56,63,74,-74,-2,-60,120,-80,-73,-76,-139,-138,-115,-107,-104,-137,-106,-110,-142,150,-140,162,-2,-2,-109,-132,-131,-105,-133,-130,221,-2,-2,-141,230,-78,-77,-79,-75,259,264,-111,-134,-126,-129,-116,-125,-124,-122,-123,-119,-120,-121,-118,-117,-128,-127,274,275,304,-135,-113,-136,-108,-2,-2,326,338,343,346,351,-112,-102,-114,-2,358,364,-103,374,382,]),'STATIC_CAST':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,-98,-82,91,91,91,91,-81,91,-88,91,-97,91,-95,-89,-94,-99,91,-90,-92,-100,-101,-93,-91,-96,]),')':([5,20,22,44,46,49,52,53,57,58,60,61,62,64,65,67,73,76,77,78,79,80,81,82,83,84,85,88,94,95,97,98,100,101,103,107,108,109,111,113,114,115,119,123,127,129,131,134,137,138,140,142,144,145,161,167,182,183,184,185,186,188,191,192,193,194,196,197,198,199,201,203,204,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,240,242,243,244,260,261,262,265,266,267,268,270,271,272,289,292,298,307,308,309,310,311,312,322,328,331,334,336,337,353,357,359,360,363,365,373,377,],[-70,-62,-61,-2,-65,-2,-74,-2,-2,-2,112,-2,-60,-2,-2,117,124,-80,-73,-76,-49,128,-50,-58,132,-139,-138,-115,-107,-104,-137,-106,-110,-142,-140,164,165,166,168,170,171,172,176,-64,-2,-51,-2,-109,-132,-131,203,-105,-133,-2,-130,-141,-78,-77,-79,-75,-48,-50,-52,-57,-58,-59,-142,265,-87,-86,-111,-134,270,272,-126,-129,-116,-125,-124,-122,-123,-119,-120,-121,-118,-117,-128,-127,-2,-71,-72,294,-56,-54,-55,-135,-2,-113,-2,-136,-2,-108,-2,323,327,-53,-85,334,-137,336,337,342,347,350,-112,-102,-114,363,-2,366,368,-103,371,379,380,]),'(':([4,5,6,9,10,17,18,19,23,24,26,32,35,54,86,89,90,91,92,93,99,101,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,201,205,245,246,248,249,250,251,252,253,254,256,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[28,-70,29,30,31,36,37,38,41,42,43,53,57,92,133,92,92,139,92,141,92,145,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,92,268,271,295,92,298,299,300,92,-98,302,303,306,-82,92,92,92,92,-81,92,-88,92,-97,92,-95,-89,-94,-99,92,-90,-92,-100,-101,-93,-91,-96,]),'IS_INVALID':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,-98,-82,93,93,93,93,-81,93,-88,93,-97,93,-95,-89,-94,-99,93,-90,-92,-100,-101,-93,-91,-96,]),'NE':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,149,-140,-109,149,149,149,-105,-133,-130,149,-141,149,-111,-134,149,-129,-116,-125,-124,-122,-123,-119,-120,-121,-118,-117,-128,149,149,-135,-113,-136,-108,149,-137,149,149,149,-112,-102,-114,149,-103,149,]),'OUT_PORT':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[6,6,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,6,-18,-16,-81,-20,6,-19,-21,-13,-8,-12,-15,-9,-11,]),'ENQUEUE':([181,251,252,257,297,304,326,346,351,358,361,372,374,375,376,378,381,382,],[250,250,-98,-82,-81,-88,-97,-95,-89,-94,-99,-90,-92,-100,-101,-93,-91,-96,]),'LT':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,155,-140,-109,155,155,155,-105,-133,-130,155,-141,155,-111,-134,155,-129,-116,155,155,-122,-123,-119,-120,-121,-118,-117,-128,155,155,-135,-113,-136,-108,155,-137,155,155,155,-112,-102,-114,155,-103,155,]),'DOUBLE_COLON':([5,20,22,62,96,101,],[-70,39,-61,-60,143,-61,]),'PLUS':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,157,-140,-109,157,157,157,-105,-133,-130,157,-141,157,-111,-134,157,157,-116,157,157,157,157,-119,157,157,-118,-117,157,157,157,-135,-113,-136,-108,157,-137,157,157,157,-112,-102,-114,157,-103,157,]),'DECR':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,-98,-82,89,89,89,89,-81,89,-88,89,-97,89,-95,-89,-94,-99,89,-90,-92,-100,-101,-93,-91,-96,]),'ACTION':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[10,10,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,10,-18,-16,-81,-20,10,-19,-21,-13,-8,-12,-15,-9,-11,]),':':([5,59,101,112,168,],[-70,110,110,169,225,]),'=':([5,75,],[-70,125,]),'ASSIGN':([5,20,22,32,55,62,84,85,88,94,95,97,98,100,101,103,129,134,137,138,142,144,161,167,191,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,283,334,336,337,363,],[-70,-62,-61,54,106,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,-140,190,-109,-132,-131,-105,-133,-130,-141,263,-111,-134,-126,-129,-116,-125,-124,-122,-123,-119,-120,-121,-118,-117,-128,-127,305,-135,-113,-136,-108,54,-112,-102,-114,-103,]),'$end':([0,1,2,5,7,8,12,13,15,25,27,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,290,293,297,314,318,320,324,340,343,344,354,356,],[-2,-2,-29,-70,0,-34,-5,-3,-39,-1,-4,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,-18,-16,-81,-20,-19,-21,-13,-8,-12,-15,-9,-11,]),'IDENT':([0,1,2,3,5,8,11,15,16,20,22,28,29,30,31,33,36,37,38,39,41,42,43,46,48,51,53,54,56,57,62,63,68,69,70,74,82,87,89,90,92,96,99,101,104,106,110,116,120,122,123,125,126,127,130,131,133,135,136,139,141,143,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,162,169,174,175,176,177,180,181,187,221,224,225,226,228,230,231,232,233,234,236,238,239,241,246,251,252,257,258,259,264,266,268,269,271,273,274,275,278,282,287,290,293,294,295,297,299,300,302,303,304,305,306,314,316,318,319,320,324,326,335,338,340,343,344,345,346,348,349,351,354,356,358,361,364,367,372,374,375,376,378,381,382,],[5,5,-29,-63,-70,-34,5,-39,5,-62,-61,5,5,5,5,5,5,5,5,5,5,5,5,-65,5,5,5,5,-6,5,-60,-7,5,5,5,-30,5,5,5,5,5,5,5,-61,5,5,5,5,5,5,-64,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,-32,5,5,5,5,5,5,5,5,5,5,-31,5,5,5,5,5,-10,5,5,-33,5,5,5,5,-17,5,5,5,-26,5,-27,-28,5,5,5,-98,-82,-41,-36,-38,5,5,5,5,-40,-35,-37,5,5,5,-18,-16,5,5,-81,5,5,5,5,-88,5,5,-20,5,-19,5,-21,5,-97,5,-44,-8,-12,-15,5,-95,5,5,-89,-9,-11,-94,-99,-47,5,-90,-92,-100,-101,-93,-91,-96,]),'PROTOCOL':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[14,14,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,14,-18,-16,-81,-20,14,-19,-21,-13,-8,-12,-15,-9,-11,]),'STRING':([14,21,51,54,89,90,92,99,104,106,125,126,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,190,246,251,252,257,263,266,268,269,271,297,303,304,305,326,335,346,351,352,358,361,367,370,372,374,375,376,378,381,382,],[34,40,76,97,97,97,97,97,97,97,183,76,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,260,97,97,-98,-82,307,97,97,310,97,-81,97,-88,97,-97,97,-95,-89,362,-94,-99,97,377,-90,-92,-100,-101,-93,-91,-96,]),'STALL_AND_WAIT':([181,251,252,257,297,304,326,346,351,358,361,372,374,375,376,378,381,382,],[253,253,-98,-82,-81,-88,-97,-95,-89,-94,-99,-90,-92,-100,-101,-93,-91,-96,]),'OOD':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,-98,-82,100,100,100,100,-81,100,-88,100,-97,100,-95,-89,-94,-99,100,-90,-92,-100,-101,-93,-91,-96,]),'ENUM':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[17,17,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,17,-18,-16,-81,-20,17,-19,-21,-13,-8,-12,-15,-9,-11,]),'ELSE':([257,297,361,],[-82,-81,369,]),'MACHINE':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[18,18,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,18,-18,-16,-81,-20,18,-19,-21,-13,-8,-12,-15,-9,-11,]),'GE':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,153,-140,-109,153,153,153,-105,-133,-130,153,-141,153,-111,-134,153,-129,-116,153,153,-122,-123,-119,-120,-121,-118,-117,-128,153,153,-135,-113,-136,-108,153,-137,153,153,153,-112,-102,-114,153,-103,153,]),'EXTERN_TYPE':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[19,19,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,19,-18,-16,-81,-20,19,-19,-21,-13,-8,-12,-15,-9,-11,]),'[':([5,20,22,62,84,85,88,94,95,97,98,100,101,103,134,142,167,201,203,265,267,270,272,310,334,336,337,363,],[-70,-62,-61,-60,-139,-138,135,-107,-104,-137,-106,-110,-142,-140,-109,-105,-141,-111,-134,-135,-113,-136,-108,-137,-112,-102,-114,-103,]),'INCLUDE':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[21,21,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,21,-18,-16,-81,-20,21,-19,-21,-13,-8,-12,-15,-9,-11,]),']':([5,20,22,62,84,85,88,94,95,97,98,100,101,103,134,135,137,138,142,144,161,167,198,199,200,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,265,266,267,270,272,308,334,336,337,363,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,-140,-109,-2,-132,-131,-105,-133,-130,-141,-87,-86,267,-111,-134,-126,-129,-116,-125,-124,-122,-123,-119,-120,-121,-118,-117,-128,-127,-135,-2,-113,-136,-108,-85,-112,-102,-114,-103,]),'IF':([181,251,252,257,297,304,326,346,351,358,361,369,372,374,375,376,378,381,382,],[254,254,-98,-82,-81,-88,-97,-95,-89,-94,-99,254,-90,-92,-100,-101,-93,-91,-96,]),'AND':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,146,-140,-109,146,146,146,-105,-133,-130,146,-141,146,-111,-134,-126,-129,-116,-125,-124,-122,-123,-119,-120,-121,-118,-117,-128,146,146,-135,-113,-136,-108,146,-137,146,146,146,-112,-102,-114,146,-103,146,]),'DASH':([5,20,22,54,62,84,85,88,89,90,92,94,95,97,98,99,100,101,102,103,104,106,134,135,137,138,140,142,144,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,161,163,167,181,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,246,251,252,255,257,265,266,267,268,269,270,271,272,296,297,303,304,305,310,311,326,331,332,334,335,336,337,346,351,353,358,361,363,367,372,373,374,375,376,378,381,382,],[-70,-62,-61,99,-60,-139,-138,-115,99,99,99,-107,-104,-137,-106,99,-110,-142,154,-140,99,99,-109,99,154,154,154,-105,-133,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,-130,154,-141,99,154,-111,-134,154,154,-116,154,154,154,154,-119,154,154,-118,-117,154,154,99,99,-98,154,-82,-135,99,-113,99,99,-136,99,-108,154,-81,99,-88,99,-137,154,-97,154,154,-112,99,-102,-114,-95,-89,154,-94,-99,-103,99,-90,154,-92,-100,-101,-93,-91,-96,]),'RETURN':([181,251,252,257,297,304,326,346,351,358,361,372,374,375,376,378,381,382,],[246,246,-98,-82,-81,-88,-97,-95,-89,-94,-99,-90,-92,-100,-101,-93,-91,-96,]),'EQ':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,151,-140,-109,151,151,151,-105,-133,-130,151,-141,151,-111,-134,151,-129,-116,-125,-124,-122,-123,-119,-120,-121,-118,-117,-128,151,151,-135,-113,-136,-108,151,-137,151,151,151,-112,-102,-114,151,-103,151,]),'STRUCT':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[23,23,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,23,-18,-16,-81,-20,23,-19,-21,-13,-8,-12,-15,-9,-11,]),'CHECK_STOP_SLOTS':([181,251,252,257,297,304,326,346,351,358,361,372,374,375,376,378,381,382,],[256,256,-98,-82,-81,-88,-97,-95,-89,-94,-99,-90,-92,-100,-101,-93,-91,-96,]),'STATE_DECL':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[24,24,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,24,-18,-16,-81,-20,24,-19,-21,-13,-8,-12,-15,-9,-11,]),'CHECK_ALLOCATE':([181,251,252,257,297,304,326,346,351,358,361,372,374,375,376,378,381,382,],[249,249,-98,-82,-81,-88,-97,-95,-89,-94,-99,-90,-92,-100,-101,-93,-91,-96,]),'LIT_BOOL':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,190,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,262,103,103,-98,-82,103,103,103,103,-81,103,-88,103,-97,103,-95,-89,-94,-99,103,-90,-92,-100,-101,-93,-91,-96,]),'IS_VALID':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,-98,-82,86,86,86,86,-81,86,-88,86,-97,86,-95,-89,-94,-99,86,-90,-92,-100,-101,-93,-91,-96,]),'NOT':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,252,257,266,268,269,271,297,303,304,305,326,335,346,351,358,361,367,372,374,375,376,378,381,382,],[104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,-98,-82,104,104,104,104,-81,104,-88,104,-97,104,-95,-89,-94,-99,104,-90,-92,-100,-101,-93,-91,-96,]),'{':([5,30,46,52,69,74,76,77,78,117,123,124,128,150,162,164,166,169,171,172,176,182,183,184,185,189,221,222,225,226,227,229,241,280,281,294,324,342,350,366,369,371,379,],[-70,48,-65,-74,48,-30,-80,-73,-76,174,-64,181,-2,-32,-31,-2,224,-2,231,232,48,-78,-77,-79,-75,181,-33,181,-2,-2,282,-23,48,316,-22,48,48,181,181,181,181,181,181,]),'}':([1,2,5,8,12,13,15,27,46,48,56,63,70,71,72,74,120,121,122,123,150,162,174,178,179,180,181,221,224,230,231,232,234,235,236,237,238,239,241,247,251,252,257,258,259,264,273,274,275,277,278,279,282,284,286,287,288,290,291,293,297,301,304,314,315,316,317,318,320,321,324,326,338,339,340,343,344,346,351,354,356,358,361,364,372,374,375,376,378,381,382,],[-2,-29,-70,-34,-5,-3,-39,-4,-65,-2,-6,-7,-2,123,-69,-30,-2,-68,-2,-64,-32,-31,-2,-66,-67,-10,257,-33,-2,-17,-2,-2,-26,290,-2,-25,-27,-28,-14,297,-84,-98,-82,-41,-36,-38,-40,-35,-37,314,-2,-43,-2,318,320,-2,-46,-18,-24,-16,-81,-83,-88,-20,-42,-2,340,-19,-21,-45,-13,-97,-44,354,-8,-12,-15,-95,-89,-9,-11,-94,-99,-47,-90,-92,-100,-101,-93,-91,-96,]),'OR':([5,20,22,62,84,85,88,94,95,97,98,100,101,102,103,134,137,138,140,142,144,161,163,167,199,201,203,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,265,267,270,272,296,310,311,331,332,334,336,337,353,363,373,],[-70,-62,-61,-60,-139,-138,-115,-107,-104,-137,-106,-110,-142,160,-140,-109,160,160,160,-105,-133,-130,160,-141,160,-111,-134,-126,-129,-116,-125,-124,-122,-123,-119,-120,-121,-118,-117,-128,-127,160,-135,-113,-136,-108,160,-137,160,160,160,-112,-102,-114,160,-103,160,]),'IN_PORT':([0,1,2,5,8,15,46,56,63,74,123,150,162,180,221,230,241,257,258,259,264,273,274,275,282,290,293,297,314,316,318,320,324,340,343,344,354,356,],[26,26,-29,-70,-34,-39,-65,-6,-7,-30,-64,-32,-31,-10,-33,-17,-14,-82,-41,-36,-38,-40,-35,-37,26,-18,-16,-81,-20,26,-19,-21,-13,-8,-12,-15,-9,-11,]),}
+
+_lr_action = { }
+for _k, _v in _lr_action_items.items():
+   for _x,_y in zip(_v[0],_v[1]):
+      if not _x in _lr_action:  _lr_action[_x] = { }
+      _lr_action[_x][_k] = _y
+del _lr_action_items
+
+_lr_goto_items = {'decl':([0,1,282,316,],[1,1,1,1,]),'obj_decl':([0,1,169,174,225,226,231,236,282,316,],[2,2,226,234,226,226,234,234,2,2,]),'statements':([124,189,222,342,350,366,369,371,379,],[180,258,273,356,361,372,375,378,381,]),'type_enums':([224,278,],[277,315,]),'pairsx':([51,126,],[77,185,]),'type_members':([174,231,236,],[235,284,291,]),'ident_or_star':([177,],[244,]),'statements_inner':([181,251,],[247,301,]),'param':([53,57,127,],[79,79,79,]),'file':([0,],[7,]),'type_state':([232,287,],[287,287,]),'type_member':([174,231,236,],[236,236,236,]),'aexpr':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,266,268,269,271,303,305,335,367,],[88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,]),'enumeration':([37,54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,266,268,269,271,303,305,319,335,367,],[60,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,341,94,94,]),'literal':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,266,268,269,271,303,305,335,367,],[98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,]),'params':([53,57,127,],[80,107,186,]),'statement':([181,251,],[251,251,]),'var':([54,89,90,92,99,104,106,133,135,141,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,175,181,233,246,251,266,268,269,271,295,299,300,302,303,305,306,335,349,367,],[95,95,95,95,95,95,95,197,95,204,95,95,95,95,95,95,95,95,95,95,95,95,95,95,95,240,95,289,95,95,95,95,95,95,325,328,329,330,95,95,333,95,360,95,]),'if_statement':([181,251,369,],[252,252,376,]),'type':([0,1,28,36,38,41,42,53,54,57,68,87,89,90,92,99,104,106,116,127,131,135,139,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,169,174,181,225,226,231,236,246,251,266,268,269,271,282,303,305,316,335,345,348,367,],[11,11,44,58,61,64,65,82,96,82,118,134,96,96,96,96,96,96,173,187,193,96,202,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,228,11,96,228,228,11,11,96,96,96,96,96,96,11,96,96,11,96,357,359,96,]),'empty':([0,1,32,44,48,49,53,55,57,58,60,61,64,65,70,120,122,127,128,131,132,135,145,164,165,169,174,224,225,226,231,232,236,240,266,268,271,276,278,282,283,287,289,316,341,357,],[12,12,52,52,72,52,81,52,81,52,52,52,52,52,72,72,72,188,52,194,52,198,198,52,52,229,237,279,229,229,237,288,237,52,198,198,198,52,279,12,52,288,52,12,52,52,]),'declsx':([0,1,282,316,],[13,27,13,13,]),'func_decl':([0,1,174,231,236,282,316,],[8,8,238,238,238,8,8,]),'func_def':([0,1,174,231,236,282,316,],[15,15,239,239,239,15,15,]),'idents':([30,69,176,241,294,324,],[47,119,241,293,324,344,]),'void':([0,1,174,231,236,282,316,],[16,16,16,16,16,16,16,]),'identx':([48,70,120,122,],[71,121,178,179,]),'type_states':([232,287,],[286,321,]),'pair':([51,126,],[78,78,]),'type_enum':([224,278,],[278,278,]),'typestr':([0,1,28,36,38,41,42,53,54,57,68,87,89,90,92,99,104,106,116,127,131,135,139,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,169,174,181,225,226,231,236,246,251,266,268,269,271,282,303,305,316,335,345,348,367,],[20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,]),'types':([53,57,131,],[83,108,192,]),'pairs':([32,44,49,55,58,60,61,64,65,128,132,164,165,240,276,283,289,341,357,],[50,67,73,105,109,111,113,114,115,189,195,222,223,292,313,50,322,355,365,]),'ident':([0,1,11,16,28,29,30,31,33,36,37,38,39,41,42,43,48,51,53,54,57,68,69,70,82,87,89,90,92,96,99,104,106,110,116,120,122,125,126,127,130,131,133,135,136,139,141,143,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,169,174,175,176,177,181,187,224,225,226,228,231,232,233,236,241,246,251,266,268,269,271,278,282,287,294,295,299,300,302,303,305,306,316,319,324,335,345,348,349,367,],[22,22,32,35,22,45,46,49,55,22,59,22,62,22,22,66,70,75,22,101,22,22,46,70,129,22,101,101,101,142,101,101,101,167,22,70,70,182,75,22,191,22,196,101,201,22,196,205,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,22,22,196,46,242,101,129,276,22,22,283,22,285,196,22,46,101,101,101,101,101,101,276,22,285,46,196,196,196,196,101,101,196,22,59,46,101,22,22,196,101,]),'obj_decls':([169,225,226,],[227,280,281,]),'expr':([54,89,90,92,99,104,106,135,145,146,147,148,149,151,152,153,154,155,156,157,158,159,160,181,246,251,266,268,269,271,303,305,335,367,],[102,137,138,140,144,161,163,199,199,207,208,209,210,211,212,213,214,215,216,217,218,219,220,255,296,255,199,199,311,199,331,332,353,373,]),'exprs':([135,145,266,268,271,],[200,206,308,309,312,]),'decls':([0,282,316,],[25,317,339,]),}
+
+_lr_goto = { }
+for _k, _v in _lr_goto_items.items():
+   for _x,_y in zip(_v[0],_v[1]):
+       if not _x in _lr_goto: _lr_goto[_x] = { }
+       _lr_goto[_x][_k] = _y
+del _lr_goto_items
+_lr_productions = [
+  ("S' -> file","S'",1,None,None,None),
+  ('file -> decls','file',1,'p_file','/root/repo/src/mem/slicc/parser.py',218),
+  ('empty -> <empty>','empty',0,'p_empty','/root/repo/src/mem/slicc/parser.py',222),
+  ('decls -> declsx','decls',1,'p_decls','/root/repo/src/mem/slicc/parser.py',225),
+  ('declsx -> decl declsx','declsx',2,'p_declsx__list','/root/repo/src/mem/slicc/parser.py',229),
+  ('declsx -> empty','declsx',1,'p_declsx__none','/root/repo/src/mem/slicc/parser.py',239),
+  ('decl -> PROTOCOL STRING SEMI','decl',3,'p_decl__protocol','/root/repo/src/mem/slicc/parser.py',243),
+  ('decl -> INCLUDE STRING SEMI','decl',3,'p_decl__include','/root/repo/src/mem/slicc/parser.py',252),
+  ('decl -> MACHINE ( enumeration ) : obj_decls { decls }','decl',9,'p_decl__machine0','/root/repo/src/mem/slicc/parser.py',261),
+  ('decl -> MACHINE ( enumeration pairs ) : obj_decls { decls }','decl',10,'p_decl__machine1','/root/repo/src/mem/slicc/parser.py',265),
+  ('decl -> ACTION ( ident pairs ) statements','decl',6,'p_decl__action','/root/repo/src/mem/slicc/parser.py',269),
+  ('decl -> IN_PORT ( ident , type , var pairs ) statements','decl',10,'p_decl__in_port','/root/repo/src/mem/slicc/parser.py',273),
+  ('decl -> OUT_PORT ( ident , type , var pairs ) SEMI','decl',10,'p_decl__out_port','/root/repo/src/mem/slicc/parser.py',277),
+  ('decl -> TRANS ( idents , idents , ident_or_star ) idents','decl',9,'p_decl__trans0','/root/repo/src/mem/slicc/parser.py',281),
+  ('decl -> TRANS ( idents , idents ) idents','decl',7,'p_decl__trans1','/root/repo/src/mem/slicc/parser.py',285),
+  ('decl -> TRANS ( idents , idents , ident_or_star ) idents idents','decl',10,'p_decl__trans2','/root/repo/src/mem/slicc/parser.py',289),
+  ('decl -> TRANS ( idents , idents ) idents idents','decl',8,'p_decl__trans3','/root/repo/src/mem/slicc/parser.py',293),
+  ('decl -> EXTERN_TYPE ( type pairs ) SEMI','decl',6,'p_decl__extern0','/root/repo/src/mem/slicc/parser.py',297),
+  ('decl -> GLOBAL ( type pairs ) { type_members }','decl',8,'p_decl__global','/root/repo/src/mem/slicc/parser.py',302),
+  ('decl -> STRUCT ( type pairs ) { type_members }','decl',8,'p_decl__struct','/root/repo/src/mem/slicc/parser.py',307),
+  ('decl -> ENUM ( type pairs ) { type_enums }','decl',8,'p_decl__enum','/root/repo/src/mem/slicc/parser.py',311),
+  ('decl -> STATE_DECL ( type pairs ) { type_states }','decl',8,'p_decl__state_decl','/root/repo/src/mem/slicc/parser.py',316),
+  ('obj_decls -> obj_decl obj_decls','obj_decls',2,'p_obj_decls__list','/root/repo/src/mem/slicc/parser.py',323),
+  ('obj_decls -> empty','obj_decls',1,'p_obj_decls__empty','/root/repo/src/mem/slicc/parser.py',327),
+  ('type_members -> type_member type_members','type_members',2,'p_type_members__list','/root/repo/src/mem/slicc/parser.py',331),
+  ('type_members -> empty','type_members',1,'p_type_members__empty','/root/repo/src/mem/slicc/parser.py',335),
+  ('type_member -> obj_decl','type_member',1,'p_type_member__0','/root/repo/src/mem/slicc/parser.py',339),
+  ('type_member -> func_decl','type_member',1,'p_type_member__0','/root/repo/src/mem/slicc/parser.py',340),
+  ('type_member -> func_def','type_member',1,'p_type_member__0','/root/repo/src/mem/slicc/parser.py',341),
+  ('decl -> obj_decl','decl',1,'p_decl__obj_decl','/root/repo/src/mem/slicc/parser.py',346),
+  ('obj_decl -> type ident pairs SEMI','obj_decl',4,'p_obj_decl__0','/root/repo/src/mem/slicc/parser.py',350),
+  ('obj_decl -> type STAR ident pairs SEMI','obj_decl',5,'p_obj_decl__1','/root/repo/src/mem/slicc/parser.py',354),
+  ('obj_decl -> type ident ASSIGN expr SEMI','obj_decl',5,'p_obj_decl__2','/root/repo/src/mem/slicc/parser.py',358),
+  ('obj_decl -> type STAR ident ASSIGN expr SEMI','obj_decl',6,'p_obj_decl__3','/root/repo/src/mem/slicc/parser.py',363),
+  ('decl -> func_decl','decl',1,'p_decl__func_decl','/root/repo/src/mem/slicc/parser.py',369),
+  ('func_decl -> void ident ( params ) pairs SEMI','func_decl',7,'p_func_decl__0','/root/repo/src/mem/slicc/parser.py',373),
+  ('func_decl -> type ident ( params ) pairs SEMI','func_decl',7,'p_func_decl__0','/root/repo/src/mem/slicc/parser.py',374),
+  ('func_decl -> void ident ( types ) pairs SEMI','func_decl',7,'p_func_decl__1','/root/repo/src/mem/slicc/parser.py',378),
+  ('func_decl -> type ident ( types ) pairs SEMI','func_decl',7,'p_func_decl__1','/root/repo/src/mem/slicc/parser.py',379),
+  ('decl -> func_def','decl',1,'p_decl__func_def','/root/repo/src/mem/slicc/parser.py',383),
+  ('func_def -> void ident ( params ) pairs statements','func_def',7,'p_func_def__0','/root/repo/src/mem/slicc/parser.py',387),
+  ('func_def -> type ident ( params ) pairs statements','func_def',7,'p_func_def__0','/root/repo/src/mem/slicc/parser.py',388),
+  ('type_enums -> type_enum type_enums','type_enums',2,'p_type_enums__list','/root/repo/src/mem/slicc/parser.py',393),
+  ('type_enums -> empty','type_enums',1,'p_type_enums__empty','/root/repo/src/mem/slicc/parser.py',397),
+  ('type_enum -> ident pairs SEMI','type_enum',3,'p_type_enum','/root/repo/src/mem/slicc/parser.py',401),
+  ('type_states -> type_state type_states','type_states',2,'p_type_states__list','/root/repo/src/mem/slicc/parser.py',406),
+  ('type_states -> empty','type_states',1,'p_type_states__empty','/root/repo/src/mem/slicc/parser.py',410),
+  ('type_state -> ident , enumeration pairs SEMI','type_state',5,'p_type_state','/root/repo/src/mem/slicc/parser.py',414),
+  ('params -> param , params','params',3,'p_params__many','/root/repo/src/mem/slicc/parser.py',419),
+  ('params -> param','params',1,'p_params__one','/root/repo/src/mem/slicc/parser.py',423),
+  ('params -> empty','params',1,'p_params__none','/root/repo/src/mem/slicc/parser.py',427),
+  ('param -> type ident','param',2,'p_param','/root/repo/src/mem/slicc/parser.py',431),
+  ('param -> type STAR ident','param',3,'p_param__pointer','/root/repo/src/mem/slicc/parser.py',435),
+  ('param -> type STAR ident ASSIGN STRING','param',5,'p_param__pointer_default','/root/repo/src/mem/slicc/parser.py',439),
+  ('param -> type ident ASSIGN NUMBER','param',4,'p_param__default_number','/root/repo/src/mem/slicc/parser.py',443),
+  ('param -> type ident ASSIGN LIT_BOOL','param',4,'p_param__default_bool','/root/repo/src/mem/slicc/parser.py',447),
+  ('param -> type ident ASSIGN STRING','param',4,'p_param__default_string','/root/repo/src/mem/slicc/parser.py',451),
+  ('types -> type , types','types',3,'p_types__multiple','/root/repo/src/mem/slicc/parser.py',456),
+  ('types -> type','types',1,'p_types__one','/root/repo/src/mem/slicc/parser.py',460),
+  ('types -> empty','types',1,'p_types__empty','/root/repo/src/mem/slicc/parser.py',464),
+  ('typestr -> typestr DOUBLE_COLON ident','typestr',3,'p_typestr__multi','/root/repo/src/mem/slicc/parser.py',468),
+  ('typestr -> ident','typestr',1,'p_typestr__single','/root/repo/src/mem/slicc/parser.py',472),
+  ('type -> typestr','type',1,'p_type__one','/root/repo/src/mem/slicc/parser.py',476),
+  ('void -> VOID','void',1,'p_void','/root/repo/src/mem/slicc/parser.py',480),
+  ('idents -> { identx }','idents',3,'p_idents__braced','/root/repo/src/mem/slicc/parser.py',485),
+  ('idents -> ident','idents',1,'p_idents__bare','/root/repo/src/mem/slicc/parser.py',489),
+  ('identx -> ident SEMI identx','identx',3,'p_identx__multiple_1','/root/repo/src/mem/slicc/parser.py',493),
+  ('identx -> ident , identx','identx',3,'p_identx__multiple_1','/root/repo/src/mem/slicc/parser.py',494),
+  ('identx -> ident identx','identx',2,'p_identx__multiple_2','/root/repo/src/mem/slicc/parser.py',498),
+  ('identx -> empty','identx',1,'p_identx__single','/root/repo/src/mem/slicc/parser.py',502),
+  ('ident -> IDENT','ident',1,'p_ident','/root/repo/src/mem/slicc/parser.py',506),
+  ('ident_or_star -> ident','ident_or_star',1,'p_ident_or_star','/root/repo/src/mem/slicc/parser.py',510),
+  ('ident_or_star -> STAR','ident_or_star',1,'p_ident_or_star','/root/repo/src/mem/slicc/parser.py',511),
+  ('pairs -> , pairsx','pairs',2,'p_pairs__list','/root/repo/src/mem/slicc/parser.py',516),
+  ('pairs -> empty','pairs',1,'p_pairs__empty','/root/repo/src/mem/slicc/parser.py',520),
+  ('pairsx -> pair , pairsx','pairsx',3,'p_pairsx__many','/root/repo/src/mem/slicc/parser.py',524),
+  ('pairsx -> pair','pairsx',1,'p_pairsx__one','/root/repo/src/mem/slicc/parser.py',529),
+  ('pair -> ident = STRING','pair',3,'p_pair__assign','/root/repo/src/mem/slicc/parser.py',534),
+  ('pair -> ident = ident','pair',3,'p_pair__assign','/root/repo/src/mem/slicc/parser.py',535),
+  ('pair -> ident = NUMBER','pair',3,'p_pair__assign','/root/repo/src/mem/slicc/parser.py',536),
+  ('pair -> STRING','pair',1,'p_pair__literal','/root/repo/src/mem/slicc/parser.py',540),
+  ('statements -> { statements_inner }','statements',3,'p_statements__inner','/root/repo/src/mem/slicc/parser.py',545),
+  ('statements -> { }','statements',2,'p_statements__none','/root/repo/src/mem/slicc/parser.py',549),
+  ('statements_inner -> statement statements_inner','statements_inner',2,'p_statements_inner__many','/root/repo/src/mem/slicc/parser.py',553),
+  ('statements_inner -> statement','statements_inner',1,'p_statements_inner__one','/root/repo/src/mem/slicc/parser.py',557),
+  ('exprs -> expr , exprs','exprs',3,'p_exprs__multiple','/root/repo/src/mem/slicc/parser.py',561),
+  ('exprs -> expr','exprs',1,'p_exprs__one','/root/repo/src/mem/slicc/parser.py',565),
+  ('exprs -> empty','exprs',1,'p_exprs__empty','/root/repo/src/mem/slicc/parser.py',569),
+  ('statement -> expr SEMI','statement',2,'p_statement__expression','/root/repo/src/mem/slicc/parser.py',573),
+  ('statement -> expr ASSIGN expr SEMI','statement',4,'p_statement__assign','/root/repo/src/mem/slicc/parser.py',577),
+  ('statement -> ENQUEUE ( var , type ) statements','statement',7,'p_statement__enqueue','/root/repo/src/mem/slicc/parser.py',581),
+  ('statement -> ENQUEUE ( var , type , expr ) statements','statement',9,'p_statement__enqueue_latency','/root/repo/src/mem/slicc/parser.py',585),
+  ('statement -> STALL_AND_WAIT ( var , var ) SEMI','statement',7,'p_statement__stall_and_wait','/root/repo/src/mem/slicc/parser.py',589),
+  ('statement -> PEEK ( var , type pairs ) statements','statement',8,'p_statement__peek','/root/repo/src/mem/slicc/parser.py',593),
+  ('statement -> CHECK_ALLOCATE ( var ) SEMI','statement',5,'p_statement__check_allocate','/root/repo/src/mem/slicc/parser.py',597),
+  ('statement -> CHECK_NEXT_CYCLE ( ) SEMI','statement',4,'p_statement__check_next_cycle','/root/repo/src/mem/slicc/parser.py',601),
+  ('statement -> CHECK_STOP_SLOTS ( var , STRING , STRING ) SEMI','statement',9,'p_statement__check_stop','/root/repo/src/mem/slicc/parser.py',605),
+  ('statement -> RETURN expr SEMI','statement',3,'p_statement__return','/root/repo/src/mem/slicc/parser.py',609),
+  ('statement -> if_statement','statement',1,'p_statement__if','/root/repo/src/mem/slicc/parser.py',613),
+  ('if_statement -> IF ( expr ) statements','if_statement',5,'p_if_statement__if','/root/repo/src/mem/slicc/parser.py',617),
+  ('if_statement -> IF ( expr ) statements ELSE statements','if_statement',7,'p_if_statement__if_else','/root/repo/src/mem/slicc/parser.py',621),
+  ('if_statement -> IF ( expr ) statements ELSE if_statement','if_statement',7,'p_statement__if_else_if','/root/repo/src/mem/slicc/parser.py',625),
+  ('aexpr -> STATIC_CAST ( type , expr )','aexpr',6,'p_expr__static_cast','/root/repo/src/mem/slicc/parser.py',630),
+  ('aexpr -> STATIC_CAST ( type , STRING , expr )','aexpr',8,'p_expr__static_cast_ptr','/root/repo/src/mem/slicc/parser.py',634),
+  ('aexpr -> var','aexpr',1,'p_expr__var','/root/repo/src/mem/slicc/parser.py',638),
+  ('aexpr -> type ident','aexpr',2,'p_expr__localvar','/root/repo/src/mem/slicc/parser.py',642),
+  ('aexpr -> literal','aexpr',1,'p_expr__literal','/root/repo/src/mem/slicc/parser.py',646),
+  ('aexpr -> enumeration','aexpr',1,'p_expr__enumeration','/root/repo/src/mem/slicc/parser.py',650),
+  ('aexpr -> ident ( exprs )','aexpr',4,'p_expr__func_call','/root/repo/src/mem/slicc/parser.py',654),
+  ('aexpr -> NEW type','aexpr',2,'p_expr__new','/root/repo/src/mem/slicc/parser.py',658),
+  ('aexpr -> OOD','aexpr',1,'p_expr__null','/root/repo/src/mem/slicc/parser.py',662),
+  ('aexpr -> aexpr DOT ident','aexpr',3,'p_expr__member','/root/repo/src/mem/slicc/parser.py',666),
+  ('aexpr -> aexpr DOT ident ( exprs )','aexpr',6,'p_expr__member_method_call','/root/repo/src/mem/slicc/parser.py',670),
+  ('aexpr -> aexpr [ exprs ]','aexpr',4,'p_expr__member_method_call_lookup','/root/repo/src/mem/slicc/parser.py',675),
+  ('aexpr -> type DOUBLE_COLON ident ( exprs )','aexpr',6,'p_expr__class_method_call','/root/repo/src/mem/slicc/parser.py',680),
+  ('expr -> aexpr','expr',1,'p_expr__aexpr','/root/repo/src/mem/slicc/parser.py',685),
+  ('expr -> expr STAR expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',689),
+  ('expr -> expr SLASH expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',690),
+  ('expr -> expr PLUS expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',691),
+  ('expr -> expr DASH expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',692),
+  ('expr -> expr LT expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',693),
+  ('expr -> expr GT expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',694),
+  ('expr -> expr LE expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',695),
+  ('expr -> expr GE expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',696),
+  ('expr -> expr EQ expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',697),
+  ('expr -> expr NE expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',698),
+  ('expr -> expr AND expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',699),
+  ('expr -> expr OR expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',700),
+  ('expr -> expr RIGHTSHIFT expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',701),
+  ('expr -> expr LEFTSHIFT expr','expr',3,'p_expr__binary_op','/root/repo/src/mem/slicc/parser.py',702),
+  ('expr -> NOT expr','expr',2,'p_expr__unary_op','/root/repo/src/mem/slicc/parser.py',707),
+  ('expr -> INCR expr','expr',2,'p_expr__unary_op','/root/repo/src/mem/slicc/parser.py',708),
+  ('expr -> DECR expr','expr',2,'p_expr__unary_op','/root/repo/src/mem/slicc/parser.py',709),
+  ('expr -> DASH expr','expr',2,'p_expr__unary_op','/root/repo/src/mem/slicc/parser.py',710),
+  ('aexpr -> ( expr )','aexpr',3,'p_expr__parens','/root/repo/src/mem/slicc/parser.py',714),
+  ('aexpr -> IS_VALID ( var )','aexpr',4,'p_expr__is_valid_ptr','/root/repo/src/mem/slicc/parser.py',718),
+  ('aexpr -> IS_INVALID ( var )','aexpr',4,'p_expr__is_invalid_ptr','/root/repo/src/mem/slicc/parser.py',722),
+  ('literal -> STRING','literal',1,'p_literal__string','/root/repo/src/mem/slicc/parser.py',726),
+  ('literal -> NUMBER','literal',1,'p_literal__number','/root/repo/src/mem/slicc/parser.py',730),
+  ('literal -> FLOATNUMBER','literal',1,'p_literal__float','/root/repo/src/mem/slicc/parser.py',734),
+  ('literal -> LIT_BOOL','literal',1,'p_literal__bool','/root/repo/src/mem/slicc/parser.py',738),
+  ('enumeration -> ident : ident','enumeration',3,'p_enumeration','/root/repo/src/mem/slicc/parser.py',742),
+  ('var -> ident','var',1,'p_var','/root/repo/src/mem/slicc/parser.py',746),
+]
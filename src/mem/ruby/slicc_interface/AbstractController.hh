@@ -112,6 +112,24 @@ class AbstractController : public MemObject, public Consumer
     virtual int functionalWrite(const Addr &addr, PacketPtr) = 0;
     int functionalMemoryWrite(PacketPtr);
 
+    //! These functions are used by ruby system to install the lines of a
+    //! cache trace directly when restoring from a checkpoint, instead of
+    //! replaying the trace as timing requests. A line that the controller
+    //! with MachineID requestor recorded is installed in every controller
+    //! that canFunctionalInstall() it, which is true for the controllers
+    //! that aren't involved. Protocols support this if all their machines
+    //! define both functions.
+    virtual bool hasFunctionalInstall() const { return false; }
+    virtual bool canFunctionalInstall(const Addr &addr,
+                                      const RubyRequestType &type,
+                                      const MachineID &requestor)
+    { return false; }
+    virtual void functionalInstall(const Addr &addr,
+                                   const RubyRequestType &type,
+                                   const DataBlock &data,
+                                   const MachineID &requestor)
+    { fatal("Functional install not implemented!"); }
+
     //! Function for enqueuing a prefetch request
     virtual void enqueuePrefetch(const Addr &, const RubyRequestType&)
     { fatal("Prefetches not implemented!");}
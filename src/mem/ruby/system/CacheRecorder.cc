@@ -29,12 +29,38 @@
 
 #include "mem/ruby/system/CacheRecorder.hh"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "debug/RubyCacheTrace.hh"
+#include "mem/ruby/slicc_interface/AbstractController.hh"
 #include "mem/ruby/system/RubySystem.hh"
 #include "mem/ruby/system/Sequencer.hh"
+#include "sim/eventq.hh"
 
 using namespace std;
 
+// Write a line to memory through the controller that is in front of the
+// memory it maps to
+static void
+writeToMemory(const vector<AbstractController*>& controllers, Addr addr,
+              uint8_t* data, int size)
+{
+    for (auto cntrl : controllers) {
+        if (cntrl->getMemoryQueue() != NULL &&
+            cntrl->mapAddressToMachine(addr, cntrl->getType()) ==
+            cntrl->getMachineID()) {
+            auto req = std::make_shared<Request>(addr, size, 0,
+                                                 Request::funcMasterId);
+            Packet pkt(req, MemCmd::WriteReq);
+            pkt.dataStatic(data);
+            cntrl->functionalMemoryWrite(&pkt);
+            return;
+        }
+    }
+    warn("No memory controller for %#x, modified line is lost\n", addr);
+}
+
 void
 TraceRecord::print(ostream& out) const
 {
@@ -148,6 +174,102 @@ CacheRecorder::enqueueNextFetchRequest()
     }
 }
 
+void
+CacheRecorder::installRecords(const vector<AbstractController*>& controllers,
+                              bool write_skipped)
+{
+    const uint64_t record_size = sizeof(TraceRecord) + m_block_size_bytes;
+    const int block_size = RubySystem::getBlockSizeBytes();
+    const Tick curtick_original = curTick();
+    uint64_t installed = 0;
+    uint64_t skipped = 0;
+
+    // The records are sorted from the most to the least recently used
+    for (uint64_t offset = m_uncompressed_trace_size; offset >= record_size;
+         offset -= record_size) {
+        TraceRecord* rec =
+            (TraceRecord*) (m_uncompressed_trace + offset - record_size);
+        panic_if(rec->m_cntrl_id >= controllers.size(),
+                 "Cache trace record of unknown controller %d\n",
+                 rec->m_cntrl_id);
+        const MachineID requestor =
+            controllers[rec->m_cntrl_id]->getMachineID();
+
+        // Install the lines when they were last accessed, so that the
+        // replacement policies see the same order of accesses
+        curEventQueue()->setCurTick(min(rec->m_time, curtick_original));
+
+        for (int rec_bytes_read = 0; rec_bytes_read < m_block_size_bytes;
+                rec_bytes_read += block_size) {
+            const Addr addr = rec->m_data_address + rec_bytes_read;
+
+            bool can_install = true;
+            for (auto cntrl : controllers) {
+                if (!cntrl->canFunctionalInstall(addr, rec->m_type,
+                                                 requestor)) {
+                    can_install = false;
+                    break;
+                }
+            }
+
+            if (!can_install) {
+                DPRINTF(RubyCacheTrace, "Skipping %s at %#x\n", *rec, addr);
+                if (write_skipped && rec->m_type == RubyRequestType_ST) {
+                    writeToMemory(controllers, addr,
+                                  rec->m_data + rec_bytes_read, block_size);
+                }
+                skipped++;
+                continue;
+            }
+
+            DataBlock data;
+            data.setData(rec->m_data + rec_bytes_read, 0, block_size);
+            for (auto cntrl : controllers)
+                cntrl->functionalInstall(addr, rec->m_type, data, requestor);
+            installed++;
+        }
+        m_records_read++;
+    }
+
+    curEventQueue()->setCurTick(curtick_original);
+    m_bytes_read = m_uncompressed_trace_size;
+
+    DPRINTF(RubyCacheTrace, "Installed %d lines of %d records, skipped %d\n",
+            installed, m_records_read, skipped);
+    if (skipped) {
+        warn("%d cache lines of the checkpoint didn't fit in the caches\n",
+             skipped);
+    }
+}
+
+void
+CacheRecorder::writebackRecords(const vector<AbstractController*>& controllers)
+{
+    // A line can be modified in several caches, e.g. in an L1 and, with
+    // stale data, in the shared cache below it. The copy that was accessed
+    // last is the one that was written last.
+    unordered_map<Addr, const TraceRecord*> latest;
+    for (auto rec : m_records) {
+        if (rec->m_type != RubyRequestType_ST)
+            continue;
+        auto it = latest.emplace(rec->m_data_address, rec).first;
+        if (rec->m_time > it->second->m_time)
+            it->second = rec;
+    }
+
+    uint64_t written = 0;
+    for (auto rec : m_records) {
+        if (rec->m_type == RubyRequestType_ST &&
+            latest[rec->m_data_address] == rec) {
+            writeToMemory(controllers, rec->m_data_address, rec->m_data,
+                          m_block_size_bytes);
+            written++;
+        }
+    }
+    DPRINTF(RubyCacheTrace, "Wrote back %d of %d records\n", written,
+            m_records.size());
+}
+
 void
 CacheRecorder::addRecord(int cntrl, Addr data_addr, Addr pc_addr,
                          RubyRequestType type, Tick time, DataBlock& data)
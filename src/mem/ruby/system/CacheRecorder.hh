@@ -43,6 +43,7 @@
 #include "mem/ruby/common/DataBlock.hh"
 #include "mem/ruby/common/TypeDefines.hh"
 
+class AbstractController;
 class Sequencer;
 
 /*!
@@ -97,6 +98,27 @@ class CacheRecorder
      */
     void enqueueNextFetchRequest();
 
+    /*!
+     * Function for warming up the caches without simulating any requests.
+     * It goes through the recorded contents of the caches, from the least
+     * to the most recently used, and installs them in the controllers
+     * directly (see AbstractController::functionalInstall()) at the tick
+     * they were last accessed. Modified lines that can't be installed,
+     * e.g. because the caches are smaller than when the trace was
+     * recorded, are written to memory if write_skipped is set. This
+     * requires every controller to support functional installation.
+     */
+    void installRecords(const std::vector<AbstractController*>& controllers,
+                        bool write_skipped);
+
+    /*!
+     * Function for writing the recorded modified lines back to memory
+     * functionally, instead of issuing flush requests. If several caches
+     * recorded a line as modified, the copy that was accessed last is
+     * written. It can be used with any protocol.
+     */
+    void writebackRecords(const std::vector<AbstractController*>& controllers);
+
   private:
     // Private copy constructor and assignment operator
     CacheRecorder(const CacheRecorder& obj);
@@ -29,10 +29,12 @@
 #include "mem/ruby/system/RubySystem.hh"
 
 #include <fcntl.h>
+#include <unistd.h>
 #include <zlib.h>
 
 #include <cstdio>
 #include <list>
+#include <vector>
 
 #include "base/intmath.hh"
 #include "base/statistics.hh"
@@ -56,9 +58,12 @@ bool RubySystem::m_warmup_enabled = false;
 unsigned RubySystem::m_systems_to_warmup = 0;
 bool RubySystem::m_cooldown_enabled = false;
 
+// Number of records in each compressed chunk of cache traces
+static const uint64_t traceChunkRecords = 1 << 16;
+
 RubySystem::RubySystem(const Params *p)
     : ClockedObject(p), m_access_backing_store(p->access_backing_store),
-      m_cache_recorder(NULL)
+      m_functional_warmup(p->functional_warmup), m_cache_recorder(NULL)
 {
     m_randomization = p->randomization;
 
@@ -131,11 +136,22 @@ RubySystem::makeCacheRecorder(uint8_t *uncompressed_trace,
                                          sequencer_map, block_size_bytes);
 }
 
+bool
+RubySystem::canFunctionalWarmup() const
+{
+    if (!m_functional_warmup)
+        return false;
+
+    for (auto cntrl : m_abs_cntrl_vec) {
+        if (!cntrl->hasFunctionalInstall())
+            return false;
+    }
+    return true;
+}
+
 void
 RubySystem::memWriteback()
 {
-    m_cooldown_enabled = true;
-
     // Make the trace so we know what to write back.
     DPRINTF(RubyCacheTrace, "Recording Cache Trace\n");
     makeCacheRecorder(NULL, 0, getBlockSizeBytes());
@@ -144,6 +160,19 @@ RubySystem::memWriteback()
     }
     DPRINTF(RubyCacheTrace, "Cache Trace Complete\n");
 
+    if (m_functional_warmup) {
+        // The caches keep their contents, and memory gets the modified
+        // lines without simulating any flush requests. With a backing
+        // store, memory is always up to date.
+        if (!m_access_backing_store) {
+            DPRINTF(RubyCacheTrace, "Writing back modified lines\n");
+            m_cache_recorder->writebackRecords(m_abs_cntrl_vec);
+        }
+        return;
+    }
+
+    m_cooldown_enabled = true;
+
     // save the current tick value
     Tick curtick_original = curTick();
     DPRINTF(RubyCacheTrace, "Recording current tick %ld\n", curtick_original);
@@ -205,7 +234,9 @@ RubySystem::memWriteback()
 
 void
 RubySystem::writeCompressedTrace(uint8_t *raw_data, string filename,
-                                 uint64_t uncompressed_trace_size)
+                                 uint64_t uncompressed_trace_size,
+                                 uint64_t chunk_size,
+                                 vector<uint64_t> &offsets)
 {
     // Create the checkpoint file for the memory
     string thefile = CheckpointIn::dir() + "/" + filename.c_str();
@@ -216,19 +247,32 @@ RubySystem::writeCompressedTrace(uint8_t *raw_data, string filename,
         fatal("Can't open memory trace file '%s'\n", filename);
     }
 
-    gzFile compressedMemory = gzdopen(fd, "wb");
-    if (compressedMemory == NULL)
-        fatal("Insufficient memory to allocate compression state for %s\n",
-              filename);
+    // Every chunk is a gzip member of its own, so that the chunks can be
+    // decompressed in parallel when the trace is restored. gzip readers
+    // decompress the concatenation of the members as a whole.
+    offsets.clear();
+    uint64_t written = 0;
+    do {
+        const uint64_t size =
+            min(chunk_size, uncompressed_trace_size - written);
+        offsets.push_back(lseek(fd, 0, SEEK_END));
+
+        gzFile compressedMemory = gzdopen(dup(fd), "wb");
+        if (compressedMemory == NULL)
+            fatal("Insufficient memory to allocate compression state for "
+                  "%s\n", filename);
+
+        if (gzwrite(compressedMemory, raw_data + written, size) != size) {
+            fatal("Write failed on memory trace file '%s'\n", filename);
+        }
 
-    if (gzwrite(compressedMemory, raw_data, uncompressed_trace_size) !=
-        uncompressed_trace_size) {
-        fatal("Write failed on memory trace file '%s'\n", filename);
-    }
+        if (gzclose(compressedMemory)) {
+            fatal("Close failed on memory trace file '%s'\n", filename);
+        }
+        written += size;
+    } while (written < uncompressed_trace_size);
 
-    if (gzclose(compressedMemory)) {
-        fatal("Close failed on memory trace file '%s'\n", filename);
-    }
+    close(fd);
     delete[] raw_data;
 }
 
@@ -253,10 +297,16 @@ RubySystem::serialize(CheckpointOut &cp) const
     uint64_t cache_trace_size = m_cache_recorder->aggregateRecords(&raw_data,
                                                                  4096);
     string cache_trace_file = name() + ".cache.gz";
-    writeCompressedTrace(raw_data, cache_trace_file, cache_trace_size);
+    uint64_t cache_trace_chunk_size =
+        traceChunkRecords * (sizeof(TraceRecord) + block_size_bytes);
+    vector<uint64_t> cache_trace_offsets;
+    writeCompressedTrace(raw_data, cache_trace_file, cache_trace_size,
+                         cache_trace_chunk_size, cache_trace_offsets);
 
     SERIALIZE_SCALAR(cache_trace_file);
     SERIALIZE_SCALAR(cache_trace_size);
+    SERIALIZE_SCALAR(cache_trace_chunk_size);
+    SERIALIZE_CONTAINER(cache_trace_offsets);
 }
 
 void
@@ -272,33 +322,47 @@ RubySystem::drainResume()
 
 void
 RubySystem::readCompressedTrace(string filename, uint8_t *&raw_data,
-                                uint64_t &uncompressed_trace_size)
+                                uint64_t uncompressed_trace_size,
+                                uint64_t chunk_size,
+                                const vector<uint64_t> &offsets)
 {
-    // Read the trace file
-    gzFile compressedTrace;
+    raw_data = new uint8_t[uncompressed_trace_size];
 
-    // trace file
-    int fd = open(filename.c_str(), O_RDONLY);
-    if (fd < 0) {
-        perror("open");
-        fatal("Unable to open trace file %s", filename);
-    }
+    parallelRestore(offsets.size(), [&](size_t chunk) {
+        const uint64_t start = chunk * chunk_size;
+        if (start > uncompressed_trace_size)
+            fatal("Trace file %s has more chunks than data\n", filename);
+        const uint64_t size =
+            min(chunk_size, uncompressed_trace_size - start);
+
+        // Read the trace file
+        gzFile compressedTrace;
+
+        // trace file
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            perror("open");
+            fatal("Unable to open trace file %s", filename);
+        }
+        if (lseek(fd, offsets[chunk], SEEK_SET) < 0) {
+            perror("lseek");
+            fatal("Unable to seek in trace file %s", filename);
+        }
 
-    compressedTrace = gzdopen(fd, "rb");
-    if (compressedTrace == NULL) {
-        fatal("Insufficient memory to allocate compression state for %s\n",
-              filename);
-    }
+        compressedTrace = gzdopen(fd, "rb");
+        if (compressedTrace == NULL) {
+            fatal("Insufficient memory to allocate compression state for "
+                  "%s\n", filename);
+        }
 
-    raw_data = new uint8_t[uncompressed_trace_size];
-    if (gzread(compressedTrace, raw_data, uncompressed_trace_size) <
-            uncompressed_trace_size) {
-        fatal("Unable to read complete trace from file %s\n", filename);
-    }
+        if (gzread(compressedTrace, raw_data + start, size) < size) {
+            fatal("Unable to read complete trace from file %s\n", filename);
+        }
 
-    if (gzclose(compressedTrace)) {
-        fatal("Failed to close cache trace file '%s'\n", filename);
-    }
+        if (gzclose(compressedTrace)) {
+            fatal("Failed to close cache trace file '%s'\n", filename);
+        }
+    });
 }
 
 void
@@ -319,8 +383,18 @@ RubySystem::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(cache_trace_size);
     cache_trace_file = cp.cptDir + "/" + cache_trace_file;
 
+    // Traces of older checkpoints are a single chunk
+    uint64_t cache_trace_chunk_size = cache_trace_size;
+    vector<uint64_t> cache_trace_offsets(1, 0);
+    if (cp.entryExists(Serializable::currentSection(),
+                       "cache_trace_offsets")) {
+        UNSERIALIZE_SCALAR(cache_trace_chunk_size);
+        UNSERIALIZE_CONTAINER(cache_trace_offsets);
+    }
+
     readCompressedTrace(cache_trace_file, uncompressed_trace,
-                        cache_trace_size);
+                        cache_trace_size, cache_trace_chunk_size,
+                        cache_trace_offsets);
     m_warmup_enabled = true;
     m_systems_to_warmup++;
 
@@ -347,8 +421,23 @@ RubySystem::startup()
     // simulation starts. And then one also needs to hope that the time
     // Ruby finishes restoring the state is less than the time when the
     // state was checkpointed.
+    //
+    // None of this is needed if all controllers can install the lines of
+    // the trace directly (see AbstractController::functionalInstall()).
 
-    if (m_warmup_enabled) {
+    if (m_warmup_enabled && canFunctionalWarmup()) {
+        // Install the recorded lines without simulating any requests
+        DPRINTF(RubyCacheTrace, "Installing ruby cache contents\n");
+        m_cache_recorder->installRecords(m_abs_cntrl_vec,
+                                         !m_access_backing_store);
+
+        delete m_cache_recorder;
+        m_cache_recorder = NULL;
+        m_systems_to_warmup--;
+        if (m_systems_to_warmup == 0) {
+            m_warmup_enabled = false;
+        }
+    } else if (m_warmup_enabled) {
         DPRINTF(RubyCacheTrace, "Starting ruby cache warmup\n");
         // save the current tick value
         Tick curtick_original = curTick();
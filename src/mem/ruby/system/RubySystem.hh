@@ -110,13 +110,35 @@ class RubySystem : public ClockedObject
                            uint64_t cache_trace_size,
                            uint64_t block_size_bytes);
 
+    /**
+     * Read a cache trace, the chunks of which are decompressed in
+     * parallel (see Serializable::parallelRestore()).
+     *
+     * @param chunk_size Uncompressed size of the chunks
+     * @param offsets Offsets of the chunks in the file
+     */
     static void readCompressedTrace(std::string filename,
                                     uint8_t *&raw_data,
-                                    uint64_t &uncompressed_trace_size);
+                                    uint64_t uncompressed_trace_size,
+                                    uint64_t chunk_size,
+                                    const std::vector<uint64_t> &offsets);
+    /**
+     * Write a cache trace in chunks of chunk_size bytes, each a gzip member
+     * of its own, and return their offsets in the file in offsets. The
+     * file as a whole is a regular gzip file.
+     */
     static void writeCompressedTrace(uint8_t *raw_data, std::string file,
-                                     uint64_t uncompressed_trace_size);
+                                     uint64_t uncompressed_trace_size,
+                                     uint64_t chunk_size,
+                                     std::vector<uint64_t> &offsets);
 
     void processRubyEvent();
+
+    /**
+     * Whether the cache trace of checkpoints can be installed in the
+     * controllers directly, instead of replaying it as timing requests.
+     */
+    bool canFunctionalWarmup() const;
   private:
     // configuration parameters
     static bool m_randomization;
@@ -129,6 +151,7 @@ class RubySystem : public ClockedObject
     static bool m_cooldown_enabled;
     SimpleMemory *m_phys_mem;
     const bool m_access_backing_store;
+    const bool m_functional_warmup;
 
     Network* m_network;
     std::vector<AbstractController *> m_abs_cntrl_vec;
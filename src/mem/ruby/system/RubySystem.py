@@ -48,6 +48,12 @@ class RubySystem(ClockedObject):
     access_backing_store = Param.Bool(False, "Use phys_mem as the functional \
         store and only use ruby for timing.")
 
+    functional_warmup = Param.Bool(False, "Install the cache contents of \
+        checkpoints directly if all controllers support it, and write the \
+        modified lines back to memory functionally when taking checkpoints, \
+        instead of simulating the requests. Only MI_example and \
+        MESI_Two_Level support it.")
+
     # Profiler related configuration variables
     hot_lines = Param.Bool(False, "")
     all_instructions = Param.Bool(False, "")
@@ -277,6 +277,12 @@ SimpleMemory::MemoryPort::recvFunctional(PacketPtr pkt)
     memory.recvFunctional(pkt);
 }
 
+bool
+SimpleMemory::MemoryPort::recvGetBackdoor(Addr addr, MemBackdoor &backdoor)
+{
+    return memory.getBackdoor(backdoor);
+}
+
 bool
 SimpleMemory::MemoryPort::recvTimingReq(PacketPtr pkt)
 {
@@ -99,6 +99,8 @@ class SimpleMemory : public AbstractMemory
 
         void recvFunctional(PacketPtr pkt);
 
+        bool recvGetBackdoor(Addr addr, MemBackdoor &backdoor);
+
         bool recvTimingReq(PacketPtr pkt);
 
         void recvRespRetry();
@@ -311,6 +311,7 @@ class $c_ident : public AbstractController
     void recordCacheTrace(int cntrl, CacheRecorder* tr);
     Sequencer* getCPUSequencer() const;
     GPUCoalescer* getGPUCoalescer() const;
+    bool hasFunctionalInstall() const;
 
     int functionalWriteBuffers(PacketPtr&);
 
@@ -731,6 +732,22 @@ $c_ident::getGPUCoalescer() const
 {
     return NULL;
 }
+''')
+
+        # The cache trace of a checkpoint can be installed directly if
+        # the machine defines the functions for it
+        install_funcs = set(["canFunctionalInstall", "functionalInstall"])
+        if install_funcs <= set(f.c_name for f in self.functions):
+            has_install = "true"
+        else:
+            has_install = "false"
+        code('''
+
+bool
+$c_ident::hasFunctionalInstall() const
+{
+    return $has_install;
+}
 ''')
 
         code('''
@@ -352,6 +352,19 @@ BaseXBar::findPort(AddrRange addr_range)
           name());
 }
 
+bool
+BaseXBar::forwardBackdoor(Addr addr, MemBackdoor &backdoor)
+{
+    if (!gotAllAddrRanges)
+        return false;
+
+    auto i = portMap.contains(RangeSize(addr, 1));
+    if (i == portMap.end())
+        return false;
+
+    return masterPorts[i->second]->getBackdoor(addr, backdoor);
+}
+
 /** Function called by the port when the crossbar is receiving a range change.*/
 void
 BaseXBar::recvRangeChange(PortID master_port_id)
@@ -351,6 +351,18 @@ class BaseXBar : public MemObject
      */
     PortID findPort(AddrRange addr_range);
 
+    /**
+     * Forward a backdoor request to the master port that owns an
+     * address. Unlike findPort this does not fall back on the default
+     * port, as devices behind it are never backdoor capable, and it
+     * never fails fatally.
+     *
+     * @param addr Address the backdoor should cover.
+     * @param backdoor Descriptor populated on success.
+     * @return true if the downstream component granted a backdoor.
+     */
+    bool forwardBackdoor(Addr addr, MemBackdoor &backdoor);
+
     /**
      * Return the address ranges the crossbar is responsible for.
      *
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Asynchronous, batched writer and read-ahead reader for protobuf trace
+ * streams.
+ *
+ * Tracers that write one protobuf message per simulated event spend most of
+ * their time building messages and compressing them on the simulation
+ * thread. An AsyncProtoWriter instead accepts fixed-size, plain-old-data
+ * records from the simulation thread, queues them in a lock-free
+ * single-producer/single-consumer ring, and converts and writes them to a
+ * ProtoOutputStream (including any gzip compression) on a background
+ * thread. The on-disk format is unchanged: each record is turned into the
+ * same protobuf message the synchronous path would have written.
+ *
+ * Anything written directly to the underlying ProtoOutputStream (e.g. a
+ * header message) must be written before the writer is constructed. Once
+ * the writer exists, the stream belongs to the writer thread until the
+ * writer is destroyed. A forked process only inherits the thread that
+ * forks, so owners destroy their writers when the simulator is drained
+ * before a fork, and create new ones for the stream afterwards.
+ *
+ * Trace replayers spend a similar share of their time inflating and
+ * parsing messages. An AsyncProtoReader runs a decoder thread that reads
+ * messages from a ProtoInputStream into a bounded ring ahead of the
+ * consumer, so the simulation thread only has to pick up already parsed
+ * messages.
+ * Owners stop their readers on drain for the same reason, and the next
+ * read() restarts the decoder where it stopped.
+ */
+
+#ifndef __PROTO_ASYNC_PROTOIO_HH__
+#define __PROTO_ASYNC_PROTOIO_HH__
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "base/spsc_ring.hh"
+#include "proto/protoio.hh"
+
+template <typename Record>
+class AsyncProtoWriter
+{
+  public:
+    /**
+     * Function run on the writer thread that converts a record to a
+     * protobuf message and writes it to the stream.
+     */
+    typedef std::function<void(const Record &, ProtoOutputStream &)> Encoder;
+
+    /**
+     * @param stream Output stream the writer thread writes to. Ownership is
+     *               not transferred.
+     * @param capacity Number of records that can be queued before the
+     *                 simulation thread has to wait for the writer.
+     * @param encoder Function converting a record to a message.
+     */
+    AsyncProtoWriter(ProtoOutputStream *stream, size_t capacity,
+                     Encoder encoder)
+        : stream(stream), encoder(encoder), ring(capacity),
+          writerIdle(false), stopping(false), _stalls(0), _records(0),
+          writer(&AsyncProtoWriter::writerLoop, this)
+    {
+    }
+
+    /**
+     * Drain all outstanding records and stop the writer thread. The
+     * underlying stream is left open and may be written to or closed by
+     * the caller afterwards.
+     */
+    ~AsyncProtoWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping.store(true, std::memory_order_release);
+        }
+        cond.notify_one();
+        writer.join();
+    }
+
+    AsyncProtoWriter(const AsyncProtoWriter &) = delete;
+    AsyncProtoWriter &operator=(const AsyncProtoWriter &) = delete;
+
+    /**
+     * Queue a record for writing. If the ring is full the calling thread
+     * waits for the writer to catch up, so no records are ever lost.
+     */
+    void
+    write(const Record &rec)
+    {
+        if (ring.push(rec))
+            ++_stalls;
+        ++_records;
+
+        // Only pay for a notification if the writer has gone to sleep
+        if (writerIdle.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(mutex);
+            cond.notify_one();
+        }
+    }
+
+    /** Number of writes that had to wait for space in the ring. */
+    uint64_t stalls() const { return _stalls; }
+
+    /** Number of records queued since the writer was created. */
+    uint64_t records() const { return _records; }
+
+  private:
+    /** Maximum number of records encoded per ring access. */
+    static const size_t batchSize = 256;
+
+    void
+    writerLoop()
+    {
+        auto encode = [this](const Record &rec) { encoder(rec, *stream); };
+
+        while (true) {
+            if (ring.popBulk(batchSize, encode) != 0)
+                continue;
+
+            std::unique_lock<std::mutex> lock(mutex);
+            writerIdle.store(true, std::memory_order_release);
+            // Re-check after announcing that we are idle so that a
+            // record pushed concurrently is not left behind.
+            if (ring.empty()) {
+                if (stopping.load(std::memory_order_acquire))
+                    break;
+                cond.wait_for(lock, std::chrono::milliseconds(1));
+            }
+            writerIdle.store(false, std::memory_order_release);
+        }
+
+        // The producer has stopped; pick up anything that raced with the
+        // shutdown request.
+        while (ring.popBulk(batchSize, encode) != 0)
+            ;
+    }
+
+    ProtoOutputStream *const stream;
+    const Encoder encoder;
+
+    SpscRing<Record> ring;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::atomic<bool> writerIdle;
+    std::atomic<bool> stopping;
+
+    /** Simulation-thread-only counters. @{ */
+    uint64_t _stalls;
+    uint64_t _records;
+    /** @} */
+
+    /** Background thread, started last once all state is initialised. */
+    std::thread writer;
+};
+
+template <typename Msg>
+class AsyncProtoReader
+{
+  public:
+    /**
+     * @param stream Input stream to read from, positioned after any header
+     *               message. Ownership is not transferred, and the stream
+     *               must not be used by the caller while the reader exists
+     *               other than through reset().
+     * @param depth Maximum number of messages decoded ahead of the consumer.
+     */
+    AsyncProtoReader(ProtoInputStream *stream, size_t depth)
+        : stream(stream), ring(depth), running(false), decoderIdle(false),
+          stopping(false), endOfStream(false)
+    {
+        start();
+    }
+
+    ~AsyncProtoReader() { stop(); }
+
+    AsyncProtoReader(const AsyncProtoReader &) = delete;
+    AsyncProtoReader &operator=(const AsyncProtoReader &) = delete;
+
+    /**
+     * Get the next message in the stream, waiting for the decoder thread if
+     * it has not caught up yet.
+     *
+     * @param msg Message to populate.
+     * @return true if a message was read, false at the end of the stream.
+     */
+    bool
+    read(Msg &msg)
+    {
+        if (!running)
+            start();
+
+        auto take = [&msg](Msg &slot) { msg.Swap(&slot); };
+        while (ring.popBulk(1, take) == 0) {
+            // Check the ring again after seeing the end-of-stream flag,
+            // the last messages may have been published just before it.
+            if (endOfStream.load(std::memory_order_acquire))
+                return ring.popBulk(1, take) != 0;
+            std::this_thread::yield();
+        }
+
+        if (decoderIdle.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(mutex);
+            cond.notify_one();
+        }
+        return true;
+    }
+
+    /** Number of messages decoded ahead of the consumer. */
+    size_t buffered() const { return ring.size(); }
+
+    /**
+     * Stop the decoder thread. The messages it decoded ahead are kept, and
+     * the next call to read() restarts it where it stopped.
+     */
+    void
+    stop()
+    {
+        if (!running)
+            return;
+        running = false;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping.store(true, std::memory_order_release);
+        }
+        cond.notify_one();
+        decoder.join();
+    }
+
+    /**
+     * Stop the decoder and rewind the underlying stream to its beginning.
+     * Any messages decoded ahead are discarded. Decoding restarts on the
+     * next call to read(), so a stream that is rewound and never read
+     * again is not touched.
+     */
+    void
+    reset()
+    {
+        stop();
+        stream->reset();
+        Msg discard;
+        while (ring.tryPop(discard))
+            ;
+    }
+
+  private:
+    void
+    start()
+    {
+        stopping.store(false, std::memory_order_relaxed);
+        endOfStream.store(false, std::memory_order_relaxed);
+        decoder = std::thread(&AsyncProtoReader::decoderLoop, this);
+        running = true;
+    }
+
+    void
+    decoderLoop()
+    {
+        bool more = true;
+        auto decode = [this, &more](Msg &slot) {
+            more = stream->read(slot);
+            return more;
+        };
+
+        while (more && !stopping.load(std::memory_order_acquire)) {
+            if (ring.tryFill(decode))
+                continue;
+            if (!more)
+                break;
+
+            // The ring is full, wait for the consumer to make room
+            std::unique_lock<std::mutex> lock(mutex);
+            decoderIdle.store(true, std::memory_order_release);
+            if (ring.size() == ring.capacity() &&
+                !stopping.load(std::memory_order_acquire)) {
+                cond.wait_for(lock, std::chrono::milliseconds(1));
+            }
+            decoderIdle.store(false, std::memory_order_release);
+        }
+
+        endOfStream.store(true, std::memory_order_release);
+    }
+
+    ProtoInputStream *const stream;
+
+    SpscRing<Msg> ring;
+
+    /** Whether the decoder thread has been started (consumer side only) */
+    bool running;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::atomic<bool> decoderIdle;
+    std::atomic<bool> stopping;
+
+    /** Set by the decoder once it will not publish any more messages */
+    std::atomic<bool> endOfStream;
+
+    std::thread decoder;
+};
+
+#endif // __PROTO_ASYNC_PROTOIO_HH__
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "proto/async_protoio.hh"
+#include "proto/packet.pb.h"
+
+namespace {
+
+class TempFile
+{
+  public:
+    std::string path;
+
+    TempFile()
+    {
+        char name[] = "/tmp/async_protoio_testXXXXXX";
+        int fd = mkstemp(name);
+        EXPECT_GE(fd, 0);
+        ::close(fd);
+        path = name;
+    }
+
+    ~TempFile() { unlink(path.c_str()); }
+};
+
+struct Record
+{
+    uint64_t tick;
+    uint64_t addr;
+};
+
+void
+encode(const Record &rec, ProtoOutputStream &stream)
+{
+    ProtoMessage::Packet pkt;
+    pkt.set_tick(rec.tick);
+    pkt.set_cmd(1);
+    pkt.set_addr(rec.addr);
+    pkt.set_size(64);
+    stream.write(pkt);
+}
+
+/** Read back all the packets in a file, in order. */
+std::vector<uint64_t>
+readTicks(const std::string &path)
+{
+    std::vector<uint64_t> ticks;
+    ProtoInputStream in(path);
+    ProtoMessage::Packet pkt;
+    while (in.read(pkt))
+        ticks.push_back(pkt.tick());
+    return ticks;
+}
+
+/** Write packets with ticks 0 to n - 1 to a file. */
+void
+writeTicks(const std::string &path, uint64_t n)
+{
+    ProtoOutputStream out(path);
+    for (uint64_t i = 0; i < n; ++i)
+        encode(Record{i, i * 64}, out);
+}
+
+} // anonymous namespace
+
+// Everything queued is written, in order, by the time the writer is
+// destroyed, even if the ring had to be drained many times.
+TEST(AsyncProtoWriterTest, WritesAllRecords)
+{
+    TempFile file;
+    const uint64_t n = 10000;
+    {
+        ProtoOutputStream out(file.path);
+        AsyncProtoWriter<Record> writer(&out, 16, encode);
+        for (uint64_t i = 0; i < n; ++i)
+            writer.write(Record{i, i * 64});
+        EXPECT_EQ(n, writer.records());
+    }
+
+    std::vector<uint64_t> ticks = readTicks(file.path);
+    ASSERT_EQ(n, ticks.size());
+    for (uint64_t i = 0; i < n; ++i)
+        EXPECT_EQ(i, ticks[i]);
+}
+
+// Owners destroy their writer when the simulator is drained (e.g. before a
+// fork) and create a new one for the same stream afterwards. Nothing may be
+// lost or reordered across the restart.
+TEST(AsyncProtoWriterTest, Restart)
+{
+    TempFile file;
+    {
+        ProtoOutputStream out(file.path);
+        std::unique_ptr<AsyncProtoWriter<Record>> writer(
+            new AsyncProtoWriter<Record>(&out, 8, encode));
+        for (uint64_t i = 0; i < 100; ++i)
+            writer->write(Record{i, 0});
+
+        // Once the writer is gone the stream belongs to the owner again
+        writer.reset();
+        encode(Record{100, 0}, out);
+
+        writer.reset(new AsyncProtoWriter<Record>(&out, 8, encode));
+        for (uint64_t i = 101; i < 200; ++i)
+            writer->write(Record{i, 0});
+        EXPECT_EQ(99, writer->records());
+    }
+
+    std::vector<uint64_t> ticks = readTicks(file.path);
+    ASSERT_EQ(200, ticks.size());
+    for (uint64_t i = 0; i < ticks.size(); ++i)
+        EXPECT_EQ(i, ticks[i]);
+}
+
+// The output of the writer thread is byte for byte what the synchronous
+// path produces, including gzip compression.
+TEST(AsyncProtoWriterTest, MatchesSynchronousWrites)
+{
+    TempFile sync_file, async_file;
+    const std::string sync_path = sync_file.path + ".gz";
+    const std::string async_path = async_file.path + ".gz";
+    {
+        ProtoOutputStream sync_out(sync_path);
+        ProtoOutputStream async_out(async_path);
+        AsyncProtoWriter<Record> writer(&async_out, 32, encode);
+        for (uint64_t i = 0; i < 1000; ++i) {
+            encode(Record{i, i * 3}, sync_out);
+            writer.write(Record{i, i * 3});
+        }
+    }
+
+    ProtoInputStream sync_in(sync_path);
+    ProtoInputStream async_in(async_path);
+    ProtoMessage::Packet expected, actual;
+    unsigned count = 0;
+    while (sync_in.read(expected)) {
+        ASSERT_TRUE(async_in.read(actual));
+        EXPECT_EQ(expected.SerializeAsString(), actual.SerializeAsString());
+        ++count;
+    }
+    EXPECT_FALSE(async_in.read(actual));
+    EXPECT_EQ(1000, count);
+
+    unlink(sync_path.c_str());
+    unlink(async_path.c_str());
+}
+
+// The decoder stays exactly `depth' messages ahead of the consumer, and
+// stopping it doesn't lose the messages it has already decoded.
+TEST(AsyncProtoReaderTest, ReadAheadDepth)
+{
+    TempFile file;
+    writeTicks(file.path, 100);
+
+    ProtoInputStream in(file.path);
+    AsyncProtoReader<ProtoMessage::Packet> reader(&in, 4);
+    auto deadline = std::chrono::steady_clock::now() +
+        std::chrono::seconds(10);
+    while (reader.buffered() < 4 &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(4, reader.buffered());
+
+    // With the decoder stopped, the stream is positioned right after the
+    // messages it decoded ahead
+    reader.stop();
+    ProtoMessage::Packet pkt;
+    ASSERT_TRUE(in.read(pkt));
+    EXPECT_EQ(4, pkt.tick());
+
+    for (uint64_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(reader.read(pkt));
+        EXPECT_EQ(i, pkt.tick());
+    }
+    for (uint64_t i = 5; i < 100; ++i) {
+        ASSERT_TRUE(reader.read(pkt));
+        EXPECT_EQ(i, pkt.tick());
+    }
+    EXPECT_FALSE(reader.read(pkt));
+}
+
+TEST(AsyncProtoReaderTest, EndOfStream)
+{
+    TempFile file;
+    writeTicks(file.path, 10);
+
+    ProtoInputStream in(file.path);
+    AsyncProtoReader<ProtoMessage::Packet> reader(&in, 4);
+    ProtoMessage::Packet pkt;
+    for (uint64_t i = 0; i < 10; ++i) {
+        ASSERT_TRUE(reader.read(pkt));
+        EXPECT_EQ(i, pkt.tick());
+    }
+    EXPECT_FALSE(reader.read(pkt));
+    EXPECT_FALSE(reader.read(pkt));
+}
+
+TEST(AsyncProtoReaderTest, EmptyStream)
+{
+    TempFile file;
+    writeTicks(file.path, 0);
+
+    ProtoInputStream in(file.path);
+    AsyncProtoReader<ProtoMessage::Packet> reader(&in, 4);
+    ProtoMessage::Packet pkt;
+    EXPECT_FALSE(reader.read(pkt));
+}
+
+// Owners stop their readers when the simulator is drained (e.g. before a
+// fork). Reading again picks up where the decoder stopped, however often
+// that happens.
+TEST(AsyncProtoReaderTest, StopAndRestart)
+{
+    TempFile file;
+    writeTicks(file.path, 1000);
+
+    ProtoInputStream in(file.path);
+    AsyncProtoReader<ProtoMessage::Packet> reader(&in, 8);
+    ProtoMessage::Packet pkt;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        if (i % 7 == 0)
+            reader.stop();
+        ASSERT_TRUE(reader.read(pkt));
+        EXPECT_EQ(i, pkt.tick());
+    }
+    reader.stop();
+    EXPECT_FALSE(reader.read(pkt));
+    reader.stop();
+    EXPECT_FALSE(reader.read(pkt));
+}
+
+// reset() rewinds to the start of the stream, whether or not the decoder
+// had reached the end, and discards what was decoded ahead.
+TEST(AsyncProtoReaderTest, Reset)
+{
+    TempFile file;
+    writeTicks(file.path, 50);
+
+    ProtoInputStream in(file.path);
+    AsyncProtoReader<ProtoMessage::Packet> reader(&in, 4);
+    ProtoMessage::Packet pkt;
+    for (uint64_t i = 0; i < 10; ++i)
+        ASSERT_TRUE(reader.read(pkt));
+
+    for (int pass = 0; pass < 3; ++pass) {
+        reader.reset();
+        for (uint64_t i = 0; i < 50; ++i) {
+            ASSERT_TRUE(reader.read(pkt));
+            EXPECT_EQ(i, pkt.tick());
+        }
+        EXPECT_FALSE(reader.read(pkt));
+    }
+
+    // A stream that is rewound and never read again is left alone
+    reader.reset();
+}
+
+// Messages come out exactly as a synchronous read of the same compressed
+// stream, header included.
+TEST(AsyncProtoReaderTest, MatchesSynchronousReads)
+{
+    TempFile file;
+    const std::string path = file.path + ".gz";
+    {
+        ProtoOutputStream out(path);
+        ProtoMessage::PacketHeader header;
+        header.set_obj_id("test");
+        header.set_tick_freq(1000000000000);
+        out.write(header);
+        for (uint64_t i = 0; i < 1000; ++i) {
+            ProtoMessage::Packet pkt;
+            pkt.set_tick(i * 500);
+            pkt.set_cmd(i % 3);
+            pkt.set_addr(i * 0x40);
+            pkt.set_size(1 << (i % 7));
+            if (i % 2)
+                pkt.set_flags(i);
+            if (i % 5)
+                pkt.set_pc(0x400000 + i * 4);
+            out.write(pkt);
+        }
+    }
+
+    ProtoInputStream sync_in(path);
+    ProtoInputStream async_in(path);
+    ProtoMessage::PacketHeader sync_header, async_header;
+    ASSERT_TRUE(sync_in.read(sync_header));
+    ASSERT_TRUE(async_in.read(async_header));
+    EXPECT_EQ(sync_header.SerializeAsString(),
+              async_header.SerializeAsString());
+
+    AsyncProtoReader<ProtoMessage::Packet> reader(&async_in, 16);
+    ProtoMessage::Packet expected, actual;
+    unsigned count = 0;
+    while (sync_in.read(expected)) {
+        ASSERT_TRUE(reader.read(actual));
+        EXPECT_EQ(expected.SerializeAsString(), actual.SerializeAsString());
+        ++count;
+    }
+    EXPECT_FALSE(reader.read(actual));
+    EXPECT_EQ(1000, count);
+
+    unlink(path.c_str());
+}
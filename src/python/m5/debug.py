@@ -36,6 +36,9 @@ from _m5.debug import schedBreak, setRemoteGDBPort
 from m5.util import printList
 
 def help():
+    print("Flags marked with * are compiled out of this build (see the "
+          "DEBUG_FLAGS build option)")
+    print()
     print("Base Flags:")
     for name in sorted(flags):
         if name == 'All':
@@ -43,7 +46,8 @@ def help():
         flag = flags[name]
         children = [c for c in flag.kids() ]
         if not children:
-            print("    %s: %s" % (name, flag.desc()))
+            print("  %s %s: %s" % (" " if flag.compiledIn() else "*",
+                                   name, flag.desc()))
     print()
     print("Compound Flags:")
     for name in sorted(flags):
@@ -52,7 +56,8 @@ def help():
         flag = flags[name]
         children = [c for c in flag.kids() ]
         if children:
-            print("    %s: %s" % (name, flag.desc()))
+            print("  %s %s: %s" % (" " if flag.compiledIn() else "*",
+                                   name, flag.desc()))
             printList([ c.name() for c in children ], indent=8)
     print()
 
@@ -108,6 +108,23 @@ def parse_options():
     option("--stats-db-file", metavar="FILE", default="",
         help = "Sets the output database file for statistics [Default: \
             %default]")
+    option("--stats-db-defer-indexes", action="store_true", default=False,
+        help="Only index the stats database at the end of the simulation, "
+        "which makes dumps faster")
+    option("--stats-binary-file", metavar="FILE", default="",
+        help="Sets the output file for statistics in a columnar binary "
+        "format, see util/stats/binary.py [Default: %default]")
+    option("--stats-incremental", action="store_true", default=False,
+        help="Only dump the stats that changed since the previous dump")
+    option("--stats-async", action="store_true", default=False,
+        help="Write stats dumps from a background thread")
+    option("--event-profile", metavar="FILE", default="",
+        help="Sample the host time spent on events, by object and event "
+        "type, into the event_profile stats and into FILE as folded stacks "
+        "for flame graphs, with the numbers of events and reschedules in "
+        "FILE.events and FILE.reschedules [Default: off]")
+    option("--event-profile-period", metavar="N", type='int', default=100,
+        help="Sample one in N events on average [Default: %default]")
 
     # Configuration Options
     group("Configuration Options")
@@ -120,6 +137,23 @@ def parse_options():
     option("--dot-dvfs-config", metavar="FILE", default=None,
         help="Create DOT & pdf outputs of the DVFS configuration" + \
              " [Default: %default]")
+    option("--from-config", metavar="FILE", default=None,
+        help="Instantiate the simulated system from FILE, a config.ini "
+             "dumped by an earlier run, and simulate it instead of running "
+             "a script. Needs a build with --with-cxx-config")
+    option("--set-param", metavar="OBJECT.PARAM=VALUE", action='append',
+        default=[],
+        help="Set a parameter of an object of --from-config, with the value "
+             "written as in config.ini")
+    option("--from-config-checkpoint", metavar="DIR", default=None,
+        help="Restore the system of --from-config from the checkpoint DIR")
+    option("--checkpoint-format", metavar="FORMAT", default="ini",
+        choices=["ini", "binary"],
+        help="Format of the m5.cpt file of checkpoints, util/cpt_convert.py "
+             "converts between them [Default: %default]")
+    option("--restore-threads", metavar="N", type='int', default=1,
+        help="Restore independent objects and memories from checkpoints "
+             "on N threads [Default: %default]")
 
     # Debugging options
     group("Debugging Options")
@@ -136,6 +170,13 @@ def parse_options():
         help="End debug output at TICK")
     option("--debug-file", metavar="FILE", default="cout",
         help="Sets the output file for debug [Default: %default]")
+    option("--debug-format", metavar="FORMAT", default="text",
+        choices=["text", "binary"],
+        help="Format of the debug output, binary output is decoded with "
+             "util/decode_binary_trace.py [Default: %default]")
+    option("--debug-flight-recorder", metavar="MB", type='int', default=0,
+        help="With binary debug output, only keep the last MB megabytes "
+             "of records and write them when the simulator exits")
     option("--debug-ignore", metavar="EXPR", action='append', split=':',
         help="Ignore EXPR sim objects")
     option("--remote-gdb-port", type='int', default=7000,
@@ -194,6 +235,30 @@ def interact(scope):
         # isn't available.
         code.InteractiveConsole(scope).interact(banner)
 
+def run_from_config(options):
+    """Simulate the system of --from-config until the first exit event."""
+    import m5
+    from util import fatal
+
+    params = []
+    for setting in options.set_param:
+        name, sep, value = setting.partition('=')
+        obj, dot, param = name.rpartition('.')
+        if not sep or not dot:
+            fatal("Bad --set-param %s, expected OBJECT.PARAM=VALUE", setting)
+        params.append((obj, param, value))
+
+    try:
+        m5.instantiateFromConfig(options.from_config, params,
+                                 options.from_config_checkpoint)
+    except RuntimeError as e:
+        fatal("%s", e)
+
+    exit_event = m5.simulate()
+    print("Exiting @ tick %i because %s" %
+          (m5.curTick(), exit_event.getCause()))
+    sys.exit(exit_event.getCode())
+
 def main(*args):
     import m5
 
@@ -331,8 +396,15 @@ def main(*args):
         print("command line:", " ".join(map(pipes.quote, sys.argv)))
         print()
 
+    if not options.from_config and \
+            (options.set_param or options.from_config_checkpoint):
+        fatal("--set-param and --from-config-checkpoint need --from-config")
+
     # check to make sure we can find the listed script
-    if not arguments or not os.path.isfile(arguments[0]):
+    if options.from_config:
+        if arguments:
+            fatal("A script can't be run with --from-config")
+    elif not arguments or not os.path.isfile(arguments[0]):
         if arguments and not os.path.isfile(arguments[0]):
             print("Script %s not found" % arguments[0])
 
@@ -341,16 +413,34 @@ def main(*args):
     # tell C++ about output directory
     core.setOutputDir(options.outdir)
 
+    # set the format that checkpoints are written in
+    core.setBinaryCheckpoints(options.checkpoint_format == "binary")
+    core.setRestoreThreads(max(options.restore_threads, 1))
+
     # update the system path with elements from the -p option
     sys.path[0:0] = options.path
 
     # set stats options
     if options.stats_db_file:
-        stats.initSQL(options.outdir, options.stats_db_file)
+        stats.initSQL(options.outdir, options.stats_db_file,
+                      options.stats_db_defer_indexes)
 
     if options.stats_file:
         stats.initText(options.stats_file)
 
+    if options.stats_binary_file:
+        stats.initBinary(options.stats_binary_file)
+
+    if options.stats_incremental:
+        stats.setIncrementalDump()
+
+    if options.stats_async:
+        stats.setAsyncDump()
+
+    if options.event_profile:
+        event.enableProfiler(max(options.event_profile_period, 1),
+                             options.event_profile)
+
     # Check that at least one stats output format is enabled
     if not stats.stats_output_enabled():
         warn("Unable to output statistics.")
@@ -394,6 +484,10 @@ def main(*args):
             if off:
                 debug.flags[flag].disable()
             else:
+                if not debug.flags[flag].compiledIn():
+                    print("warning: debug flag '%s' is compiled out of "
+                          "this build (see DEBUG_FLAGS)" % flag,
+                          file=sys.stderr)
                 debug.flags[flag].enable()
 
     if options.debug_start:
@@ -408,12 +502,23 @@ def main(*args):
         e = event.create(trace.disable, event.Event.Debug_Enable_Pri)
         event.mainq.schedule(e, options.debug_end)
 
-    trace.output(options.debug_file)
+    if options.debug_format == "binary":
+        debug_file = options.debug_file
+        if debug_file == "cout":
+            debug_file = "trace.bin"
+        trace.binaryOutput(debug_file,
+                           options.debug_flight_recorder * 1024 * 1024)
+    else:
+        trace.output(options.debug_file)
 
     for ignore in options.debug_ignore:
         check_tracing()
         trace.ignore(ignore)
 
+    if options.from_config:
+        run_from_config(options)
+        return
+
     sys.argv = arguments
     sys.path = [ os.path.dirname(sys.argv[0]) ] + sys.path
 
@@ -49,6 +49,7 @@ import sys
 # import the wrapped C++ functions
 import _m5.drain
 import _m5.core
+import _m5.stats
 from _m5.stats import updateEvents as updateStatEvents
 
 import stats
@@ -122,6 +123,7 @@ def instantiate(ckpt_dir=None):
 
     # Do a third pass to initialize statistics
     for obj in root.descendants(): obj.regStats()
+    _m5.event.regProfilerStats([ obj.path() for obj in root.descendants() ])
 
     # Do a fourth pass to initialize probe points
     for obj in root.descendants(): obj.regProbePoints()
@@ -143,7 +145,8 @@ def instantiate(ckpt_dir=None):
         _drain_manager.preCheckpointRestore()
         ckpt = _m5.core.getCheckpoint(ckpt_dir)
         _m5.core.unserializeGlobals(ckpt);
-        for obj in root.descendants(): obj.loadState(ckpt)
+        _m5.core.loadStateAll(ckpt, [ obj.getCCObject()
+                                      for obj in root.descendants() ])
     else:
         for obj in root.descendants(): obj.initState()
 
@@ -151,13 +154,52 @@ def instantiate(ckpt_dir=None):
     # a checkpoint, If so, this call will shift them to be at a valid time.
     updateStatEvents()
 
+# Whether the objects were instantiated from a config file, see
+# instantiateFromConfig(), rather than from Python SimObjects
+from_config = False
+
+def instantiateFromConfig(config_file, params=[], ckpt_dir=None):
+    """Instantiate the objects described by a config.ini, e.g. one that an
+    earlier run dumped, without building them in Python.
+
+    Arguments:
+      config_file -- The config.ini to read.
+      params -- (object, param, value) tuples of parameters to set, with
+                the values written as in config.ini.
+      ckpt_dir -- Checkpoint to restore from.
+    """
+    global from_config
+
+    # The ticks in the config file are at the default frequency
+    ticks.fixGlobalFrequency()
+
+    _m5.cxx_config.load(config_file)
+    for obj, param, value in params:
+        _m5.cxx_config.setParam(obj, param, value)
+
+    stats.initSimStats()
+    _m5.cxx_config.instantiate()
+    _m5.event.regProfilerStats(_m5.cxx_config.objectNames())
+    stats.enable()
+
+    if ckpt_dir:
+        _m5.cxx_config.loadState(ckpt_dir)
+    else:
+        _m5.cxx_config.initState()
+    from_config = True
+
+    updateStatEvents()
+
 need_startup = True
 def simulate(*args, **kwargs):
     global need_startup
 
     if need_startup:
-        root = objects.Root.getInstance()
-        for obj in root.descendants(): obj.startup()
+        if from_config:
+            _m5.cxx_config.startup()
+        else:
+            root = objects.Root.getInstance()
+            for obj in root.descendants(): obj.startup()
         need_startup = False
 
         # Python exit handlers happen in reverse order.
@@ -347,6 +389,12 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
 
     drain()
 
+    # The background thread that writes stats dumps isn't forked, so it
+    # is stopped, and buffered output mustn't be written by both processes
+    _m5.stats.stopAsyncDumps()
+    sys.stdout.flush()
+    sys.stderr.flush()
+
     try:
         pid = os.fork()
     except OSError, e:
@@ -364,11 +412,57 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
                 "pid" : os.getpid(),
                 }
         _m5.core.setOutputDir(options.outdir)
+        stats.notifyFork(options.outdir)
     else:
         fork_count += 1
 
     return pid
 
+def forkEach(simouts, max_jobs=None):
+    """Fork the simulator once for each of a list of output directories.
+
+    At most max_jobs children run at once. The parent waits for all of
+    them before returning, so it can't simulate any further meanwhile.
+
+    Keyword Arguments:
+      simouts -- Output directories of the children, see fork().
+      max_jobs -- Number of children that run at once [Default: the
+                  number of host CPUs].
+
+    Return Value:
+      (index, None) in the child with the index of its output
+      directory, and (None, exit codes) in the parent, where the exit
+      code of a child that was killed by a signal is minus the signal.
+    """
+    import multiprocessing
+
+    if max_jobs is None:
+        max_jobs = multiprocessing.cpu_count()
+    max_jobs = max(max_jobs, 1)
+
+    codes = [ None ] * len(simouts)
+    running = {}
+
+    def wait_one():
+        pid, status = os.wait()
+        if os.WIFSIGNALED(status):
+            codes[running.pop(pid)] = -os.WTERMSIG(status)
+        else:
+            codes[running.pop(pid)] = os.WEXITSTATUS(status)
+
+    for index, simout in enumerate(simouts):
+        while len(running) >= max_jobs:
+            wait_one()
+        pid = fork(simout)
+        if pid == 0:
+            return index, None
+        running[pid] = index
+
+    while running:
+        wait_one()
+
+    return None, codes
+
 from _m5.core import disableAllListeners, listenersDisabled
 from _m5.core import listenersLoopbackOnly
 from _m5.core import curTick
@@ -40,11 +40,11 @@
 # Authors: Nathan Binkert
 #          Andreas Sandberg
 
+import atexit
 import m5
 import os
 
 import _m5.stats
-from m5.objects import Root
 from m5.util import attrdict, fatal
 
 # Global variable to determine if statistics output is enabled
@@ -125,11 +125,26 @@ def _textFactory(fn, desc=True):
 
     return _m5.stats.initText(fn, desc)
 
+@_url_factory
+def _binaryFactory(fn):
+    """Output stats in a columnar binary format.
+
+    Binary stat files hold the values of each dump as an array of
+    doubles and can be loaded into numpy arrays with
+    util/stats/binary.py.
+
+    Example: binary://stats.bin
+
+    """
+
+    return _m5.stats.initBinary(fn)
+
 factories = {
     # Default to the text factory if we're given a naked path
     "" : _textFactory,
     "file" : _textFactory,
     "text" : _textFactory,
+    "binary" : _binaryFactory,
 }
 
 def addStatVisitor(url):
@@ -156,30 +171,68 @@ def addStatVisitor(url):
 
     outputList.append(factory(parsed))
 
+def initBinary(filename):
+    output = _m5.stats.initBinary(filename)
+    outputList.append(output)
+    global STATS_OUTPUT_ENABLED
+    STATS_OUTPUT_ENABLED = True
+
 def initSimStats():
     _m5.stats.initSimStats()
     _m5.stats.registerPythonStatsHandlers()
 
-def initSQL(outputDirectory, filename):
+def initSQL(outputDirectory, filename, defer_indexes=False):
     """ Add the stats database as an output and add it to outputList.
 
     Args:
       outputDirectory: The directlry to store the database.
       filename: The filename to which the stats are written.
+      defer_indexes: Only index the values at the end of the simulation,
+        which makes dumps faster.
     """
     # Take the supplied filename and prepend the output directory.
     import os
     filename = os.path.join(outputDirectory, filename)
 
-    output = _m5.stats.initOutputSQL(filename)
+    output = _m5.stats.initOutputSQL(filename, defer_indexes)
     if output:
+        global sqlFilename
+        sqlFilename = filename
         outputList.append(output)
+        # Exit handlers run in reverse order, so this runs after the final
+        # dump that m5.simulate() registers
+        atexit.register(closeSQL)
         global STATS_OUTPUT_ENABLED
         STATS_OUTPUT_ENABLED = True
         return True
     else:
         return False
 
+# The stats database, if it is an output
+sqlFilename = None
+
+def closeSQL():
+    """ Close the stats database once the last dump has been written,
+    which creates any deferred indexes. Later dumps skip the database. """
+    _m5.stats.drainAsyncDumps()
+    _m5.stats.closeOutputSQL()
+
+def notifyFork(outputDirectory):
+    """ Prepare the outputs for a forked simulator.
+
+    Text and binary outputs follow the simulator's output directory by
+    themselves. The stats database is started again in the new output
+    directory.
+
+    Args:
+      outputDirectory: The output directory of the child.
+    """
+    import os
+    if sqlFilename:
+        filename = os.path.join(outputDirectory,
+                                os.path.basename(sqlFilename))
+        _m5.stats.reopenOutputSQL(filename)
+
 def stats_output_enabled():
     """ Check that at least one statistics output format is enabled.
 
@@ -218,18 +271,51 @@ def enable():
         stats_dict[stat.name] = stat
         stat.enable()
 
+    _m5.stats.setDumpOrder(stats_list)
     _m5.stats.enable();
 
-def prepare():
+def prepare(stats=None):
     '''Prepare all stats for data access.  This must be done before
     dumping and serialization.'''
 
-    for stat in stats_list:
+    for stat in (stats_list if stats is None else stats):
         stat.prepare()
 
+# Whether dumps only include the stats that changed since the previous
+# dump, see setIncrementalDump()
+incrementalDump = False
+
+def setIncrementalDump(incremental=True):
+    '''Only include the stats that may have changed since the previous
+    dump in subsequent dumps. Stats that are left out have the same
+    value as in the previous dump that included them. Values, formulas
+    and averages over time are always included.'''
+
+    global incrementalDump
+    incrementalDump = incremental
+
+# Whether dumps are written in the background, see setAsyncDump()
+asyncDump = False
+
+def setAsyncDump(async_dump=True):
+    '''Write subsequent dumps from a background thread. The values of
+    the stats are copied when dump() is called, formulas included, and
+    the outputs are written while the simulation continues.'''
+
+    global asyncDump
+    asyncDump = async_dump
+    if not async_dump:
+        _m5.stats.drainAsyncDumps()
+
+# Outstanding background dumps have to be written before the outputs
+# are closed
+atexit.register(_m5.stats.drainAsyncDumps)
+
 lastDump = 0
-def dump(stats_desc=""):
-    '''Dump all statistics data to the registered outputs'''
+def dump(stats_desc="", incremental=None):
+    '''Dump all statistics data to the registered outputs, or only
+    the changed stats if incremental is True (default: the
+    setIncrementalDump() setting)'''
     if not STATS_OUTPUT_ENABLED:
         return
 
@@ -243,12 +329,30 @@ def dump(stats_desc=""):
 
     _m5.stats.processDumpQueue()
 
-    prepare()
+    if incremental is None:
+        incremental = incrementalDump
+
+    if incremental:
+        stats = _m5.stats.takeChangedStats()
+        stats_desc = "incremental" + (": " + stats_desc if stats_desc else "")
+    else:
+        stats = stats_list
+        _m5.stats.clearChangedStats()
+
+    prepare(stats)
+
+    if asyncDump:
+        outputs = [ output for output in outputList if output.valid() ]
+        _m5.stats.dumpAsync(outputs, stats, stats_desc)
+        return
+
+    # The outputs mustn't be used by two dumps at once
+    _m5.stats.drainAsyncDumps()
 
     for output in outputList:
         if output.valid():
             output.begin(stats_desc)
-            for stat in stats_list:
+            for stat in stats:
                 stat.visit(output)
             output.end()
 
@@ -259,13 +363,11 @@ def reset():
     '''Reset all statistics to the base state'''
 
     # call reset stats on all SimObjects
-    root = Root.getInstance()
-    if root:
-        for obj in root.descendants(): obj.resetStats()
+    _m5.stats.resetSimObjectStats()
 
-    # call any other registered stats reset callbacks
-    for stat in stats_list:
-        stat.reset()
+    # reset the stats that changed since the last reset, the others
+    # are still in the base state
+    _m5.stats.resetChangedStats()
 
     _m5.stats.processResetQueue()
 
@@ -268,7 +268,19 @@ pybind_init_core(py::module &m_native)
      */
     m_core
         .def("serializeAll", &Serializable::serializeAll)
+        .def("setBinaryCheckpoints", [](bool binary) {
+            Serializable::ckptBinary = binary;
+        })
         .def("unserializeGlobals", &Serializable::unserializeGlobals)
+        .def("setRestoreThreads", [](unsigned threads) {
+            Serializable::ckptRestoreThreads = threads;
+        })
+        .def("loadStateAll", [](CheckpointIn &cp, py::list objects) {
+            std::vector<SimObject *> objs;
+            for (auto obj : objects)
+                objs.push_back(obj.cast<SimObject *>());
+            SimObject::loadStateAll(cp, objs);
+        })
         .def("getCheckpoint", [](const std::string &cpt_dir) {
             return new CheckpointIn(cpt_dir, pybindSimObjectResolver);
         })
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Bindings that build the simulated system from a config.ini with the C++
+ * configuration support, instead of from Python SimObjects. Used by the
+ * --from-config option.
+ */
+
+#include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/str.hh"
+#include "python/pybind11/pybind.hh"
+#include "sim/cxx_config.hh"
+#include "sim/cxx_config_ini.hh"
+#include "sim/cxx_manager.hh"
+#include "sim/drain.hh"
+#include "sim/serialize.hh"
+
+namespace py = pybind11;
+
+namespace {
+
+/** The loaded config file and the manager of the objects it describes */
+std::unique_ptr<CxxConfigFileBase> configFile;
+std::unique_ptr<CxxConfigManager> configManager;
+
+CxxConfigManager &
+manager()
+{
+    if (!configManager)
+        throw std::runtime_error("No config file has been loaded");
+    return *configManager;
+}
+
+/** Call f, passing errors in the config to Python as exceptions */
+template <class F>
+void
+checked(F f)
+{
+    try {
+        f();
+    } catch (CxxConfigManager::Exception &e) {
+        throw std::runtime_error(e.name + ": " + e.message);
+    }
+}
+
+void
+load(const std::string &path)
+{
+#ifdef WITH_CXX_CONFIG
+    if (cxx_config_directory.empty())
+        cxxConfigInit();
+#else
+    throw std::runtime_error("Instantiating from a config file needs a "
+                             "build with --with-cxx-config");
+#endif
+
+    std::unique_ptr<CxxConfigFileBase> file(new CxxIniFile());
+    if (!file->load(path))
+        throw std::runtime_error("Can't read config file " + path);
+
+    // The manager refers to the file, so it goes first
+    configManager.reset();
+    configFile = std::move(file);
+    configManager.reset(new CxxConfigManager(*configFile));
+}
+
+/**
+ * Set a parameter of an object before it is instantiated. The values of
+ * vector parameters are separated by spaces, as in config.ini.
+ */
+void
+setParam(const std::string &object, const std::string &param,
+         const std::string &value)
+{
+    checked([&]() {
+        std::string type;
+        const CxxConfigDirectoryEntry &entry =
+            manager().findObjectType(object, type);
+        auto desc = entry.parameters.find(param);
+        if (desc == entry.parameters.end()) {
+            throw CxxConfigManager::Exception(object,
+                csprintf("%s has no parameter %s", type, param));
+        }
+
+        if (desc->second->isVector) {
+            std::vector<std::string> values;
+            tokenize(values, value, ' ');
+            manager().setParamVector(object, param, values);
+        } else {
+            manager().setParam(object, param, value);
+        }
+    });
+}
+
+/** Restore the state of the objects from a checkpoint */
+void
+loadState(const std::string &ckpt_dir)
+{
+    checked([&]() {
+        DrainManager::instance().preCheckpointRestore();
+        CheckpointIn ckpt(ckpt_dir, manager().getSimObjectResolver());
+        Serializable::unserializeGlobals(ckpt);
+        manager().loadState(ckpt);
+    });
+}
+
+} // anonymous namespace
+
+void
+pybind_init_cxx_config(py::module &m_native)
+{
+    py::module m = m_native.def_submodule("cxx_config");
+
+    m
+        .def("load", &load)
+        .def("setParam", &setParam)
+        .def("instantiate", []() {
+            checked([]() { manager().instantiate(); });
+        })
+        .def("initState", []() {
+            checked([]() { manager().initState(); });
+        })
+        .def("loadState", &loadState)
+        .def("objectNames", []() {
+            std::vector<std::string> names;
+            for (auto &object : manager().objectsByName)
+                names.push_back(object.first);
+            return names;
+        })
+        .def("startup", []() {
+            checked([]() { manager().startup(); });
+        })
+        ;
+}
@@ -45,9 +45,11 @@
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 
+#include <cstdlib>
 #include <map>
 #include <vector>
 
+#include "base/binary_trace.hh"
 #include "base/debug.hh"
 #include "base/output.hh"
 #include "base/trace.hh"
@@ -70,6 +72,26 @@ output(const char *filename)
     Trace::setDebugLogger(new Trace::OstreamLogger(*file_stream->stream()));
 }
 
+static void
+binaryOutput(const char *filename, size_t flight_bytes)
+{
+    OutputStream *file_stream = simout.find(filename);
+
+    if (!file_stream)
+        file_stream = simout.create(filename, true);
+
+    Trace::setDebugLogger(
+        new Trace::BinaryLogger(*file_stream->stream(), flight_bytes));
+
+    // Buffered records must reach the file even if the simulation
+    // ends with a fatal error
+    static bool registered = false;
+    if (!registered) {
+        std::atexit(Trace::flushDebugLogger);
+        registered = true;
+    }
+}
+
 static void
 ignore(const char *expr)
 {
@@ -103,6 +125,7 @@ pybind_init_debug(py::module &m_native)
         .def("enable", &Debug::Flag::enable)
         .def("disable", &Debug::Flag::disable)
         .def("sync", &Debug::Flag::sync)
+        .def("compiledIn", &Debug::Flag::compiledIn)
         ;
 
     py::class_<Debug::SimpleFlag>(m_debug, "SimpleFlag", c_flag);
@@ -112,6 +135,7 @@ pybind_init_debug(py::module &m_native)
     py::module m_trace = m_native.def_submodule("trace");
     m_trace
         .def("output", &output)
+        .def("binaryOutput", &binaryOutput)
         .def("ignore", &ignore)
         .def("enable", &Trace::enable)
         .def("disable", &Trace::disable)
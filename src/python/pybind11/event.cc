@@ -47,6 +47,7 @@
 #include "pybind11/stl.h"
 
 #include "base/logging.hh"
+#include "sim/event_profiler.hh"
 #include "sim/eventq.hh"
 #include "sim/sim_events.hh"
 #include "sim/sim_exit.hh"
@@ -114,6 +115,11 @@ pybind_init_event(py::module &m_native)
     m.def("setEventQueue", [](EventQueue *q) { return curEventQueue(q); });
     m.def("getEventQueue", &getEventQueue,
           py::return_value_policy::reference);
+    m.def("enableProfiler", &enableEventProfiler);
+    m.def("regProfilerStats", [](const std::vector<std::string> &objects) {
+            if (eventProfiler)
+                eventProfiler->regStats(objects);
+        });
 
     py::class_<EventQueue>(m, "EventQueue")
         .def("name",  [](EventQueue *eq) { return eq->name(); })
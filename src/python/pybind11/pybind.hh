@@ -43,6 +43,7 @@
 #include "pybind11/pybind11.h"
 
 void pybind_init_core(pybind11::module &m_native);
+void pybind_init_cxx_config(pybind11::module &m_native);
 void pybind_init_debug(pybind11::module &m_native);
 
 void pybind_init_event(pybind11::module &m_native);
@@ -45,8 +45,11 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/binary.hh"
+#include "base/stats/snapshot.hh"
 #include "base/stats/text.hh"
 #include "base/stats/sql.hh"
+#include "sim/sim_object.hh"
 #include "sim/stat_control.hh"
 #include "sim/stat_register.hh"
 
@@ -78,7 +81,14 @@ pybind_init_stats(py::module &m_native)
     m
         .def("initSimStats", &Stats::initSimStats)
         .def("initText", &Stats::initText, py::return_value_policy::reference)
-        .def("initOutputSQL", &Stats::initOutputSQL, py::return_value_policy::reference)
+        .def("initOutputSQL", &Stats::initOutputSQL,
+             py::arg("filename"), py::arg("defer_indexes") = false,
+             py::return_value_policy::reference)
+        .def("reopenOutputSQL", &Stats::reopenOutputSQL,
+             py::return_value_policy::reference)
+        .def("closeOutputSQL", &Stats::closeOutputSQL)
+        .def("initBinary", &Stats::initBinary,
+             py::return_value_policy::reference)
         .def("registerPythonStatsHandlers",
              &Stats::registerPythonStatsHandlers)
         .def("schedStatEvent", &Stats::schedStatEvent)
@@ -86,9 +96,18 @@ pybind_init_stats(py::module &m_native)
         .def("updateEvents", &Stats::updateEvents)
         .def("processResetQueue", &Stats::processResetQueue)
         .def("processDumpQueue", &Stats::processDumpQueue)
+        .def("setDumpOrder", &Stats::setDumpOrder)
         .def("enable", &Stats::enable)
         .def("enabled", &Stats::enabled)
         .def("statsList", &Stats::statsList)
+        .def("takeChangedStats", &Stats::takeChangedStats,
+             py::return_value_policy::reference)
+        .def("clearChangedStats", &Stats::clearChangedStats)
+        .def("resetChangedStats", &Stats::resetChangedStats)
+        .def("resetSimObjectStats", &SimObject::resetAllStats)
+        .def("dumpAsync", &Stats::dumpAsync)
+        .def("drainAsyncDumps", &Stats::drainAsyncDumps)
+        .def("stopAsyncDumps", &Stats::stopAsyncDumps)
         ;
 
     py::class_<Stats::Output>(m, "Output")
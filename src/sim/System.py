@@ -59,6 +59,8 @@ class System(MemObject):
     cxx_exports = [
         PyBindMethod("getMemoryMode"),
         PyBindMethod("setMemoryMode"),
+        PyBindMethod("selectAccelerator"),
+        PyBindMethod("startPendingAccelerators"),
     ]
 
     memories = VectorParam.AbstractMemory(Self.all,
@@ -100,6 +102,16 @@ class System(MemObject):
     work_cpus_ckpt_count = Param.Counter(0,
         "create checkpoint when active cpu count value is reached")
 
+    # Accelerators can stand in for the request code that programs invoke
+    # them with, e.g. to simulate several design points of one accelerator
+    # from a single run that is forked at the first invocation.
+    exit_on_accel_invocation = Param.Bool(False, "Exit from the simulation "
+        "loop when an accelerator is first invoked, without starting it")
+    accel_alias_codes = VectorParam.Int([], "Request codes that the "
+        "accelerators in accel_alias_ids stand in for")
+    accel_alias_ids = VectorParam.Int([], "Accelerators that stand in for "
+        "the request codes in accel_alias_codes")
+
     init_param = Param.UInt64(0, "numerical value to pass into simulator")
     boot_osflags = Param.String("a", "boot flags to pass to the kernel")
     kernel = Param.String("", "file that contains the kernel code")
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_ACCEL_ALIASES_HH__
+#define __SIM_ACCEL_ALIASES_HH__
+
+#include <map>
+#include <vector>
+
+/**
+ * Maps an IOCTL request code to the ids of the accelerators that stand in
+ * for it, e.g. one per design point when the simulator is forked at the
+ * first accelerator invocation. Request codes that aren't in the map stand
+ * for the accelerator with that id.
+ */
+class AcceleratorAliases
+{
+  public:
+    /** Makes accelerator accel_id stand in for request code id. */
+    void add(int id, int accel_id);
+
+    /** Returns the ids of the accelerators that a request code stands for,
+     * in the order they were added. */
+    std::vector<int> ids(int id) const;
+
+    /**
+     * Makes a request code stand for only one of the accelerators that
+     * stand in for it.
+     *
+     * @return False if accel_id doesn't stand in for id.
+     */
+    bool select(int id, int accel_id);
+
+  private:
+    std::map<int, std::vector<int>> aliases;
+};
+
+#endif // __SIM_ACCEL_ALIASES_HH__
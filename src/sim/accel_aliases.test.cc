@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "sim/accel_aliases.hh"
+
+TEST(AcceleratorAliases, UnaliasedCodeStandsForItself)
+{
+    AcceleratorAliases aliases;
+    aliases.add(0x10, 0x100);
+    EXPECT_EQ(std::vector<int>({0x20}), aliases.ids(0x20));
+}
+
+TEST(AcceleratorAliases, IdsKeepInsertionOrder)
+{
+    AcceleratorAliases aliases;
+    aliases.add(0x10, 0x102);
+    aliases.add(0x10, 0x100);
+    aliases.add(0x10, 0x101);
+    aliases.add(0x20, 0x200);
+    EXPECT_EQ(std::vector<int>({0x102, 0x100, 0x101}), aliases.ids(0x10));
+    EXPECT_EQ(std::vector<int>({0x200}), aliases.ids(0x20));
+}
+
+TEST(AcceleratorAliases, SelectLeavesOneId)
+{
+    AcceleratorAliases aliases;
+    aliases.add(0x10, 0x100);
+    aliases.add(0x10, 0x101);
+    aliases.add(0x20, 0x200);
+    aliases.add(0x20, 0x201);
+    EXPECT_TRUE(aliases.select(0x10, 0x101));
+    EXPECT_EQ(std::vector<int>({0x101}), aliases.ids(0x10));
+    // Other request codes are unaffected
+    EXPECT_EQ(std::vector<int>({0x200, 0x201}), aliases.ids(0x20));
+    // Selecting again is a no-op
+    EXPECT_TRUE(aliases.select(0x10, 0x101));
+    EXPECT_EQ(std::vector<int>({0x101}), aliases.ids(0x10));
+}
+
+TEST(AcceleratorAliases, SelectRejectsForeignId)
+{
+    AcceleratorAliases aliases;
+    aliases.add(0x10, 0x100);
+    aliases.add(0x10, 0x101);
+    EXPECT_FALSE(aliases.select(0x10, 0x200));
+    EXPECT_EQ(std::vector<int>({0x100, 0x101}), aliases.ids(0x10));
+    // Once selected, the other stand-ins can't be picked any more
+    EXPECT_TRUE(aliases.select(0x10, 0x100));
+    EXPECT_FALSE(aliases.select(0x10, 0x101));
+}
+
+TEST(AcceleratorAliases, SelectUnaliasedCode)
+{
+    AcceleratorAliases aliases;
+    EXPECT_TRUE(aliases.select(0x30, 0x30));
+    EXPECT_FALSE(aliases.select(0x30, 0x31));
+    EXPECT_EQ(std::vector<int>({0x30}), aliases.ids(0x30));
+}
@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A binary, sectioned container for checkpoints.
+ */
+
+#include "sim/binary_checkpoint.hh"
+
+#include <cstdio>
+#include <iterator>
+
+#include "base/inifile.hh"
+#include "base/logging.hh"
+#include "base/str.hh"
+
+using namespace std;
+
+namespace BinaryCheckpoint {
+
+namespace {
+
+const char magic[] = "gem5cpt";
+const uint8_t version = 1;
+const size_t headerSize = sizeof(magic) - 1 + 1;
+
+/** Reads values from a part of a file, checking that they are in it */
+class Cursor
+{
+  private:
+    const char *pos;
+    const char *end;
+
+  public:
+    Cursor(const char *pos, const char *end) : pos(pos), end(end) {}
+
+    bool done() const { return pos == end; }
+
+    const char *
+    skip(uint64_t size)
+    {
+        if (size > uint64_t(end - pos))
+            return nullptr;
+        const char *data = pos;
+        pos += size;
+        return data;
+    }
+
+    template <class T>
+    bool
+    get(T &value)
+    {
+        const char *data = skip(sizeof(value));
+        if (data)
+            memcpy(&value, data, sizeof(value));
+        return data;
+    }
+
+    bool
+    get(string &str)
+    {
+        uint32_t size;
+        const char *data;
+        if (!get(size) || !(data = skip(size)))
+            return false;
+        str.assign(data, size);
+        return true;
+    }
+};
+
+template <class T>
+void
+showValues(ostream &os, const Entry &entry)
+{
+    vector<T> values;
+    entry.get<T>(back_inserter(values));
+    for (size_t i = 0; i < values.size(); ++i)
+        os << (i ? " " : "") << +values[i];
+}
+
+template <class T>
+void
+showFloats(ostream &os, const Entry &entry)
+{
+    vector<T> values;
+    entry.get<T>(back_inserter(values));
+    char buf[32];
+    for (size_t i = 0; i < values.size(); ++i) {
+        // Enough digits to read back the same value
+        snprintf(buf, sizeof(buf), "%.17g", double(values[i]));
+        os << (i ? " " : "") << buf;
+    }
+}
+
+} // anonymous namespace
+
+size_t
+typeSize(Type type)
+{
+    switch (type) {
+      case Text: case Bool: case Int8: case UInt8: return 1;
+      case Int16: case UInt16: return 2;
+      case Int32: case UInt32: case Float: return 4;
+      case Int64: case UInt64: case Double: return 8;
+    }
+    return 0;
+}
+
+string
+Entry::str() const
+{
+    if (type == Text)
+        return string(data, count);
+
+    ostringstream os;
+    switch (type) {
+      case Bool: {
+          vector<bool> values;
+          get<bool>(back_inserter(values));
+          for (size_t i = 0; i < values.size(); ++i)
+              os << (i ? " " : "") << (values[i] ? "true" : "false");
+          break;
+      }
+      case Int8: showValues<int8_t>(os, *this); break;
+      case UInt8: showValues<uint8_t>(os, *this); break;
+      case Int16: showValues<int16_t>(os, *this); break;
+      case UInt16: showValues<uint16_t>(os, *this); break;
+      case Int32: showValues<int32_t>(os, *this); break;
+      case UInt32: showValues<uint32_t>(os, *this); break;
+      case Int64: showValues<int64_t>(os, *this); break;
+      case UInt64: showValues<uint64_t>(os, *this); break;
+      case Float: showFloats<float>(os, *this); break;
+      case Double: showFloats<double>(os, *this); break;
+      case Text: break;
+    }
+    return os.str();
+}
+
+Writer::Writer()
+    : std::ostream(nullptr), inSection(false)
+{
+    rdbuf(&text);
+}
+
+Writer::~Writer()
+{
+    close();
+}
+
+bool
+Writer::open(const string &filename)
+{
+    file.open(filename.c_str(), ios::binary | ios::trunc);
+    if (!file.is_open())
+        return false;
+
+    file.write(magic, sizeof(magic) - 1);
+    file.put(version);
+    return true;
+}
+
+void
+Writer::close()
+{
+    if (!file.is_open())
+        return;
+
+    endSection();
+
+    const uint64_t text_offset = file.tellp();
+    file.write(iniText.data(), iniText.size());
+
+    const uint64_t index_offset = file.tellp();
+    string data;
+    append<uint64_t>(data, text_offset);
+    append<uint64_t>(data, iniText.size());
+    append<uint32_t>(data, index.size());
+    for (const auto &part : index) {
+        append<uint32_t>(data, part.name.size());
+        data.append(part.name);
+        append<uint64_t>(data, part.offset);
+        append<uint64_t>(data, part.size);
+    }
+    append<uint64_t>(data, index_offset);
+    file.write(data.data(), data.size());
+    file.close();
+
+    if (file.fail())
+        warn("Error writing binary checkpoint\n");
+}
+
+void
+Writer::flushText()
+{
+    const string &written = text.str();
+    if (written.empty())
+        return;
+
+    // Like ini files, ignore text that isn't in a section
+    if (inSection) {
+        iniText += "\n[" + sectionName + "]\n";
+        iniText += written;
+        if (written.back() != '\n')
+            iniText += '\n';
+    }
+    text.str("");
+}
+
+void
+Writer::endSection()
+{
+    flushText();
+    if (!inSection)
+        return;
+
+    index.push_back(Part{ sectionName, uint64_t(file.tellp()),
+                          sectionData.size() });
+    file.write(sectionData.data(), sectionData.size());
+    sectionData.clear();
+    inSection = false;
+}
+
+void
+Writer::section(const string &name)
+{
+    endSection();
+    sectionName = name;
+    inSection = true;
+}
+
+void
+Writer::beginEntry(const string &name, Type type, uint64_t count)
+{
+    flushText();
+    if (!inSection)
+        panic("Binary checkpoint entry '%s' isn't in a section\n", name);
+
+    append<uint32_t>(sectionData, name.size());
+    sectionData.append(name);
+    append<uint8_t>(sectionData, type);
+    append<uint64_t>(sectionData, count);
+}
+
+void
+Writer::putText(const string &name, const string &value)
+{
+    // Ini files strip the white space around values
+    string stripped(value);
+    eat_white(stripped);
+
+    beginEntry(name, Text, stripped.size());
+    sectionData.append(stripped);
+}
+
+bool
+Reader::isBinary(const string &filename)
+{
+    ifstream f(filename.c_str(), ios::binary);
+    char header[headerSize];
+    return f.read(header, sizeof(header)) &&
+        memcmp(header, magic, sizeof(magic) - 1) == 0;
+}
+
+bool
+Reader::load(const string &filename, IniFile &ini)
+{
+    ifstream f(filename.c_str(), ios::binary | ios::ate);
+    if (!f.is_open())
+        return false;
+    contents.resize(f.tellg());
+    f.seekg(0);
+    if (!f.read(&contents[0], contents.size()))
+        return false;
+
+    uint64_t index_offset;
+    if (contents.size() < headerSize + sizeof(index_offset) ||
+        memcmp(contents.data(), magic, sizeof(magic) - 1) != 0) {
+        return false;
+    }
+
+    if (uint8_t(contents[headerSize - 1]) != version) {
+        warn("Unsupported binary checkpoint version %d\n",
+             uint8_t(contents[headerSize - 1]));
+        return false;
+    }
+
+    const char *begin = contents.data();
+    const char *end = begin + contents.size() - sizeof(index_offset);
+    memcpy(&index_offset, end, sizeof(index_offset));
+    if (index_offset < headerSize || index_offset > uint64_t(end - begin))
+        return false;
+
+    Cursor index(begin + index_offset, end);
+    uint64_t text_offset, text_size;
+    uint32_t parts;
+    if (!index.get(text_offset) || !index.get(text_size) ||
+        !index.get(parts) || text_offset > index_offset ||
+        text_size > index_offset - text_offset) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < parts; ++i) {
+        string name;
+        uint64_t offset, size;
+        if (!index.get(name) || !index.get(offset) || !index.get(size) ||
+            offset > index_offset || size > index_offset - offset) {
+            return false;
+        }
+        sections[name].parts.emplace_back(offset, size);
+    }
+
+    istringstream text(string(begin + text_offset, text_size));
+    return ini.load(text);
+}
+
+bool
+Reader::decode(Section &section)
+{
+    for (const auto &part : section.parts) {
+        const char *begin = contents.data() + part.first;
+        Cursor cursor(begin, begin + part.second);
+        while (!cursor.done()) {
+            string name;
+            uint8_t type;
+            Entry entry;
+            if (!cursor.get(name) || !cursor.get(type) || type > Double ||
+                !cursor.get(entry.count)) {
+                return false;
+            }
+            entry.type = Type(type);
+            const uint64_t size = typeSize(entry.type);
+            if (entry.count > UINT64_MAX / size ||
+                !(entry.data = cursor.skip(entry.count * size))) {
+                return false;
+            }
+            section.entries[name] = entry;
+        }
+    }
+    section.decoded = true;
+    return true;
+}
+
+const Entry *
+Reader::find(const string &section, const string &entry)
+{
+    auto s = sections.find(section);
+    if (s == sections.end())
+        return nullptr;
+
+    if (!s->second.decoded && !decode(s->second))
+        fatal("Malformed section '%s' in binary checkpoint\n", section);
+
+    auto e = s->second.entries.find(entry);
+    return e == s->second.entries.end() ? nullptr : &e->second;
+}
+
+bool
+Reader::sectionExists(const string &section) const
+{
+    return sections.find(section) != sections.end();
+}
+
+} // namespace BinaryCheckpoint
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A binary, sectioned container for checkpoints.
+ *
+ * Binary checkpoints replace the ini text of m5.cpt when checkpoints are
+ * taken with --checkpoint-format=binary. They are written and read
+ * through the usual paramOut()/paramIn() family of functions, which
+ * store arithmetic values and arrays of them in their binary
+ * representation instead of printing and parsing every element. Other
+ * values, e.g. strings and BitUnions, are stored as the text that
+ * showParam() produces, and anything written to the checkpoint stream
+ * directly is kept as ini text. util/cpt_convert.py converts between
+ * the binary and the ini format.
+ *
+ * The file starts with the magic "gem5cpt" and a version byte, followed
+ * by the sections, the ini text and the index. All integers are in host
+ * byte order and strings are a uint32 length followed by the characters.
+ *
+ * A section is a sequence of entries, each of which is the entry name,
+ * a uint8 Type, a uint64 count and the data: count elements of the type,
+ * or count characters for Text entries. A section that is written more
+ * than once has several parts, and later entries replace earlier ones
+ * with the same name, like in ini files.
+ *
+ * The index is a uint64 offset and size of the ini text, a uint32 count
+ * of section parts and the name, uint64 offset and uint64 size of each.
+ * The file ends with the uint64 offset of the index.
+ */
+
+#ifndef __SIM_BINARY_CHECKPOINT_HH__
+#define __SIM_BINARY_CHECKPOINT_HH__
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+class IniFile;
+
+namespace BinaryCheckpoint {
+
+enum Type : uint8_t {
+    Text,
+    Bool,
+    Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64,
+    Float, Double,
+};
+
+/** The type that values of type T are stored as, Text if they aren't */
+template <class T>
+struct TypeOf
+{
+    typedef typename std::remove_cv<T>::type U;
+
+    static const Type value =
+        std::is_same<U, bool>::value ? Bool :
+        std::is_floating_point<U>::value ?
+            (sizeof(U) == 4 ? Float : sizeof(U) == 8 ? Double : Text) :
+        !std::is_integral<U>::value ? Text :
+        sizeof(U) == 1 ? (std::is_signed<U>::value ? Int8 : UInt8) :
+        sizeof(U) == 2 ? (std::is_signed<U>::value ? Int16 : UInt16) :
+        sizeof(U) == 4 ? (std::is_signed<U>::value ? Int32 : UInt32) :
+        sizeof(U) == 8 ? (std::is_signed<U>::value ? Int64 : UInt64) :
+        Text;
+};
+
+template <class T>
+const Type TypeOf<T>::value;
+
+/** Whether values of type T are stored in their binary representation */
+template <class T>
+struct IsTyped : std::integral_constant<bool, TypeOf<T>::value != Text>
+{
+};
+
+/** The size of one element of a type, 1 for the characters of Text */
+size_t typeSize(Type type);
+
+/** An entry of a section in a binary checkpoint */
+class Entry
+{
+  private:
+    /** Convert the elements, stored as From, to T */
+    template <class From, class T, class OutputIt>
+    void
+    convert(OutputIt out) const
+    {
+        for (uint64_t i = 0; i < count; ++i) {
+            From value;
+            std::memcpy(&value, data + i * sizeof(From), sizeof(From));
+            *out++ = static_cast<T>(value);
+        }
+    }
+
+    template <class T, class OutputIt>
+    void
+    get(OutputIt out, std::true_type) const
+    {
+        switch (type) {
+          case Bool: convert<uint8_t, T>(out); break;
+          case Int8: convert<int8_t, T>(out); break;
+          case UInt8: convert<uint8_t, T>(out); break;
+          case Int16: convert<int16_t, T>(out); break;
+          case UInt16: convert<uint16_t, T>(out); break;
+          case Int32: convert<int32_t, T>(out); break;
+          case UInt32: convert<uint32_t, T>(out); break;
+          case Int64: convert<int64_t, T>(out); break;
+          case UInt64: convert<uint64_t, T>(out); break;
+          case Float: convert<float, T>(out); break;
+          case Double: convert<double, T>(out); break;
+          case Text: break;
+        }
+    }
+
+    template <class T, class OutputIt>
+    void get(OutputIt out, std::false_type) const { }
+
+  public:
+    Type type;
+    uint64_t count;
+    const char *data;
+
+    /**
+     * Write the count elements of a typed entry, converted to T, to an
+     * output iterator. Does nothing if T isn't stored in binary.
+     */
+    template <class T, class OutputIt>
+    void get(OutputIt out) const { get<T>(out, IsTyped<T>()); }
+
+    /** The entry as ini text, with the elements separated by spaces */
+    std::string str() const;
+};
+
+/**
+ * Writes a binary checkpoint. The writer is the checkpoint stream that
+ * is passed to serialize(), and text that is written to it directly is
+ * kept as ini text of the current section.
+ */
+class Writer : public std::ostream
+{
+  private:
+    std::ofstream file;
+
+    /** Text written to the stream since the last entry or section */
+    std::stringbuf text;
+
+    /** Ini text of the whole checkpoint */
+    std::string iniText;
+
+    std::string sectionName;
+    std::string sectionData;
+    bool inSection;
+
+    struct Part
+    {
+        std::string name;
+        uint64_t offset;
+        uint64_t size;
+    };
+    std::vector<Part> index;
+
+    /** Move text written to the stream to the ini text */
+    void flushText();
+
+    /** Write the current section to the file */
+    void endSection();
+
+    void beginEntry(const std::string &name, Type type, uint64_t count);
+
+    template <class T>
+    static void
+    append(std::string &buf, T value)
+    {
+        buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+  public:
+    Writer();
+    ~Writer();
+
+    /** The writer if a checkpoint stream is one, nullptr otherwise */
+    static Writer *
+    from(std::ostream &os)
+    {
+        return dynamic_cast<Writer *>(&os);
+    }
+
+    bool open(const std::string &filename);
+
+    /** Write the index and close the file */
+    void close();
+
+    /** Start a new section, which the following entries are part of */
+    void section(const std::string &name);
+
+    void putText(const std::string &name, const std::string &value);
+
+    /** Add an entry of the values in [begin, end), whose type is T */
+    template <class T, class InputIt>
+    void
+    putValues(const std::string &name, InputIt begin, InputIt end,
+              uint64_t count)
+    {
+        static_assert(IsTyped<T>::value, "Type isn't stored in binary");
+
+        typedef typename std::conditional<
+            std::is_same<T, bool>::value, uint8_t, T>::type Stored;
+
+        beginEntry(name, TypeOf<T>::value, count);
+        for (InputIt it = begin; it != end; ++it)
+            append<Stored>(sectionData, static_cast<T>(*it));
+    }
+};
+
+/**
+ * Reads a binary checkpoint. Sections are only decoded when an entry of
+ * them is first looked up.
+ */
+class Reader
+{
+  private:
+    std::string contents;
+
+    struct Section
+    {
+        /** Offsets and sizes of the parts of the section */
+        std::vector<std::pair<uint64_t, uint64_t>> parts;
+        bool decoded;
+        std::unordered_map<std::string, Entry> entries;
+
+        Section() : decoded(false) {}
+    };
+    std::unordered_map<std::string, Section> sections;
+
+    bool decode(Section &section);
+
+  public:
+    /** Whether a file is a binary checkpoint */
+    static bool isBinary(const std::string &filename);
+
+    /**
+     * Load a binary checkpoint and add its ini text to an IniFile.
+     * @return false if the file can't be read or is malformed.
+     */
+    bool load(const std::string &filename, IniFile &ini);
+
+    /** Find an entry that was stored in binary or as text */
+    const Entry *find(const std::string &section, const std::string &entry);
+
+    bool sectionExists(const std::string &section) const;
+};
+
+} // namespace BinaryCheckpoint
+
+#endif // __SIM_BINARY_CHECKPOINT_HH__
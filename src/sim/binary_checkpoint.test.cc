@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Unit tests for binary checkpoints.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "base/inifile.hh"
+#include "base/str.hh"
+#include "sim/binary_checkpoint.hh"
+
+using namespace BinaryCheckpoint;
+
+namespace {
+
+/** A temporary checkpoint file */
+class TempFile
+{
+  public:
+    std::string path;
+
+    TempFile()
+    {
+        char name[] = "/tmp/cpt_testXXXXXX";
+        int fd = mkstemp(name);
+        EXPECT_GE(fd, 0);
+        ::close(fd);
+        path = name;
+    }
+
+    ~TempFile() { unlink(path.c_str()); }
+};
+
+template <class T>
+void
+putValues(Writer &writer, const std::string &name, const std::vector<T> &v)
+{
+    writer.putValues<T>(name, v.begin(), v.end(), v.size());
+}
+
+template <class T>
+std::vector<T>
+getValues(const Entry *entry)
+{
+    std::vector<T> values;
+    if (entry)
+        entry->get<T>(std::back_inserter(values));
+    return values;
+}
+
+} // anonymous namespace
+
+TEST(BinaryCheckpointTest, TypeOf)
+{
+    EXPECT_EQ(TypeOf<bool>::value, Bool);
+    EXPECT_EQ(TypeOf<uint8_t>::value, UInt8);
+    EXPECT_EQ(TypeOf<int16_t>::value, Int16);
+    EXPECT_EQ(TypeOf<const uint32_t>::value, UInt32);
+    EXPECT_EQ(TypeOf<int64_t>::value, Int64);
+    EXPECT_EQ(TypeOf<float>::value, Float);
+    EXPECT_EQ(TypeOf<double>::value, Double);
+    EXPECT_EQ(TypeOf<long double>::value, Text);
+    EXPECT_EQ(TypeOf<std::string>::value, Text);
+}
+
+// Values are read back exactly, converted and as text
+TEST(BinaryCheckpointTest, RoundTrip)
+{
+    TempFile file;
+    {
+        Writer writer;
+        ASSERT_TRUE(writer.open(file.path));
+        writer.section("system.cpu");
+        putValues<uint64_t>(writer, "regs", { 0, 1, UINT64_MAX });
+        putValues<int8_t>(writer, "small", { -1, 2 });
+        putValues<double>(writer, "ratio", { 0.1 });
+        putValues<bool>(writer, "flags", { true, false });
+        writer.putText("name", "  system.mem  ");
+        writer.section("system.cpu.empty");
+        writer.section("system.cpu");
+        putValues<uint32_t>(writer, "small", { 7 });
+        writer.close();
+    }
+
+    ASSERT_TRUE(Reader::isBinary(file.path));
+    Reader reader;
+    IniFile ini;
+    ASSERT_TRUE(reader.load(file.path, ini));
+
+    EXPECT_TRUE(reader.sectionExists("system.cpu"));
+    EXPECT_TRUE(reader.sectionExists("system.cpu.empty"));
+    EXPECT_FALSE(reader.sectionExists("system"));
+    EXPECT_EQ(reader.find("system.cpu.empty", "regs"), nullptr);
+
+    const Entry *regs = reader.find("system.cpu", "regs");
+    ASSERT_NE(regs, nullptr);
+    EXPECT_EQ(regs->type, UInt64);
+    EXPECT_EQ(getValues<uint64_t>(regs),
+              std::vector<uint64_t>({ 0, 1, UINT64_MAX }));
+    EXPECT_EQ(regs->str(), "0 1 18446744073709551615");
+
+    // The second part of the section replaces the entry
+    const Entry *small = reader.find("system.cpu", "small");
+    EXPECT_EQ(small->type, UInt32);
+    EXPECT_EQ(getValues<int>(small), std::vector<int>({ 7 }));
+
+    const Entry *ratio = reader.find("system.cpu", "ratio");
+    EXPECT_EQ(getValues<double>(ratio), std::vector<double>({ 0.1 }));
+    double parsed;
+    EXPECT_TRUE(to_number(ratio->str(), parsed));
+    EXPECT_EQ(parsed, 0.1);
+
+    const Entry *flags = reader.find("system.cpu", "flags");
+    EXPECT_EQ(getValues<bool>(flags), std::vector<bool>({ true, false }));
+    EXPECT_EQ(flags->str(), "true false");
+
+    const Entry *name = reader.find("system.cpu", "name");
+    EXPECT_EQ(name->type, Text);
+    EXPECT_EQ(name->str(), "system.mem");
+}
+
+// Text written to the stream is kept as ini text of its section
+TEST(BinaryCheckpointTest, IniText)
+{
+    TempFile file;
+    {
+        Writer writer;
+        ASSERT_TRUE(writer.open(file.path));
+        writer << "## Ignored, not in a section\n";
+        writer.section("a");
+        writer << "x=1\n";
+        putValues<int>(writer, "y", { 2 });
+        writer << "z=3";
+        writer.section("b");
+        writer << "x=4\n";
+        // Closed by the destructor
+    }
+
+    Reader reader;
+    IniFile ini;
+    ASSERT_TRUE(reader.load(file.path, ini));
+    std::string value;
+    EXPECT_TRUE(ini.find("a", "x", value));
+    EXPECT_EQ(value, "1");
+    EXPECT_TRUE(ini.find("a", "z", value));
+    EXPECT_EQ(value, "3");
+    EXPECT_TRUE(ini.find("b", "x", value));
+    EXPECT_EQ(value, "4");
+    EXPECT_FALSE(ini.entryExists("a", "y"));
+    EXPECT_NE(reader.find("a", "y"), nullptr);
+}
+
+// Truncated and ini checkpoints aren't loaded
+TEST(BinaryCheckpointTest, Malformed)
+{
+    TempFile file;
+    {
+        Writer writer;
+        ASSERT_TRUE(writer.open(file.path));
+        writer.section("a");
+        putValues<int>(writer, "x", { 1, 2, 3 });
+    }
+
+    std::string contents;
+    {
+        std::ifstream f(file.path);
+        contents.assign(std::istreambuf_iterator<char>(f),
+                        std::istreambuf_iterator<char>());
+    }
+    for (size_t size : { size_t(0), size_t(8), contents.size() - 1 }) {
+        std::ofstream(file.path).write(contents.data(), size);
+        Reader reader;
+        IniFile ini;
+        EXPECT_FALSE(reader.load(file.path, ini)) << size;
+    }
+
+    std::ofstream(file.path) << "[a]\nx=1 2 3\n";
+    EXPECT_FALSE(Reader::isBinary(file.path));
+}
+
+// A large array survives the round trip through both formats
+TEST(BinaryCheckpointTest, LargeArray)
+{
+    const size_t num_values = 1 << 16;
+    std::vector<uint64_t> values(num_values);
+    for (size_t i = 0; i < num_values; ++i)
+        values[i] = i * 0x9e3779b97f4a7c15ULL;
+
+    TempFile file;
+    {
+        Writer writer;
+        ASSERT_TRUE(writer.open(file.path));
+        writer.section("mem");
+        putValues(writer, "data", values);
+    }
+
+    Reader reader;
+    IniFile ini;
+    ASSERT_TRUE(reader.load(file.path, ini));
+    const Entry *entry = reader.find("mem", "data");
+    ASSERT_NE(entry, nullptr);
+    std::vector<uint64_t> restored(num_values);
+    entry->get<uint64_t>(restored.begin());
+    EXPECT_EQ(restored, values);
+
+    std::vector<std::string> tokens;
+    tokenize(tokens, entry->str(), ' ');
+    ASSERT_EQ(tokens.size(), num_values);
+    for (size_t i = 0; i < num_values; ++i) {
+        uint64_t value;
+        ASSERT_TRUE(to_number(tokens[i], value));
+        ASSERT_EQ(value, values[i]);
+    }
+}
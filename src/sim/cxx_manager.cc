@@ -41,6 +41,7 @@
 
 #include <cstdlib>
 #include <sstream>
+#include <vector>
 
 #include "base/str.hh"
 #include "base/trace.hh"
@@ -663,8 +664,9 @@ CxxConfigManager::serialize(std::ostream &os)
 void
 CxxConfigManager::loadState(CheckpointIn &checkpoint)
 {
-    for (auto i = objectsInOrder.begin(); i != objectsInOrder.end(); ++ i)
-        (*i)->loadState(checkpoint);
+    SimObject::loadStateAll(checkpoint,
+        std::vector<SimObject *>(objectsInOrder.begin(),
+                                 objectsInOrder.end()));
 }
 
 void
@@ -291,7 +291,8 @@ class CxxConfigManager
     /** Serialize (checkpoint) all objects to the given stream */
     void serialize(std::ostream &os);
 
-    /** Load all objects' state from the given Checkpoint */
+    /** Load all objects' state from the given Checkpoint, the
+     *  independent ones in parallel (see SimObject::loadStateAll) */
     void loadState(CheckpointIn &checkpoint);
 
     /** Delete all objects and clear objectsByName and objectsByOrder */
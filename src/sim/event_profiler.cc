@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A sampling profiler of the host time spent on simulated events.
+ */
+
+#include "sim/event_profiler.hh"
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+
+#include "base/callback.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "sim/core.hh"
+#include "sim/eventq.hh"
+
+EventProfiler *eventProfiler = NULL;
+
+EventProfiler::EventProfiler(unsigned period, const std::string &path)
+    : period(std::max(period, 1U)), path(path), seed(0x9e3779b97f4a7c15ULL),
+      statsRegistered(false)
+{
+}
+
+void
+EventProfiler::regStats(const std::vector<std::string> &names)
+{
+    using namespace Stats;
+
+    for (auto &name : names)
+        objects.emplace(name, objects.size());
+    const unsigned other = objects.size();
+
+    statCycles
+        .init(other + 1)
+        .name("event_profile.host_cycles")
+        .desc("Estimated host cycles spent on the events of each object")
+        .flags(total | nozero)
+        ;
+    statEvents
+        .init(other + 1)
+        .name("event_profile.events")
+        .desc("Estimated number of events of each object")
+        .flags(total | nozero)
+        ;
+    statReschedules
+        .init(other + 1)
+        .name("event_profile.reschedules")
+        .desc("Estimated number of reschedules of the events of each object")
+        .flags(total | nozero)
+        ;
+
+    for (auto &object : objects) {
+        statCycles.subname(object.second, object.first);
+        statEvents.subname(object.second, object.first);
+        statReschedules.subname(object.second, object.first);
+    }
+    statCycles.subname(other, "other");
+    statEvents.subname(other, "other");
+    statReschedules.subname(other, "other");
+
+    statsRegistered = true;
+}
+
+uint64_t
+EventProfiler::hostCycles()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+unsigned
+EventProfiler::nextInterval()
+{
+    // Random intervals, so that the samples don't follow any periodic
+    // pattern of events, uniform in [1, 2 * period - 1] with xorshift
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return 1 + seed % (2 * period - 1);
+}
+
+EventProfiler::Entry &
+EventProfiler::entry(const Event *event)
+{
+    const std::string name = event->name();
+    const char *desc = event->description();
+
+    std::string key = name + '\0' + desc;
+    auto it = entries.find(key);
+    if (it != entries.end())
+        return it->second;
+
+    // The SimObject is the longest prefix of the name that names one
+    std::string::size_type end = name.size();
+    auto object = objects.end();
+    while (end != std::string::npos && end > 0) {
+        object = objects.find(name.substr(0, end));
+        if (object != objects.end())
+            break;
+        end = name.rfind('.', end - 1);
+    }
+
+    Entry e;
+    e.hostCycles = e.events = e.reschedules = 0;
+    if (object != objects.end()) {
+        e.object = object->second;
+        e.stack = name;
+        std::replace(e.stack.begin(), e.stack.end(), ';', ':');
+        std::replace(e.stack.begin(), e.stack.end(), '.', ';');
+    } else {
+        // Events that don't belong to an object, which are usually
+        // named after their address, are merged by description
+        e.object = objects.size();
+        e.stack = "other";
+        key = std::string("\0", 1) + desc;
+        it = entries.find(key);
+        if (it != entries.end())
+            return it->second;
+    }
+    e.stack += std::string(";") + desc;
+
+    return entries.emplace(key, e).first->second;
+}
+
+unsigned
+EventProfiler::process(Event *event)
+{
+    // The event may not exist after being processed
+    std::unique_lock<std::mutex> lock(mutex);
+    Entry &e = entry(event);
+    lock.unlock();
+
+    const uint64_t start = hostCycles();
+    event->process();
+    const uint64_t end = hostCycles();
+    // The TSCs of different cores may be slightly apart, so the time may
+    // seem to go backwards when the thread migrates
+    const double cycles = end > start ? end - start : 0;
+
+    lock.lock();
+    e.hostCycles += cycles * period;
+    e.events += period;
+    if (statsRegistered) {
+        statCycles[e.object] += cycles * period;
+        statEvents[e.object] += period;
+    }
+    return nextInterval();
+}
+
+unsigned
+EventProfiler::reschedule(const Event *event)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Entry &e = entry(event);
+    e.reschedules += period;
+    if (statsRegistered)
+        statReschedules[e.object] += period;
+    return nextInterval();
+}
+
+void
+EventProfiler::dump(const std::string &file, double Entry::*count)
+{
+    OutputStream *os = simout.create(file);
+    std::ostream &out = *os->stream();
+    for (auto &entry : entries) {
+        const Entry &e = entry.second;
+        if (e.*count > 0)
+            ccprintf(out, "%s %d\n", e.stack, (uint64_t)(e.*count));
+    }
+    simout.close(os);
+}
+
+void
+EventProfiler::dump()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    dump(path, &Entry::hostCycles);
+    dump(path + ".events", &Entry::events);
+    dump(path + ".reschedules", &Entry::reschedules);
+}
+
+void
+enableEventProfiler(unsigned period, const std::string &path)
+{
+    fatal_if(eventProfiler, "The event profiler is already enabled\n");
+
+    eventProfiler = new EventProfiler(period, path);
+    registerExitCallback(
+        new MakeCallback<EventProfiler, &EventProfiler::dump>(eventProfiler));
+}
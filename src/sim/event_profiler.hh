@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * A sampling profiler of the host time spent on simulated events.
+ *
+ * When it is enabled, EventQueue::serviceOne() times a random sample of
+ * the events it services, on average one in every period events, and
+ * EventQueue::reschedule() samples reschedules in the same way. Each
+ * sample is attributed to the SimObject of the event, the longest prefix
+ * of the name of the event that names a SimObject, and to the description
+ * of the event. The totals, estimated from the samples, are kept as stats
+ * by SimObject and written as folded stacks for flame graph tools at the
+ * end of the simulation: the host cycles to the profile file, and the
+ * numbers of events and reschedules to the same file with an .events and
+ * a .reschedules suffix.
+ */
+
+#ifndef __SIM_EVENT_PROFILER_HH__
+#define __SIM_EVENT_PROFILER_HH__
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/statistics.hh"
+
+class Event;
+
+class EventProfiler
+{
+  public:
+    /**
+     * @param period The average number of events per sample.
+     * @param path The file in the output directory to write the folded
+     *        stacks of the host cycles to.
+     */
+    EventProfiler(unsigned period, const std::string &path);
+
+    /**
+     * Register the stats, with an element for each SimObject.
+     *
+     * @param objects The names of all SimObjects.
+     */
+    void regStats(const std::vector<std::string> &objects);
+
+    /**
+     * Process a sampled event and account for the host time it takes.
+     *
+     * @return The number of events until the next sample.
+     */
+    unsigned process(Event *event);
+
+    /**
+     * Account for a sampled reschedule of an event.
+     *
+     * @return The number of reschedules until the next sample.
+     */
+    unsigned reschedule(const Event *event);
+
+    /** Write the folded stacks of all samples so far */
+    void dump();
+
+  private:
+    struct Entry
+    {
+        /** The element of the stats of the SimObject of the event */
+        unsigned object;
+        /** The folded stack of the event, without the count */
+        std::string stack;
+        double hostCycles;
+        double events;
+        double reschedules;
+    };
+
+    /** Write the folded stacks of one of the counts of the entries */
+    void dump(const std::string &file, double Entry::*count);
+
+    /** The entry of an event, created on its first sample */
+    Entry &entry(const Event *event);
+
+    /** A random number of events between samples, period on average */
+    unsigned nextInterval();
+
+    /** The host time in cycles, or in ns on hosts without a TSC */
+    static uint64_t hostCycles();
+
+    const unsigned period;
+    const std::string path;
+
+    /** Samples may come from the threads of several event queues */
+    std::mutex mutex;
+
+    /** Entries by event name and description */
+    std::unordered_map<std::string, Entry> entries;
+
+    /** The stats element of each SimObject, by name */
+    std::unordered_map<std::string, unsigned> objects;
+
+    /** State of the generator of sample intervals */
+    uint64_t seed;
+
+    /** Estimated host cycles, events and reschedules by SimObject */
+    Stats::Vector statCycles;
+    Stats::Vector statEvents;
+    Stats::Vector statReschedules;
+    bool statsRegistered;
+};
+
+/** The event profiler, NULL unless profiling has been enabled */
+extern EventProfiler *eventProfiler;
+
+/**
+ * Enable the event profiler, before the objects register their stats.
+ *
+ * @param period The average number of events per sample.
+ * @param path The file in the output directory for the folded stacks.
+ */
+void enableEventProfiler(unsigned period, const std::string &path);
+
+#endif // __SIM_EVENT_PROFILER_HH__
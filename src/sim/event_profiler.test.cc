@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "base/output.hh"
+#include "base/statistics.hh"
+#include "sim/event_profiler.hh"
+#include "sim/eventq.hh"
+
+namespace {
+
+/** An event with a given name and description that counts its calls */
+class TestEvent : public Event
+{
+  public:
+    TestEvent(const std::string &name, const char *desc)
+        : _name(name), desc(desc), processed(0)
+    {}
+
+    void process() override { ++processed; }
+
+    /** Events that don't belong to an object have a generic name */
+    const std::string
+    name() const override
+    {
+        return _name.empty() ? Event::name() : _name;
+    }
+
+    const char *description() const override { return desc; }
+
+    const std::string _name;
+    const char *desc;
+    int processed;
+};
+
+/** The lines of a file in the output directory, in any order */
+std::multiset<std::string>
+readLines(const std::string &name)
+{
+    std::multiset<std::string> lines;
+    std::ifstream in(simout.resolve(name));
+    for (std::string line; std::getline(in, line); )
+        lines.insert(line);
+    return lines;
+}
+
+/** The values of a vector stat */
+std::vector<double>
+statValues(const std::string &name)
+{
+    for (Stats::Info *info : Stats::statsList()) {
+        if (info->name != name)
+            continue;
+        const Stats::VResult &result =
+            dynamic_cast<Stats::VectorInfo *>(info)->result();
+        return std::vector<double>(result.begin(), result.end());
+    }
+    return std::vector<double>();
+}
+
+} // anonymous namespace
+
+TEST(EventProfiler, SampleIntervals)
+{
+    // Stats can't be unregistered, so profilers are never deleted
+    EventProfiler *profiler = new EventProfiler(8, "intervals");
+    TestEvent event("", "generic");
+
+    const int samples = 100000;
+    double sum = 0;
+    for (int i = 0; i < samples; ++i) {
+        unsigned interval = profiler->reschedule(&event);
+        ASSERT_GE(interval, 1);
+        ASSERT_LE(interval, 15);
+        sum += interval;
+    }
+    EXPECT_NEAR(8, sum / samples, 0.1);
+}
+
+TEST(EventProfiler, Attribution)
+{
+    char dir[] = "/tmp/event_profiler.test.XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(dir));
+    simout.setDirectory(dir);
+
+    const unsigned period = 4;
+    EventProfiler *profiler = new EventProfiler(period, "profile.folded");
+    profiler->regStats({ "system", "system.cpu", "system.cpu.icache" });
+
+    std::vector<TestEvent *> events = {
+        new TestEvent("system.cpu.tickEvent", "Tick"),
+        new TestEvent("system.cpu.icache.mem_side.respEvent", "Resp"),
+        // Attributed to the longest prefix that names an object
+        new TestEvent("system.membus.reqLayer0", "Layer"),
+        // Only prefixes that end at a dot name objects
+        new TestEvent("systemx.event", "Foo"),
+        // Merged by description
+        new TestEvent("", "Generic"),
+        new TestEvent("", "Generic"),
+        // Semicolons separate the frames of a folded stack
+        new TestEvent("system.cpu.a;b", "Semi"),
+    };
+    for (TestEvent *event : events) {
+        profiler->process(event);
+        EXPECT_EQ(1, event->processed);
+    }
+    profiler->process(events[0]);
+    profiler->reschedule(events[0]);
+    profiler->reschedule(events[1]);
+    profiler->reschedule(events[4]);
+
+    profiler->dump();
+
+    EXPECT_EQ(std::multiset<std::string>({
+                  "system;cpu;tickEvent;Tick 8",
+                  "system;cpu;icache;mem_side;respEvent;Resp 4",
+                  "system;membus;reqLayer0;Layer 4",
+                  "other;Foo 4",
+                  "other;Generic 8",
+                  "system;cpu;a:b;Semi 4",
+              }),
+              readLines("profile.folded.events"));
+    EXPECT_EQ(std::multiset<std::string>({
+                  "system;cpu;tickEvent;Tick 4",
+                  "system;cpu;icache;mem_side;respEvent;Resp 4",
+                  "other;Generic 4",
+              }),
+              readLines("profile.folded.reschedules"));
+
+    // Host cycles are written for the sampled stacks that took any
+    std::set<std::string> stacks;
+    for (const std::string &line : readLines("profile.folded.events"))
+        stacks.insert(line.substr(0, line.rfind(' ')));
+    for (const std::string &line : readLines("profile.folded"))
+        EXPECT_EQ(1, stacks.count(line.substr(0, line.rfind(' ')))) << line;
+
+    // Elements by object, in the order they were registered, then other
+    EXPECT_EQ(std::vector<double>({ 4, 12, 4, 12 }),
+              statValues("event_profile.events"));
+    EXPECT_EQ(std::vector<double>({ 0, 4, 4, 4 }),
+              statValues("event_profile.reschedules"));
+    std::vector<double> cycles = statValues("event_profile.host_cycles");
+    ASSERT_EQ(4, cycles.size());
+    for (double c : cycles)
+        EXPECT_GE(c, 0);
+
+    for (const char *name : { "profile.folded", "profile.folded.events",
+                              "profile.folded.reschedules" })
+        std::remove(simout.resolve(name).c_str());
+    rmdir(dir);
+}
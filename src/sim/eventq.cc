@@ -43,6 +43,7 @@
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
 #include "sim/core.hh"
+#include "sim/event_profiler.hh"
 #include "sim/eventq_impl.hh"
 
 using namespace std;
@@ -225,7 +226,10 @@ EventQueue::serviceOne()
         // forward current cycle to the time when this event occurs.
         setCurTick(event->when());
 
-        event->process();
+        if (eventProfiler && --profileCountdown == 0)
+            profileCountdown = eventProfiler->process(event);
+        else
+            event->process();
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -286,8 +290,15 @@ EventQueue::checkpointReschedule(Event *event)
 {
     // It's safe to call insert() directly here since this method
     // should only be called when restoring from a checkpoint (which
-    // happens before thread creation).
-    if (event->flags.isSet(Event::Scheduled))
+    // happens before thread creation). Objects that are restored in
+    // parallel (see Serializable::parallelRestore()) run in a queue of
+    // their own, and their events are inserted once they are done.
+    if (!event->flags.isSet(Event::Scheduled))
+        return;
+
+    if (inParallelMode && this != curEventQueue())
+        asyncInsert(event);
+    else
         insert(event);
 }
 void
@@ -414,8 +425,15 @@ Event::dump() const
 }
 
 EventQueue::EventQueue(const string &n)
-    : objName(n), head(NULL), _curTick(0)
+    : objName(n), head(NULL), _curTick(0), profileCountdown(1),
+      rescheduleCountdown(1)
+{
+}
+
+void
+EventQueue::profileReschedule(Event *event)
 {
+    rescheduleCountdown = eventProfiler->reschedule(event);
 }
 
 void
@@ -54,6 +54,7 @@
 
 class EventQueue;       // forward declaration
 class BaseGlobalEvent;
+class EventProfiler;
 
 //! Simulation Quantum for multiple eventq simulation.
 //! The quantum value is the period length after which the queues
@@ -76,6 +77,10 @@ extern __thread EventQueue *_curEventQueue;
 //! Current mode of execution: parallel / serial
 extern bool inParallelMode;
 
+//! The event profiler, see sim/event_profiler.hh. NULL unless profiling
+//! is enabled.
+extern EventProfiler *eventProfiler;
+
 //! Function for returning eventq queue for the provided
 //! index. The function allocates a new queue in case one
 //! does not exist for the index, provided that the index
@@ -499,6 +504,14 @@ class EventQueue
     //! List of events added by other threads to this event queue.
     std::list<Event*> async_queue;
 
+    //! Events and reschedules until the next ones that the event
+    //! profiler samples.
+    unsigned profileCountdown;
+    unsigned rescheduleCountdown;
+
+    //! Sample a reschedule for the event profiler.
+    void profileReschedule(Event *event);
+
     /**
      * Lock protecting event handling.
      *
@@ -102,6 +102,9 @@ EventQueue::reschedule(Event *event, Tick when, bool always)
     event->flags.clear(Event::Squashed);
     event->flags.set(Event::Scheduled);
 
+    if (eventProfiler && --rescheduleCountdown == 0)
+        profileReschedule(event);
+
     if (DTRACE(Event))
         event->trace("rescheduled");
 }
@@ -199,6 +199,7 @@ EmbeddedPyBind::initAll()
     m_m5.attr("__package__") = py::cast("_m5");
 
     pybind_init_core(m_m5);
+    pybind_init_cxx_config(m_m5);
     pybind_init_debug(m_m5);
 
     pybind_init_event(m_m5);
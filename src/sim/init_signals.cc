@@ -58,6 +58,7 @@
 #include "base/atomicio.hh"
 #include "base/cprintf.hh"
 #include "base/logging.hh"
+#include "base/trace.hh"
 #include "sim/async.hh"
 #include "sim/backtrace.hh"
 #include "sim/core.hh"
@@ -154,6 +155,7 @@ abortHandler(int sigtype)
     }
 
     print_backtrace();
+    Trace::flushDebugLogger();
     raiseFatalSignal(sigtype);
 }
 
@@ -39,6 +39,10 @@
 
 #include "sim/linear_solver.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <deque>
+
 std::vector <double>
 LinearSystem::solve() const
 {
@@ -85,3 +89,305 @@ LinearSystem::solve() const
 
     return ret;
 }
+
+namespace {
+
+// Whether two coefficients are equal up to rounding
+bool
+nearlyEqual(double a, double b)
+{
+    return std::fabs(a - b) <= 1e-12 * std::max(std::fabs(a), std::fabs(b));
+}
+
+}
+
+SparseLinearSystem::SparseLinearSystem(unsigned unknowns)
+    : rows(unknowns), constants(unknowns, 0.0), solution(unknowns, 0.0),
+      solved(false), factorized(false)
+{
+}
+
+void
+SparseLinearSystem::clear()
+{
+    // Keep the unknowns of each row, they are the same in the next system
+    for (auto & row: rows)
+        for (auto & c: row)
+            c.second = 0.0;
+    std::fill(constants.begin(), constants.end(), 0.0);
+}
+
+void
+SparseLinearSystem::add(unsigned eq, unsigned unkw, double value)
+{
+    assert(eq < rows.size() && unkw < rows.size());
+    for (auto & c: rows[eq]) {
+        if (c.first == unkw) {
+            c.second += value;
+            return;
+        }
+    }
+    rows[eq].push_back(std::make_pair(unkw, value));
+}
+
+const std::vector <double> &
+SparseLinearSystem::solve()
+{
+    // Factorize the coefficients the first time, and again once they have
+    // been the same in two solves in a row
+    if (rows != factorRows && (!solved || rows == lastRows)) {
+        factorRows = rows;
+        factorized = factorize();
+    }
+
+    if (factorized && rows == factorRows) {
+        solveFactorized();
+    } else {
+        if (!solveIterative())
+            solveDense();
+        lastRows = rows;
+    }
+
+    solved = true;
+    return solution;
+}
+
+bool
+SparseLinearSystem::isSymmetric() const
+{
+    for (unsigned i = 0; i < rows.size(); i++) {
+        for (auto & c: rows[i]) {
+            if (c.first == i || c.second == 0.0)
+                continue;
+            double transposed = 0.0;
+            for (auto & t: rows[c.first])
+                if (t.first == i)
+                    transposed += t.second;
+            if (!nearlyEqual(c.second, transposed))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool
+SparseLinearSystem::factorize()
+{
+    if (!isSymmetric())
+        return false;
+
+    unsigned order = rows.size();
+
+    // Order the unknowns with reverse Cuthill-McKee: a breadth first
+    // search of the graph of the matrix, starting from a node of lowest
+    // degree and visiting neighbours by increasing degree
+    std::vector < std::vector <unsigned> > adj(order);
+    for (unsigned i = 0; i < order; i++)
+        for (auto & c: rows[i])
+            if (c.first != i && c.second != 0.0)
+                adj[i].push_back(c.first);
+    auto by_degree = [&adj](unsigned a, unsigned b) {
+        return adj[a].size() < adj[b].size() ||
+            (adj[a].size() == adj[b].size() && a < b);
+    };
+    for (auto & neighbours: adj)
+        std::sort(neighbours.begin(), neighbours.end(), by_degree);
+
+    std::vector <unsigned> by_deg(order);
+    for (unsigned i = 0; i < order; i++)
+        by_deg[i] = i;
+    std::sort(by_deg.begin(), by_deg.end(), by_degree);
+
+    perm.clear();
+    std::vector <bool> visited(order, false);
+    for (auto root: by_deg) {
+        if (visited[root])
+            continue;
+        std::deque <unsigned> queue(1, root);
+        visited[root] = true;
+        while (!queue.empty()) {
+            unsigned n = queue.front();
+            queue.pop_front();
+            perm.push_back(n);
+            for (auto m: adj[n]) {
+                if (!visited[m]) {
+                    visited[m] = true;
+                    queue.push_back(m);
+                }
+            }
+        }
+    }
+    std::reverse(perm.begin(), perm.end());
+    std::vector <unsigned> pos(order);
+    for (unsigned i = 0; i < order; i++)
+        pos[perm[i]] = i;
+
+    // Lay out the rows of L and copy the lower triangle of P A P' into it
+    first.resize(order);
+    offset.resize(order + 1);
+    offset[0] = 0;
+    for (unsigned i = 0; i < order; i++) {
+        first[i] = i;
+        for (auto m: adj[perm[i]])
+            first[i] = std::min(first[i], pos[m]);
+        offset[i + 1] = offset[i] + (i - first[i]);
+    }
+    lower.assign(offset[order], 0.0);
+    diag.assign(order, 0.0);
+    for (unsigned i = 0; i < order; i++) {
+        for (auto & c: rows[i]) {
+            unsigned r = pos[i], col = pos[c.first];
+            if (col == r)
+                diag[r] += c.second;
+            else if (col < r && c.second != 0.0)
+                lower[offset[r] + col - first[r]] += c.second;
+        }
+    }
+
+    // Compute L and D row by row. Without pivoting this is only stable for
+    // definite matrices, so give up if the pivots change sign.
+    for (unsigned i = 0; i < order; i++) {
+        double *li = lower.data() + offset[i];
+        for (unsigned j = first[i]; j < i; j++) {
+            const double *lj = lower.data() + offset[j];
+            double sum = li[j - first[i]];
+            for (unsigned k = std::max(first[i], first[j]); k < j; k++)
+                sum -= li[k - first[i]] * diag[k] * lj[k - first[j]];
+            li[j - first[i]] = sum / diag[j];
+        }
+
+        double d = diag[i];
+        for (unsigned k = first[i]; k < i; k++)
+            d -= li[k - first[i]] * li[k - first[i]] * diag[k];
+        if (!std::isfinite(d) || std::fabs(d) <= 1e-12 * std::fabs(diag[i]) ||
+            (i > 0 && (d < 0) != (diag[0] < 0)))
+            return false;
+        diag[i] = d;
+    }
+
+    return true;
+}
+
+void
+SparseLinearSystem::solveFactorized()
+{
+    unsigned order = rows.size();
+
+    // Solve L D L' P x = -P c
+    std::vector <double> y(order);
+    for (unsigned i = 0; i < order; i++) {
+        const double *li = lower.data() + offset[i];
+        double sum = -constants[perm[i]];
+        for (unsigned k = first[i]; k < i; k++)
+            sum -= li[k - first[i]] * y[k];
+        y[i] = sum;
+    }
+    for (unsigned i = 0; i < order; i++)
+        y[i] /= diag[i];
+    for (int i = order - 1; i >= 0; i--) {
+        const double *li = lower.data() + offset[i];
+        for (unsigned k = first[i]; k < (unsigned)i; k++)
+            y[k] -= li[k - first[i]] * y[i];
+    }
+
+    for (unsigned i = 0; i < order; i++)
+        solution[perm[i]] = y[i];
+}
+
+bool
+SparseLinearSystem::solveIterative()
+{
+    unsigned order = rows.size();
+    if (order == 0 || !isSymmetric())
+        return false;
+
+    // Conjugate gradients on s A x = -s c, where s makes the matrix
+    // positive definite, with the diagonal as preconditioner
+    std::vector <double> d(order, 0.0);
+    for (unsigned i = 0; i < order; i++)
+        for (auto & c: rows[i])
+            if (c.first == i)
+                d[i] += c.second;
+    double sign = d[0] < 0 ? -1.0 : 1.0;
+    for (auto & v: d) {
+        v *= sign;
+        if (!(v > 0))
+            return false;
+    }
+
+    auto multiply = [this, sign](const std::vector <double> &v,
+                                 std::vector <double> &res) {
+        for (unsigned i = 0; i < rows.size(); i++) {
+            double sum = 0.0;
+            for (auto & c: rows[i])
+                sum += c.second * v[c.first];
+            res[i] = sign * sum;
+        }
+    };
+
+    // Start from the last solution, which is usually close
+    std::vector <double> &x = solution;
+    std::vector <double> r(order), z(order), p(order), q(order);
+    multiply(x, q);
+    double bnorm = 0.0, rnorm = 0.0, rz = 0.0;
+    for (unsigned i = 0; i < order; i++) {
+        double b = -sign * constants[i];
+        r[i] = b - q[i];
+        z[i] = r[i] / d[i];
+        p[i] = z[i];
+        bnorm += b * b;
+        rnorm += r[i] * r[i];
+        rz += r[i] * z[i];
+    }
+    if (bnorm == 0.0) {
+        std::fill(x.begin(), x.end(), 0.0);
+        return true;
+    }
+    double tolerance = 1e-24 * bnorm;
+
+    for (unsigned iter = 0; iter < 2 * order + 10; iter++) {
+        if (rnorm <= tolerance)
+            return true;
+
+        multiply(p, q);
+        double pq = 0.0;
+        for (unsigned i = 0; i < order; i++)
+            pq += p[i] * q[i];
+        if (!(pq > 0))
+            return false;
+
+        double alpha = rz / pq;
+        double rz_next = 0.0;
+        rnorm = 0.0;
+        for (unsigned i = 0; i < order; i++) {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * q[i];
+            z[i] = r[i] / d[i];
+            rnorm += r[i] * r[i];
+            rz_next += r[i] * z[i];
+        }
+
+        double beta = rz_next / rz;
+        rz = rz_next;
+        for (unsigned i = 0; i < order; i++)
+            p[i] = z[i] + beta * p[i];
+    }
+
+    return rnorm <= tolerance;
+}
+
+void
+SparseLinearSystem::solveDense()
+{
+    unsigned order = rows.size();
+    if (order == 0)
+        return;
+
+    LinearSystem ls(order);
+    for (unsigned i = 0; i < order; i++) {
+        for (auto & c: rows[i])
+            ls[i][c.first] += c.second;
+        ls[i][ls[i].cnt()] = constants[i];
+    }
+    solution = ls.solve();
+}
@@ -43,6 +43,7 @@
 #include <cassert>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 /**
@@ -131,4 +132,74 @@ class LinearSystem {
     std::vector < LinearEquation > matrix;
 };
 
+/**
+ * A linear system in which each equation only has a few of the unknowns,
+ * like the nodal equations of a thermal RC network. The equations are
+ * built again before every solve, but usually only their constant terms
+ * change. The matrix is therefore factorized once and the factorization is
+ * reused for as long as the coefficients stay the same. Solves after the
+ * coefficients change are iterative, starting from the last solution,
+ * until the coefficients are stable again.
+ *
+ * The factorization and the iterative solver need a symmetric definite
+ * matrix, as given by networks of resistors and capacitors. Other systems
+ * are solved with the dense LinearSystem.
+ */
+class SparseLinearSystem {
+  public:
+    SparseLinearSystem(unsigned unknowns);
+
+    // Remove all terms, keeping the last solution and the factorization
+    void clear();
+
+    // Add to the coefficient of an unknown in an equation
+    void add(unsigned eq, unsigned unkw, double value);
+
+    // Add to the constant term of an equation
+    void addConstant(unsigned eq, double value) {
+        assert(eq < constants.size());
+        constants[eq] += value;
+    }
+
+    unsigned unknowns() const { return rows.size(); }
+
+    // Solve the system, the result is valid until the next solve
+    const std::vector <double> & solve();
+
+  private:
+    /** The coefficients of an equation as pairs of unknown and value */
+    typedef std::vector < std::pair <unsigned, double> > Row;
+
+    bool isSymmetric() const;
+    bool factorize();
+    void solveFactorized();
+    bool solveIterative();
+    void solveDense();
+
+    std::vector <Row> rows;
+    std::vector <double> constants;
+    std::vector <double> solution;
+    bool solved;
+
+    /** The coefficients of the last solve that didn't use the factors */
+    std::vector <Row> lastRows;
+
+    /**
+     * The factorization P A P' = L D L' of the coefficients in factorRows,
+     * where P is a reverse Cuthill-McKee ordering that keeps the non-zero
+     * elements of A close to the diagonal. The rows of L are stored from
+     * their first non-zero element up to the diagonal, which is the only
+     * part of them that the factorization fills.
+     */
+    std::vector <Row> factorRows;
+    bool factorized;
+    /** The unknown in each position of the ordering */
+    std::vector <unsigned> perm;
+    /** The first column and the offset in lower of each row of L */
+    std::vector <unsigned> first;
+    std::vector <size_t> offset;
+    std::vector <double> lower;
+    std::vector <double> diag;
+};
+
 #endif
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Tests of the sparse linear solver against the dense one, on systems like
+ * the nodal equations of thermal RC networks.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "sim/linear_solver.hh"
+
+namespace {
+
+/**
+ * The equations of a chain of nodes, each one connected to the next by a
+ * conductance g and to a fixed temperature by a conductance h. Node i
+ * receives power[i].
+ */
+void
+buildChain(SparseLinearSystem &sls, LinearSystem &ls, double g, double h,
+           const std::vector<double> &power, double ref)
+{
+    unsigned n = power.size();
+    sls.clear();
+    for (unsigned i = 0; i < n; i++) {
+        // Each node is connected to the previous one, and the first and
+        // the last nodes are connected to each other
+        unsigned j = (i + 1) % n;
+        for (auto k : {i, j}) {
+            double sign = k == i ? 1.0 : -1.0;
+            sls.add(k, i, -sign * g);
+            sls.add(k, j, sign * g);
+            ls[k][i] += -sign * g;
+            ls[k][j] += sign * g;
+        }
+        sls.add(i, i, -h);
+        sls.addConstant(i, h * ref + power[i]);
+        ls[i][i] += -h;
+        ls[i][ls[i].cnt()] += h * ref + power[i];
+    }
+}
+
+void
+expectNear(const std::vector<double> &a, const std::vector<double> &b)
+{
+    ASSERT_EQ(a.size(), b.size());
+    for (unsigned i = 0; i < a.size(); i++)
+        EXPECT_NEAR(a[i], b[i], 1e-9 * std::max(1.0, std::fabs(b[i])));
+}
+
+} // anonymous namespace
+
+// The factorization gives the same solution as Gauss elimination, and it
+// is reused when only the constant terms change
+TEST(SparseLinearSystemTest, MatchesDense)
+{
+    const unsigned n = 40;
+    SparseLinearSystem sls(n);
+    std::vector<double> power(n);
+
+    for (unsigned step = 0; step < 3; step++) {
+        for (unsigned i = 0; i < n; i++)
+            power[i] = std::sin(i + step) + 1.0;
+        LinearSystem ls(n);
+        buildChain(sls, ls, 2.0, 0.1, power, 25.0);
+        expectNear(sls.solve(), ls.solve());
+    }
+}
+
+// Solves after the coefficients change are iterative, and give the same
+// solution as Gauss elimination too
+TEST(SparseLinearSystemTest, ChangingCoefficients)
+{
+    const unsigned n = 25;
+    SparseLinearSystem sls(n);
+    std::vector<double> power(n, 1.0);
+
+    for (unsigned step = 0; step < 6; step++) {
+        // The same conductances in steps 2 and 3, then different ones
+        double g = step == 3 ? 3.0 : 1.0 + step;
+        LinearSystem ls(n);
+        buildChain(sls, ls, g, 0.5, power, 40.0);
+        expectNear(sls.solve(), ls.solve());
+    }
+}
+
+// Systems that aren't symmetric are still solved
+TEST(SparseLinearSystemTest, NonSymmetric)
+{
+    SparseLinearSystem sls(3);
+    LinearSystem ls(3);
+    double coeffs[3][3] = {{4, 1, 0}, {2, 5, 1}, {0, 3, 6}};
+    for (unsigned i = 0; i < 3; i++) {
+        for (unsigned j = 0; j < 3; j++) {
+            if (coeffs[i][j] != 0) {
+                sls.add(i, j, coeffs[i][j]);
+                ls[i][j] = coeffs[i][j];
+            }
+        }
+        sls.addConstant(i, i + 1.0);
+        ls[i][ls[i].cnt()] = i + 1.0;
+    }
+    expectNear(sls.solve(), ls.solve());
+}
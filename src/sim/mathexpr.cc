@@ -40,6 +40,7 @@
 #include "sim/mathexpr.hh"
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <regex>
 #include <string>
@@ -176,3 +177,108 @@ MathExpr::toStr(Node *n, std::string prefix) const {
     return ret;
 }
 
+
+bool
+MathExpr::hasVariables(const Node *n)
+{
+    if (!n)
+        return false;
+    return n->op == sVariable || hasVariables(n->l) || hasVariables(n->r);
+}
+
+bool
+MathExpr::compile(Compiled &compiled, BindCallback fn) const
+{
+    compiled = Compiled();
+    std::vector<std::string> names;
+    unsigned depth = compile(root, compiled, fn, names);
+    if (!depth) {
+        compiled = Compiled();
+        return false;
+    }
+    compiled.stack.resize(depth);
+    return true;
+}
+
+unsigned
+MathExpr::compile(const Node *n, Compiled &c, BindCallback &fn,
+                  std::vector<std::string> &names) const
+{
+    if (!hasVariables(n)) {
+        c.code.push_back(Compiled::Inst{sValue, eval(n, nullptr), 0});
+        return 1;
+    }
+
+    if (n->op == sVariable) {
+        // Bind each variable once, even if it appears several times
+        auto it = std::find(names.begin(), names.end(), n->variable);
+        unsigned var = it - names.begin();
+        if (it == names.end()) {
+            Binding binding;
+            if (!fn(n->variable, binding))
+                return 0;
+            names.push_back(n->variable);
+            c.vars.push_back(binding);
+        }
+        c.code.push_back(Compiled::Inst{sVariable, 0, var});
+        return 1;
+    }
+
+    // Operands go on the stack left to right, so the left one is deeper
+    unsigned l = 0;
+    if (n->l) {
+        l = compile(n->l, c, fn, names);
+        if (!l)
+            return 0;
+    }
+    unsigned r = compile(n->r, c, fn, names);
+    if (!r)
+        return 0;
+    c.code.push_back(Compiled::Inst{n->op, 0, 0});
+    return std::max(l, r + (n->l ? 1 : 0));
+}
+
+double
+MathExpr::Compiled::eval() const
+{
+    assert(valid());
+
+    // The next free element of the stack
+    double *sp = stack.data();
+    for (auto & i : code) {
+        switch (i.op) {
+          case sValue:
+            *sp++ = i.value;
+            break;
+          case sVariable:
+            *sp++ = vars[i.var]();
+            break;
+          case uNeg:
+            sp[-1] = -sp[-1];
+            break;
+          case bAdd:
+            --sp;
+            sp[-1] += sp[0];
+            break;
+          case bSub:
+            --sp;
+            sp[-1] -= sp[0];
+            break;
+          case bMul:
+            --sp;
+            sp[-1] *= sp[0];
+            break;
+          case bDiv:
+            --sp;
+            sp[-1] /= sp[0];
+            break;
+          case bPow:
+            --sp;
+            sp[-1] = std::pow(sp[-1], sp[0]);
+            break;
+          default:
+            panic("Invalid instruction!\n");
+        }
+    }
+    return stack[0];
+}
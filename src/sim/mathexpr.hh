@@ -44,6 +44,7 @@
 #include <array>
 #include <functional>
 #include <string>
+#include <vector>
 
 class MathExpr {
   public:
@@ -73,6 +74,67 @@ class MathExpr {
         bAdd, bSub, bMul, bDiv, bPow, uNeg, sValue, sVariable, nInvalid
     };
 
+  public:
+    /** A function that returns the current value of a variable */
+    typedef std::function<double()> Binding;
+
+    /**
+     * Looks up a variable by name, returns false if there is no such
+     * variable.
+     */
+    typedef std::function<bool(const std::string &, Binding &)>
+        BindCallback;
+
+    /**
+     * An expression compiled into a sequence of operations on a stack,
+     * with its variables bound once at compile time. Evaluating it
+     * neither walks the expression tree nor looks variables up by name.
+     */
+    class Compiled {
+      public:
+        Compiled() {}
+
+        /** Whether the expression has been compiled */
+        bool valid() const { return !code.empty(); }
+
+        /**
+         * Evaluates the expression with the current values of its
+         * variables
+         *
+         * @return The value for this expression
+         */
+        double eval() const;
+
+      private:
+        friend class MathExpr;
+
+        struct Inst {
+            Operator op;
+            /** The constant of sValue or the variable of sVariable */
+            double value;
+            unsigned var;
+        };
+
+        std::vector<Inst> code;
+        std::vector<Binding> vars;
+
+        /** Storage for the stack, big enough for the deepest point */
+        mutable std::vector<double> stack;
+    };
+
+    /**
+     * Compiles the expression. Sub-expressions without variables are
+     * replaced by their value.
+     *
+     * @param compiled The compiled expression
+     * @param fn A callback function to bind variables
+     *
+     * @return False if a variable could not be bound
+     */
+    bool compile(Compiled &compiled, BindCallback fn) const;
+
+  private:
+
     // Match operators
     const int MAX_PRIO = 4;
     typedef double (*binOp)(double, double);
@@ -121,6 +183,16 @@ class MathExpr {
 
     /** Eval a node */
     double eval(const Node *n, EvalCallback fn) const;
+
+    /** Whether a node or its children have variables */
+    static bool hasVariables(const Node *n);
+
+    /**
+     * Compile a node, returns the stack depth it needs, or 0 if a
+     * variable could not be bound
+     */
+    unsigned compile(const Node *n, Compiled &c, BindCallback &fn,
+                     std::vector<std::string> &names) const;
 };
 
 #endif
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Tests of compiled math expressions against the evaluation of their
+ * expression trees.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include "sim/mathexpr.hh"
+
+namespace {
+
+std::map<std::string, double> vars = {
+    {"a", 2.0}, {"b.c", 3.0}, {"temp", 50.0},
+};
+
+bool
+bind(const std::string &name, MathExpr::Binding &binding)
+{
+    auto it = vars.find(name);
+    if (it == vars.end())
+        return false;
+    const double *value = &it->second;
+    binding = [value]() { return *value; };
+    return true;
+}
+
+double
+lookup(std::string name)
+{
+    return vars.at(name);
+}
+
+} // anonymous namespace
+
+TEST(MathExprTest, CompiledMatchesTree)
+{
+    const char *exprs[] = {
+        "1 + 2 * 3", "a * b.c + a", "-a ^ 2", "(a - b.c) / (temp + 1) * 2^3",
+        "a - b.c - temp", "-(a + 1) * -b.c", "temp", "0.5 * temp ^ 1.5 + a",
+    };
+
+    for (auto e : exprs) {
+        MathExpr expr(e);
+        MathExpr::Compiled compiled;
+        ASSERT_TRUE(expr.compile(compiled, bind)) << e;
+        EXPECT_DOUBLE_EQ(expr.eval(lookup), compiled.eval()) << e;
+    }
+}
+
+// Variables are read when the expression is evaluated, not compiled
+TEST(MathExprTest, BindingsFollowValues)
+{
+    MathExpr expr("temp * 2 + a");
+    MathExpr::Compiled compiled;
+    ASSERT_TRUE(expr.compile(compiled, bind));
+    EXPECT_DOUBLE_EQ(102.0, compiled.eval());
+
+    vars["temp"] = 60.0;
+    EXPECT_DOUBLE_EQ(122.0, compiled.eval());
+    vars["temp"] = 50.0;
+}
+
+TEST(MathExprTest, UnboundVariable)
+{
+    MathExpr expr("a + unknown");
+    MathExpr::Compiled compiled;
+    EXPECT_FALSE(expr.compile(compiled, bind));
+    EXPECT_FALSE(compiled.valid());
+}
@@ -48,7 +48,7 @@
 #include "sim/sim_object.hh"
 
 MathExprPowerModel::MathExprPowerModel(const Params *p)
-    : PowerModelState(p), dyn_expr(p->dyn), st_expr(p->st), failed(false)
+    : PowerModelState(p), dyn_expr(p->dyn), st_expr(p->st)
 {
     // Calculate the name of the object we belong to
     std::vector<std::string> path;
@@ -74,11 +74,12 @@ MathExprPowerModel::startup()
         }
     }
 
-    tryEval(st_expr);
-    const bool st_failed = failed;
-
-    tryEval(dyn_expr);
-    const bool dyn_failed = failed;
+    // Bind the variables once, evaluating the expressions then doesn't
+    // need to look them up
+    auto bind = std::bind(&MathExprPowerModel::bindVariable, this,
+                          std::placeholders::_1, std::placeholders::_2);
+    const bool st_failed = !st_expr.compile(st_compiled, bind);
+    const bool dyn_failed = !dyn_expr.compile(dyn_compiled, bind);
 
     if (st_failed || dyn_failed) {
         const auto *p = dynamic_cast<const Params *>(params());
@@ -92,61 +93,60 @@ MathExprPowerModel::startup()
 }
 
 double
-MathExprPowerModel::eval(const MathExpr &expr) const
+MathExprPowerModel::eval(const MathExpr::Compiled &expr) const
 {
-    const double value = tryEval(expr);
-
-    // This shouldn't happen unless something went wrong the equations
-    // were verified in startup().
-    panic_if(failed, "Failed to evaluate power expression '%s'\n",
-             expr.toStr());
+    // The expressions are compiled, and verified, in startup()
+    panic_if(!expr.valid(), "Power expression evaluated before startup\n");
 
-    return value;
+    return expr.eval();
 }
 
 double
-MathExprPowerModel::tryEval(const MathExpr &expr) const
+MathExprPowerModel::getStatValue(const std::string &name) const
 {
-    failed = false;
-    const double value = expr.eval(
-        std::bind(&MathExprPowerModel::getStatValue,
-                  this, std::placeholders::_1)
-        );
-
-    return value;
+    MathExpr::Binding binding;
+    if (!bindVariable(name, binding))
+        return 0;
+    return binding();
 }
 
-
-double
-MathExprPowerModel::getStatValue(const std::string &name) const
+bool
+MathExprPowerModel::bindVariable(const std::string &name,
+                                 MathExpr::Binding &binding) const
 {
     using namespace Stats;
 
     // Automatic variables:
     if (name == "temp") {
-        return _temp;
+        binding = [this]() { return _temp; };
+        return true;
     } else if (name == "voltage") {
-        return clocked_object->voltage();
+        binding = [this]() { return clocked_object->voltage(); };
+        return true;
     } else if (name=="clock_period") {
-        return clocked_object->clockPeriod();
-    } 
+        binding = [this]() { return clocked_object->clockPeriod(); };
+        return true;
+    }
 
     // Try to cast the stat, only these are supported right now
     const auto it = stats_map.find(name);
     if (it == stats_map.cend()) {
         warn("Failed to find stat '%s'\n", name);
-        failed = true;
-        return 0;
+        return false;
     }
 
     const Info *info = it->second;
 
     auto si = dynamic_cast<const ScalarInfo *>(info);
-    if (si)
-        return si->value();
+    if (si) {
+        binding = [si]() { return si->value(); };
+        return true;
+    }
     auto fi = dynamic_cast<const FormulaInfo *>(info);
-    if (fi)
-        return fi->total();
+    if (fi) {
+        binding = [fi]() { return fi->total(); };
+        return true;
+    }
 
     panic("Unknown stat type!\n");
 }
@@ -66,14 +66,14 @@ class MathExprPowerModel : public PowerModelState
      *
      * @return Power (Watts) consumed by this object (dynamic component)
      */
-    double getDynamicPower() const { return eval(dyn_expr); }
+    double getDynamicPower() const { return eval(dyn_compiled); }
 
     /**
      * Get the static power consumption.
      *
      * @return Power (Watts) consumed by this object (static component)
      */
-    double getStaticPower() const { return eval(st_expr); }
+    double getStaticPower() const { return eval(st_compiled); }
 
     /**
      * Get the value for a variable (maps to a stat)
@@ -84,41 +84,43 @@ class MathExprPowerModel : public PowerModelState
      */
     double getStatValue(const std::string & name) const;
 
+    /**
+     * Bind a variable to the automatic variable or stat it maps to
+     *
+     * @param name Name of the variable
+     * @param binding Set to a function that returns its value
+     *
+     * @return False if there is no such variable
+     */
+    bool bindVariable(const std::string &name,
+                      MathExpr::Binding &binding) const;
+
     void startup();
 
     void regStats();
 
   private:
     /**
-     * Evaluate an expression in the context of this object, fatal if
-     * evaluation fails.
+     * Evaluate a compiled expression, panic if the expressions haven't
+     * been compiled yet.
      *
      * @param expr Expression to evaluate
      * @return Value of expression.
      */
-    double eval(const MathExpr &expr) const;
-
-    /**
-     * Evaluate an expression in the context of this object, set
-     * failed if evaluation failed.
-     *
-     * @param expr Expression to evaluate
-     * @return Value of expression.
-     */
-    double tryEval(const MathExpr &expr) const;
+    double eval(const MathExpr::Compiled &expr) const;
 
     // Math expressions for dynamic and static power
     MathExpr dyn_expr, st_expr;
 
+    // The expressions compiled in startup(), with their variables bound
+    // to the stats they map to
+    MathExpr::Compiled dyn_compiled, st_compiled;
+
     // Basename of the object in the gem5 stats hierachy
     std::string basename;
 
     // Map that contains relevant stats for this power model
     std::unordered_map<std::string, Stats::Info*> stats_map;
-
-    // Did the expression fail to evaluate (e.g., because a stat value
-    // can't be resolved)
-    mutable bool failed;
 };
 
 #endif
@@ -151,3 +151,39 @@ PowerModel::getStaticPower() const
 
     return power;
 }
+
+void
+PowerModel::getPower(double &dynamic, double &stat) const
+{
+    assert(clocked_object);
+
+    dynamic = 0;
+    stat = 0;
+
+    // Get the state weights once for both components
+    std::vector<double> w = clocked_object->pwrStateWeights();
+
+    // Same number of states (excluding UNDEFINED)
+    assert(w.size() - 1 == states_pm.size());
+
+    // Make sure we have no UNDEFINED state
+    warn_if(w[Enums::PwrState::UNDEFINED] > 0,
+        "SimObject in UNDEFINED power state! Power figures might be wrong!\n");
+
+    for (unsigned i = 0; i < states_pm.size(); i++) {
+        // Don't evaluate power if the object hasn't been in that state
+        if (w[i + 1] <= 0.0f)
+            continue;
+
+        if (power_model_type == Enums::PMType::All) {
+            double state_dynamic, state_static;
+            states_pm[i]->getPower(state_dynamic, state_static);
+            dynamic += state_dynamic * w[i + 1];
+            stat += state_static * w[i + 1];
+        } else if (power_model_type == Enums::PMType::Static) {
+            stat += states_pm[i]->getStaticPower() * w[i + 1];
+        } else {
+            dynamic += states_pm[i]->getDynamicPower() * w[i + 1];
+        }
+    }
+}
@@ -74,6 +74,17 @@ class PowerModelState : public SimObject
      */
     virtual double getStaticPower() const = 0;
 
+    /**
+     * Get the dynamic and the static power consumption at once.
+     *
+     * @param dynamic Set to the dynamic power (Watts)
+     * @param stat Set to the static power (Watts)
+     */
+    virtual void getPower(double &dynamic, double &stat) const {
+        dynamic = getDynamicPower();
+        stat = getStaticPower();
+    }
+
     /**
      * Temperature update.
      *
@@ -136,6 +147,15 @@ class PowerModel : public SimObject
      */
     double getStaticPower() const;
 
+    /**
+     * Get the dynamic and the static power consumption in one pass over
+     * the power states.
+     *
+     * @param dynamic Set to the dynamic power (Watts)
+     * @param stat Set to the static power (Watts)
+     */
+    void getPower(double &dynamic, double &stat) const;
+
     void regStats() {
         dynamicPower
           .method(this, &PowerModel::getDynamicPower)
@@ -109,12 +109,12 @@ ThermalDomain::unserialize(CheckpointIn &cp)
 }
 
 
-LinearEquation
-ThermalDomain::getEquation(ThermalNode * tn, unsigned n, double step) const
+void
+ThermalDomain::addEquations(SparseLinearSystem &ls, double step) const
 {
-    LinearEquation eq(n);
-    double power = subsystem->getDynamicPower() + subsystem->getStaticPower();
-    if (tn == node)
-        eq[eq.cnt()] = power;
-    return eq;
+    if (node->isref)
+        return;
+    double dynamic, stat;
+    subsystem->getPower(dynamic, stat);
+    ls.addConstant(node->id, dynamic + stat);
 }
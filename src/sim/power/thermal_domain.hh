@@ -81,9 +81,8 @@ class ThermalDomain : public SimObject, public ThermalEntity
     void setNode(ThermalNode * n) { node = n; }
     ThermalNode * getNode() const { return node; }
 
-    /** Get nodal equation imposed by this node */
-    LinearEquation getEquation(ThermalNode * tn, unsigned n,
-                               double step) const override;
+    /** Add the power of the domain to the equation of its node */
+    void addEquations(SparseLinearSystem &ls, double step) const override;
 
     /**
       *  Emit a temperature update through probe points interface
@@ -42,8 +42,7 @@
 
 #include "sim/sim_object.hh"
 
-class LinearEquation;
-class ThermalNode;
+class SparseLinearSystem;
 
 /**
  * An abstract class that represents any thermal entity which is used
@@ -53,9 +52,10 @@ class ThermalNode;
 class ThermalEntity
 {
   public:
-    // Get the equation given a node and a step in seconds (assuming N nodes)
-    virtual LinearEquation getEquation(ThermalNode *tn, unsigned n,
-                                       double step) const = 0;
+    // Add the terms of this entity to the nodal equations of the nodes it
+    // connects, given a step in seconds
+    virtual void addEquations(SparseLinearSystem &ls,
+                              double step) const = 0;
 };
 
 
@@ -48,6 +48,20 @@
 #include "sim/power/thermal_domain.hh"
 #include "sim/sim_object.hh"
 
+/**
+ * Add coeff times the temperature of node n to equation eq, to its constant
+ * term if the temperature of the node is fixed.
+ */
+static void
+addTerm(SparseLinearSystem &ls, unsigned eq, const ThermalNode *n,
+        double coeff)
+{
+    if (n->isref)
+        ls.addConstant(eq, coeff * n->temp);
+    else
+        ls.add(eq, n->id, coeff);
+}
+
 /**
  * ThermalReference
  */
@@ -74,11 +88,10 @@ ThermalReference::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(_temperature);
 }
 
-LinearEquation
-ThermalReference::getEquation(ThermalNode * n, unsigned nnodes,
-                              double step) const {
-    // Just return an empty equation
-    return LinearEquation(nnodes);
+void
+ThermalReference::addEquations(SparseLinearSystem &ls, double step) const
+{
+    // The temperature of the node is fixed, there is nothing to add
 }
 
 /**
@@ -107,31 +120,17 @@ ThermalResistor::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(_resistance);
 }
 
-LinearEquation
-ThermalResistor::getEquation(ThermalNode * n, unsigned nnodes,
-                             double step) const
+void
+ThermalResistor::addEquations(SparseLinearSystem &ls, double step) const
 {
-    // i[n] = (Vn2 - Vn1)/R
-    LinearEquation eq(nnodes);
-
-    if (n != node1 && n != node2)
-        return eq;
-
-    if (node1->isref)
-        eq[eq.cnt()] += -node1->temp / _resistance;
-    else
-        eq[node1->id] += -1.0f / _resistance;
-
-    if (node2->isref)
-        eq[eq.cnt()] += node2->temp / _resistance;
-    else
-        eq[node2->id] += 1.0f / _resistance;
-
-    // We've assumed n was node1, reverse if necessary
-    if (n == node2)
-        eq *= -1.0f;
-
-    return eq;
+    // i[n1] = (Vn2 - Vn1)/R, and the same current leaves n2
+    for (auto n : {node1, node2}) {
+        if (n->isref)
+            continue;
+        double sign = n == node1 ? 1.0 : -1.0;
+        addTerm(ls, n->id, node1, -sign / _resistance);
+        addTerm(ls, n->id, node2, sign / _resistance);
+    }
 }
 
 /**
@@ -160,41 +159,28 @@ ThermalCapacitor::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(_capacitance);
 }
 
-LinearEquation
-ThermalCapacitor::getEquation(ThermalNode * n, unsigned nnodes,
-                              double step) const
+void
+ThermalCapacitor::addEquations(SparseLinearSystem &ls, double step) const
 {
     // i(t) = C * d(Vn2 - Vn1)/dt
-    // i[n] = C/step * (Vn2 - Vn1 - Vn2[n-1] + Vn1[n-1])
-    LinearEquation eq(nnodes);
-
-    if (n != node1 && n != node2)
-        return eq;
-
-    eq[eq.cnt()] += _capacitance / step * (node1->temp - node2->temp);
-
-    if (node1->isref)
-        eq[eq.cnt()] += _capacitance / step * (-node1->temp);
-    else
-        eq[node1->id] += -1.0f * _capacitance / step;
-
-    if (node2->isref)
-        eq[eq.cnt()] += _capacitance / step * (node2->temp);
-    else
-        eq[node2->id] += 1.0f * _capacitance / step;
-
-    // We've assumed n was node1, reverse if necessary
-    if (n == node2)
-        eq *= -1.0f;
-
-    return eq;
+    // i[n1] = C/step * (Vn2 - Vn1 - Vn2[n-1] + Vn1[n-1])
+    double g = _capacitance / step;
+    for (auto n : {node1, node2}) {
+        if (n->isref)
+            continue;
+        double sign = n == node1 ? 1.0 : -1.0;
+        ls.addConstant(n->id, sign * g * (node1->temp - node2->temp));
+        addTerm(ls, n->id, node1, -sign * g);
+        addTerm(ls, n->id, node2, sign * g);
+    }
 }
 
 /**
  * ThermalModel
  */
 ThermalModel::ThermalModel(const Params *p)
-    : ClockedObject(p), stepEvent([this]{ doStep(); }, name()), _step(p->step)
+    : ClockedObject(p), system(0),
+      stepEvent([this]{ doStep(); }, name()), _step(p->step)
 {
 }
 
@@ -220,20 +206,14 @@ void
 ThermalModel::doStep()
 {
     // Calculate new temperatures!
-    // For each node in the system, create the kirchhoff nodal equation
-    LinearSystem ls(eq_nodes.size());
-    for (unsigned i = 0; i < eq_nodes.size(); i++) {
-        auto n = eq_nodes[i];
-        LinearEquation node_equation (eq_nodes.size());
-        for (auto e : entities) {
-            LinearEquation eq = e->getEquation(n, eq_nodes.size(), _step);
-            node_equation = node_equation + eq;
-        }
-        ls[i] = node_equation;
-    }
+    // Create the kirchhoff nodal equations, each entity adds its terms to
+    // the equations of the nodes it connects
+    system.clear();
+    for (auto e : entities)
+        e->addEquations(system, _step);
 
     // Get temperatures for this iteration
-    std::vector <double> temps = ls.solve();
+    const std::vector <double> &temps = system.solve();
     for (unsigned i = 0; i < eq_nodes.size(); i++)
         eq_nodes[i]->temp = temps[i];
 
@@ -273,6 +253,7 @@ ThermalModel::startup()
     // Assign each node an ID
     for (unsigned i = 0; i < eq_nodes.size(); i++)
         eq_nodes[i]->id = i;
+    system = SparseLinearSystem(eq_nodes.size());
 
     // Schedule first thermal update
     schedule(stepEvent, curTick() + SimClock::Int::s * _step);
@@ -51,10 +51,12 @@
 #include <sys/time.h>
 #include <sys/types.h>
 
+#include <atomic>
 #include <cerrno>
 #include <fstream>
 #include <list>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base/inifile.hh"
@@ -74,7 +76,16 @@ using namespace std;
 int Serializable::ckptMaxCount = 0;
 int Serializable::ckptCount = 0;
 int Serializable::ckptPrevCount = -1;
-std::stack<std::string> Serializable::path;
+bool Serializable::ckptBinary = false;
+unsigned Serializable::ckptRestoreThreads = 1;
+thread_local std::stack<std::string> Serializable::path;
+
+namespace {
+
+/** Whether the current thread runs parallel restore tasks */
+thread_local bool inRestoreTask = false;
+
+} // anonymous namespace
 
 /////////////////////////////
 
@@ -194,6 +205,17 @@ Serializable::serializeAll(const string &cpt_dir)
             fatal("couldn't mkdir %s\n", dir);
 
     string cpt_file = dir + CheckpointIn::baseFilename;
+    if (ckptBinary) {
+        BinaryCheckpoint::Writer writer;
+        if (!writer.open(cpt_file))
+            fatal("Unable to open file %s for writing\n", cpt_file.c_str());
+
+        globals.serializeSection(writer, "Globals");
+        SimObject::serializeAll(writer);
+        writer.close();
+        return;
+    }
+
     ofstream outstream(cpt_file.c_str());
     time_t t = time(NULL);
     if (!outstream.is_open())
@@ -214,6 +236,52 @@ Serializable::unserializeGlobals(CheckpointIn &cp)
         mainEventQueue[i]->setCurTick(globals.unserializedCurTick);
 }
 
+void
+Serializable::parallelRestore(size_t num_tasks,
+                              const std::function<void(size_t)> &task)
+{
+    const size_t num_threads =
+        std::min<size_t>(ckptRestoreThreads, num_tasks);
+    if (num_threads <= 1 || inRestoreTask) {
+        for (size_t i = 0; i < num_tasks; ++i)
+            task(i);
+        return;
+    }
+
+    // In parallel mode, events that are scheduled on a queue other than
+    // the current one are queued by asyncInsert()
+    const bool was_parallel = inParallelMode;
+    inParallelMode = true;
+
+    std::atomic<size_t> next_task(0);
+    auto worker = [&](unsigned id) {
+        // curTick() is the tick of the current queue, so give the thread
+        // a queue of its own at the restored tick
+        EventQueue queue(csprintf("restore%d", id));
+        queue.setCurTick(mainEventQueue[0]->getCurTick());
+        curEventQueue(&queue);
+        inRestoreTask = true;
+
+        for (size_t i = next_task++; i < num_tasks; i = next_task++)
+            task(i);
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned id = 0; id < num_threads; ++id)
+        threads.emplace_back(worker, id);
+    for (auto &thread : threads)
+        thread.join();
+
+    inParallelMode = was_parallel;
+
+    EventQueue *current = curEventQueue();
+    for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+        curEventQueue(mainEventQueue[i]);
+        mainEventQueue[i]->handleAsyncInsertions();
+    }
+    curEventQueue(current);
+}
+
 Serializable::ScopedCheckpointSection::~ScopedCheckpointSection()
 {
     assert(!path.empty());
@@ -237,7 +305,10 @@ Serializable::ScopedCheckpointSection::nameOut(CheckpointOut &cp)
 {
     DPRINTF(Checkpoint, "ScopedCheckpointSection::nameOut: %s\n",
             Serializable::currentSection());
-    cp << "\n[" << Serializable::currentSection() << "]\n";
+    if (BinaryCheckpoint::Writer *writer = BinaryCheckpoint::Writer::from(cp))
+        writer->section(Serializable::currentSection());
+    else
+        cp << "\n[" << Serializable::currentSection() << "]\n";
 }
 
 const std::string &
@@ -271,38 +342,65 @@ CheckpointIn::dir()
 }
 
 CheckpointIn::CheckpointIn(const string &cpt_dir, SimObjectResolver &resolver)
-    : db(new IniFile), objNameResolver(resolver), cptDir(setDir(cpt_dir))
+    : db(new IniFile), binary(nullptr), objNameResolver(resolver),
+      cptDir(setDir(cpt_dir))
 {
     string filename = cptDir + "/" + CheckpointIn::baseFilename;
-    if (!db->load(filename)) {
+    if (BinaryCheckpoint::Reader::isBinary(filename)) {
+        binary = new BinaryCheckpoint::Reader;
+        if (!binary->load(filename, *db))
+            fatal("Can't load binary checkpoint file '%s'\n", filename);
+    } else if (!db->load(filename)) {
         fatal("Can't load checkpoint file '%s'\n", filename);
     }
 }
 
 CheckpointIn::~CheckpointIn()
 {
+    delete binary;
     delete db;
 }
 
 bool
 CheckpointIn::entryExists(const string &section, const string &entry)
 {
-    return db->entryExists(section, entry);
+    std::lock_guard<std::mutex> lock(lookupMutex);
+    return (binary && binary->find(section, entry)) ||
+        db->entryExists(section, entry);
 }
 
 bool
 CheckpointIn::find(const string &section, const string &entry, string &value)
 {
+    std::lock_guard<std::mutex> lock(lookupMutex);
+    if (binary) {
+        if (const BinaryCheckpoint::Entry *e = binary->find(section, entry)) {
+            value = e->str();
+            return true;
+        }
+    }
     return db->find(section, entry, value);
 }
 
+const BinaryCheckpoint::Entry *
+CheckpointIn::findTyped(const string &section, const string &entry)
+{
+    if (!binary)
+        return nullptr;
+
+    // The entry stays valid after the lookup
+    std::lock_guard<std::mutex> lock(lookupMutex);
+    const BinaryCheckpoint::Entry *e = binary->find(section, entry);
+    return e && e->type != BinaryCheckpoint::Text ? e : nullptr;
+}
+
 bool
 CheckpointIn::findObj(const string &section, const string &entry,
                     SimObject *&value)
 {
     string path;
 
-    if (!db->find(section, entry, path))
+    if (!find(section, entry, path))
         return false;
 
     value = objNameResolver.resolveSimObject(path);
@@ -312,7 +410,9 @@ CheckpointIn::findObj(const string &section, const string &entry,
 bool
 CheckpointIn::sectionExists(const string &section)
 {
-    return db->sectionExists(section);
+    std::lock_guard<std::mutex> lock(lookupMutex);
+    return (binary && binary->sectionExists(section)) ||
+        db->sectionExists(section);
 }
 
 void
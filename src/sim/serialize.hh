@@ -52,9 +52,12 @@
 
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <list>
 #include <map>
+#include <mutex>
 #include <stack>
 #include <set>
 #include <vector>
@@ -62,6 +65,7 @@
 #include "base/bitunion.hh"
 #include "base/logging.hh"
 #include "base/str.hh"
+#include "sim/binary_checkpoint.hh"
 
 class IniFile;
 class SimObject;
@@ -75,6 +79,12 @@ class CheckpointIn
 
     IniFile *db;
 
+    /** The binary checkpoint, nullptr if the checkpoint is an ini file */
+    BinaryCheckpoint::Reader *binary;
+
+    /** Serializes lookups of objects that are restored in parallel */
+    std::mutex lookupMutex;
+
     SimObjectResolver &objNameResolver;
 
   public:
@@ -86,6 +96,13 @@ class CheckpointIn
     bool find(const std::string &section, const std::string &entry,
               std::string &value);
 
+    /**
+     * Find an entry that a binary checkpoint stores in binary. Returns
+     * nullptr for ini checkpoints and entries that are stored as text.
+     */
+    const BinaryCheckpoint::Entry *findTyped(const std::string &section,
+                                             const std::string &entry);
+
     bool findObj(const std::string &section, const std::string &entry,
                  SimObject *&value);
 
@@ -260,11 +277,31 @@ class Serializable
     static int ckptCount;
     static int ckptMaxCount;
     static int ckptPrevCount;
+    /** Write checkpoints in the binary format, see binary_checkpoint.hh */
+    static bool ckptBinary;
+    /** Number of threads that restore checkpoints */
+    static unsigned ckptRestoreThreads;
     static void serializeAll(const std::string &cpt_dir);
     static void unserializeGlobals(CheckpointIn &cp);
 
+    /**
+     * Run independent checkpoint restore tasks on up to
+     * ckptRestoreThreads threads. Tasks can read the checkpoint and
+     * schedule events, which are inserted into their queues once all
+     * tasks are done, but must not deschedule or reschedule events.
+     * Tasks start outside of any checkpoint section, and run one after
+     * the other if there is a single thread or if this is called from a
+     * task.
+     *
+     * @param num_tasks Number of tasks
+     * @param task Function that runs a task, given its index
+     */
+    static void parallelRestore(size_t num_tasks,
+                                const std::function<void(size_t)> &task);
+
   private:
-    static std::stack<std::string> path;
+    /** The active sections, every thread that restores has its own */
+    static thread_local std::stack<std::string> path;
 };
 
 //
@@ -369,10 +406,79 @@ parseParam(const std::string &s, std::string &value)
     return true;
 }
 
+//
+// Binary checkpoints store integer, floating point and bool values (see
+// BinaryCheckpoint::IsTyped) in binary, and other values as the text
+// that showParam() prints.
+//
+template <class InputIt>
+void
+binaryParamOut(BinaryCheckpoint::Writer &cp, const std::string &name,
+               InputIt begin, InputIt end, uint64_t count, std::true_type)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    cp.putValues<T>(name, begin, end, count);
+}
+
+template <class InputIt>
+void
+binaryParamOut(BinaryCheckpoint::Writer &cp, const std::string &name,
+               InputIt begin, InputIt end, uint64_t count, std::false_type)
+{
+    std::ostringstream os;
+    for (InputIt it = begin; it != end; ++it) {
+        if (it != begin)
+            os << " ";
+        showParam(os, *it);
+    }
+    cp.putText(name, os.str());
+}
+
+template <class InputIt>
+void
+binaryParamOut(BinaryCheckpoint::Writer &cp, const std::string &name,
+               InputIt begin, InputIt end, uint64_t count)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    binaryParamOut(cp, name, begin, end, count,
+                   BinaryCheckpoint::IsTyped<T>());
+}
+
+template <class T>
+const BinaryCheckpoint::Entry *
+typedEntry(CheckpointIn &cp, const std::string &section,
+           const std::string &name)
+{
+    return BinaryCheckpoint::IsTyped<T>::value ?
+        cp.findTyped(section, name) : nullptr;
+}
+
+template <class T>
+bool
+findParam(CheckpointIn &cp, const std::string &section,
+          const std::string &name, T &param)
+{
+    if (const BinaryCheckpoint::Entry *entry =
+            typedEntry<T>(cp, section, name)) {
+        if (entry->count != 1)
+            return false;
+        entry->get<T>(&param);
+        return true;
+    }
+
+    std::string str;
+    return cp.find(section, name, str) && parseParam(str, param);
+}
+
 template <class T>
 void
 paramOut(CheckpointOut &os, const std::string &name, const T &param)
 {
+    if (BinaryCheckpoint::Writer *cp = BinaryCheckpoint::Writer::from(os)) {
+        binaryParamOut(*cp, name, &param, &param + 1, 1);
+        return;
+    }
+
     os << name << "=";
     showParam(os, param);
     os << "\n";
@@ -383,8 +489,7 @@ void
 paramIn(CheckpointIn &cp, const std::string &name, T &param)
 {
     const std::string &section(Serializable::currentSection());
-    std::string str;
-    if (!cp.find(section, name, str) || !parseParam(str, param)) {
+    if (!findParam(cp, section, name, param)) {
         fatal("Can't unserialize '%s:%s'\n", section, name);
     }
 }
@@ -395,8 +500,7 @@ optParamIn(CheckpointIn &cp, const std::string &name,
            T &param, bool warn = true)
 {
     const std::string &section(Serializable::currentSection());
-    std::string str;
-    if (!cp.find(section, name, str) || !parseParam(str, param)) {
+    if (!findParam(cp, section, name, param)) {
         if (warn)
             warn("optional parameter %s:%s not present\n", section, name);
         return false;
@@ -410,6 +514,11 @@ void
 arrayParamOut(CheckpointOut &os, const std::string &name,
               const std::vector<T> &param)
 {
+    if (BinaryCheckpoint::Writer *cp = BinaryCheckpoint::Writer::from(os)) {
+        binaryParamOut(*cp, name, param.begin(), param.end(), param.size());
+        return;
+    }
+
     typename std::vector<T>::size_type size = param.size();
     os << name << "=";
     if (size > 0)
@@ -426,6 +535,11 @@ void
 arrayParamOut(CheckpointOut &os, const std::string &name,
               const std::list<T> &param)
 {
+    if (BinaryCheckpoint::Writer *cp = BinaryCheckpoint::Writer::from(os)) {
+        binaryParamOut(*cp, name, param.begin(), param.end(), param.size());
+        return;
+    }
+
     typename std::list<T>::const_iterator it = param.begin();
 
     os << name << "=";
@@ -445,6 +559,11 @@ void
 arrayParamOut(CheckpointOut &os, const std::string &name,
               const std::set<T> &param)
 {
+    if (BinaryCheckpoint::Writer *cp = BinaryCheckpoint::Writer::from(os)) {
+        binaryParamOut(*cp, name, param.begin(), param.end(), param.size());
+        return;
+    }
+
     typename std::set<T>::const_iterator it = param.begin();
 
     os << name << "=";
@@ -464,6 +583,11 @@ void
 arrayParamOut(CheckpointOut &os, const std::string &name,
               const T *param, unsigned size)
 {
+    if (BinaryCheckpoint::Writer *cp = BinaryCheckpoint::Writer::from(os)) {
+        binaryParamOut(*cp, name, param, param + size, size);
+        return;
+    }
+
     os << name << "=";
     if (size > 0)
         showParam(os, param[0]);
@@ -481,6 +605,14 @@ arrayParamIn(CheckpointIn &cp, const std::string &name,
              T *param, unsigned size)
 {
     const std::string &section(Serializable::currentSection());
+    if (const BinaryCheckpoint::Entry *entry =
+            typedEntry<T>(cp, section, name)) {
+        if (entry->count != size)
+            fatal("Array size mismatch on %s:%s'\n", section, name);
+        entry->get<T>(param);
+        return;
+    }
+
     std::string str;
     if (!cp.find(section, name, str)) {
         fatal("Can't unserialize '%s:%s'\n", section, name);
@@ -525,6 +657,13 @@ void
 arrayParamIn(CheckpointIn &cp, const std::string &name, std::vector<T> &param)
 {
     const std::string &section(Serializable::currentSection());
+    if (const BinaryCheckpoint::Entry *entry =
+            typedEntry<T>(cp, section, name)) {
+        param.resize(entry->count);
+        entry->get<T>(param.begin());
+        return;
+    }
+
     std::string str;
     if (!cp.find(section, name, str)) {
         fatal("Can't unserialize '%s:%s'\n", section, name);
@@ -567,6 +706,13 @@ void
 arrayParamIn(CheckpointIn &cp, const std::string &name, std::list<T> &param)
 {
     const std::string &section(Serializable::currentSection());
+    if (const BinaryCheckpoint::Entry *entry =
+            typedEntry<T>(cp, section, name)) {
+        param.clear();
+        entry->get<T>(std::back_inserter(param));
+        return;
+    }
+
     std::string str;
     if (!cp.find(section, name, str)) {
         fatal("Can't unserialize '%s:%s'\n", section, name);
@@ -597,6 +743,13 @@ void
 arrayParamIn(CheckpointIn &cp, const std::string &name, std::set<T> &param)
 {
     const std::string &section(Serializable::currentSection());
+    if (const BinaryCheckpoint::Entry *entry =
+            typedEntry<T>(cp, section, name)) {
+        param.clear();
+        entry->get<T>(std::inserter(param, param.end()));
+        return;
+    }
+
     std::string str;
     if (!cp.find(section, name, str)) {
         fatal("Can't unserialize '%s:%s'\n", section, name);
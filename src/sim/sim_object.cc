@@ -150,6 +150,34 @@ SimObject::serializeAll(CheckpointOut &cp)
    }
 }
 
+//
+// static function: restore SimObjects, the independent ones in parallel.
+//
+void
+SimObject::loadStateAll(CheckpointIn &cp, const vector<SimObject *> &objects)
+{
+    vector<SimObject *> parallel;
+    for (auto *obj : objects) {
+        if (ckptRestoreThreads > 1 && obj->parallelLoadState())
+            parallel.push_back(obj);
+        else
+            obj->loadState(cp);
+    }
+
+    parallelRestore(parallel.size(), [&](size_t i) {
+        parallel[i]->loadState(cp);
+    });
+}
+
+//
+// static function: reset the stats of all SimObjects.
+//
+void
+SimObject::resetAllStats()
+{
+    for (auto *obj : simObjectList)
+        obj->resetStats();
+}
 
 #ifdef DEBUG
 //
@@ -137,6 +137,15 @@ class SimObject : public EventManager, public Serializable, public Drainable
      */
     virtual void loadState(CheckpointIn &cp);
 
+    /**
+     * Whether loadState() of this object can run in parallel with that
+     * of other objects when checkpoints are restored with several
+     * threads (see loadStateAll()). The loadState() of such objects
+     * must only change their own state, and may schedule but not
+     * deschedule or reschedule events.
+     */
+    virtual bool parallelLoadState() const { return false; }
+
     /**
      * initState() is called on each SimObject when *not* restoring
      * from a checkpoint.  This provides a hook for state
@@ -214,6 +223,22 @@ class SimObject : public EventManager, public Serializable, public Drainable
      */
     static void serializeAll(CheckpointOut &cp);
 
+    /**
+     * Call loadState() on SimObjects. Objects whose loadState() isn't
+     * parallel are restored first, in order, and then the others on
+     * Serializable::ckptRestoreThreads threads.
+     *
+     * @param cp Checkpoint to restore the state from.
+     * @param objects Objects to restore, in order.
+     */
+    static void loadStateAll(CheckpointIn &cp,
+                             const std::vector<SimObject *> &objects);
+
+    /**
+     * Call resetStats() on all SimObjects in the system.
+     */
+    static void resetAllStats();
+
 #ifdef DEBUG
   public:
     bool doDebugBreak;
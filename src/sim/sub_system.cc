@@ -69,6 +69,19 @@ SubSystem::getStaticPower() const
     return ret;
 }
 
+void
+SubSystem::getPower(double &dynamic, double &stat) const
+{
+    dynamic = 0.0f;
+    stat = 0.0f;
+    for (auto &obj: powerProducers) {
+        double obj_dynamic, obj_static;
+        obj->getPower(obj_dynamic, obj_static);
+        dynamic += obj_dynamic;
+        stat += obj_static;
+    }
+}
+
 SubSystem *
 SubSystemParams::create()
 {
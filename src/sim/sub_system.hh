@@ -66,6 +66,9 @@ class SubSystem : public SimObject
 
     double getStaticPower() const;
 
+    /** Get the dynamic and the static power of all power models at once */
+    void getPower(double &dynamic, double &stat) const;
+
     void registerPowerProducer(PowerModel *pm) {
         powerProducers.push_back(pm);
     }
@@ -70,6 +70,7 @@
 #include "sim/byteswap.hh"
 #include "sim/debug.hh"
 #include "sim/full_system.hh"
+#include "sim/sim_exit.hh"
 
 /**
  * To avoid linking errors with LTO, only include the header if we
@@ -90,6 +91,7 @@ int System::numSystemsRunning = 0;
 System::System(Params *p)
     : MemObject(p), _systemPort("system_port", this),
       multiThread(p->multi_thread),
+      exitOnAccelInvocation(p->exit_on_accel_invocation),
       pagePtr(0),
       init_param(p->init_param),
       physProxy(_systemPort, p->cache_line_size),
@@ -193,6 +195,14 @@ System::System(Params *p)
         }
     }
 
+    if (p->accel_alias_codes.size() != p->accel_alias_ids.size())
+        fatal("accel_alias_codes and accel_alias_ids of %s differ in size.\n",
+              name());
+    for (int i = 0; i < p->accel_alias_codes.size(); i++) {
+        acceleratorAliases.add(p->accel_alias_codes[i],
+                               p->accel_alias_ids[i]);
+    }
+
     // increment the number of running systems
     numSystemsRunning++;
 
@@ -232,6 +242,46 @@ System::setMemoryMode(Enums::MemoryMode mode)
     memoryMode = mode;
 }
 
+void
+System::activateAccelerator(
+        unsigned accel_id, Addr finish_flag, int context_id, int thread_id)
+{
+    if (exitOnAccelInvocation) {
+        DPRINTF(Aladdin, "Holding back accelerator id %d\n", accel_id);
+        pendingActivations.push_back(
+            PendingActivation{accel_id, finish_flag, context_id, thread_id});
+        // Invocations at the same time are held back with the first one
+        if (pendingActivations.size() == 1)
+            exitSimLoop("accelerator invocation");
+        return;
+    }
+
+    int id = invokedAcceleratorId(accel_id);
+    DPRINTF(Aladdin, "Activating accelerator id %d\n", id);
+    setAcceleratorFinishFlag(id, finish_flag);
+    setAcceleratorIds(id, context_id, thread_id);
+    scheduleAccelerator(id, 1);
+}
+
+void
+System::selectAccelerator(int id, int accel_id)
+{
+    if (!acceleratorAliases.select(id, accel_id))
+        fatal("Accelerator %#x doesn't stand in for request code %#x.\n",
+              accel_id, id);
+}
+
+void
+System::startPendingAccelerators()
+{
+    exitOnAccelInvocation = false;
+    std::vector<PendingActivation> pending;
+    pending.swap(pendingActivations);
+    for (const auto &p : pending)
+        activateAccelerator(p.accel_id, p.finish_flag, p.context_id,
+                            p.thread_id);
+}
+
 bool System::breakpoint()
 {
     if (remoteGDB.size())
@@ -406,6 +456,18 @@ System::isMemAddr(Addr addr) const
     return physmem.isMemAddr(addr);
 }
 
+DrainState
+System::drain()
+{
+    // Sort the symbol tables before the simulator may be forked, so that
+    // forked simulators share them rather than each sorting a copy.
+    if (kernelSymtab)
+        kernelSymtab->buildIndices();
+    if (debugSymbolTable)
+        debugSymbolTable->buildIndices();
+    return DrainState::Drained;
+}
+
 void
 System::drainResume()
 {
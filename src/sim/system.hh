@@ -63,6 +63,7 @@
 #include "mem/port.hh"
 #include "mem/port_proxy.hh"
 #include "params/System.hh"
+#include "sim/accel_aliases.hh"
 #include "sim/futex_map.hh"
 #include "sim/se_signal.hh"
 
@@ -234,6 +235,42 @@ class System : public MemObject
      */
     std::map<int, AccelData*> accelerators;
 
+    /* The accelerators that stand in for each IOCTL request code. Array
+     * mappings are added to all of them until selectAccelerator() picks the
+     * one that runs.
+     */
+    AcceleratorAliases acceleratorAliases;
+
+    /* Exit from the simulation loop the first time an accelerator is
+     * invoked, and hold back invocations until startPendingAccelerators().
+     */
+    bool exitOnAccelInvocation;
+
+    /* An invocation that is held back until startPendingAccelerators(). */
+    struct PendingActivation {
+        unsigned accel_id;
+        Addr finish_flag;
+        int context_id;
+        int thread_id;
+    };
+    std::vector<PendingActivation> pendingActivations;
+
+    /* Returns the ids of the accelerators that a request code stands for. */
+    std::vector<int> acceleratorIds(int id) const
+    {
+        return acceleratorAliases.ids(id);
+    }
+
+    /* Returns the id of the one accelerator that a request code invokes. */
+    int invokedAcceleratorId(int id) const
+    {
+        std::vector<int> ids = acceleratorIds(id);
+        if (ids.size() != 1)
+            fatal("Accelerator %#x has %d variants and none was selected.",
+                  id, ids.size());
+        return ids[0];
+    }
+
     /* Returns the number of accelerators that are currently registered and
      * running in the system.
      */
@@ -296,36 +333,49 @@ class System : public MemObject
         DPRINTF(Aladdin, "Scheduling accelerator %d\n", id);
     }
 
-    /* Activates an accelerator with the provided parameters. */
+    /* Activates the accelerator that a request code invokes with the
+     * provided parameters, or holds it back and exits from the simulation
+     * loop if exitOnAccelInvocation is set.
+     */
     void activateAccelerator(
-            unsigned accel_id, Addr finish_flag, int context_id, int thread_id) {
-        DPRINTF(Aladdin, "Activating accelerator id %d\n", accel_id);
-        setAcceleratorFinishFlag(accel_id, finish_flag);
-        setAcceleratorIds(accel_id, context_id, thread_id);
-        scheduleAccelerator(accel_id, 1);
-    }
+            unsigned accel_id, Addr finish_flag, int context_id, int thread_id);
+
+    /* Makes a request code invoke one of the accelerators that stand in
+     * for it.
+     */
+    void selectAccelerator(int id, int accel_id);
+
+    /* Activates the invocations that were held back when exiting from the
+     * simulation loop, and any later ones right away.
+     */
+    void startPendingAccelerators();
 
     /* Add an address tranlation into the datapath TLB for the specified array. */
     void insertAddressTranslationMapping(int id, Addr sim_vaddr, Addr sim_paddr) {
-        if (accelerators.find(id) == accelerators.end())
-            fatal("Unable to add address mapping: No accelerator with id %#x.",
-                  id);
-        Gem5Datapath* datapath = accelerators[id]->datapath;
-        datapath->insertTLBEntry(sim_vaddr, sim_paddr);
+        for (int accel_id : acceleratorIds(id)) {
+            if (accelerators.find(accel_id) == accelerators.end())
+                fatal("Unable to add address mapping: No accelerator with "
+                      "id %#x.", accel_id);
+            Gem5Datapath* datapath = accelerators[accel_id]->datapath;
+            datapath->insertTLBEntry(sim_vaddr, sim_paddr);
+        }
     }
 
     /* Add an mapping between array names to the simulated virtual addresses. */
     void insertArrayLabelMapping(int id, std::string array_label,
                                  Addr sim_vaddr, size_t size) {
-        if (accelerators.find(id) == accelerators.end())
-            fatal("Unable to add array label mapping: No accelerator with id %#x.",
-                  id);
-        Gem5Datapath *datapath = accelerators[id]->datapath;
-      datapath->insertArrayLabelToVirtual(array_label, sim_vaddr, size);
+        for (int accel_id : acceleratorIds(id)) {
+            if (accelerators.find(accel_id) == accelerators.end())
+                fatal("Unable to add array label mapping: No accelerator "
+                      "with id %#x.", accel_id);
+            Gem5Datapath *datapath = accelerators[accel_id]->datapath;
+            datapath->insertArrayLabelToVirtual(array_label, sim_vaddr, size);
+        }
     }
 
     /* Get the base trace address of of the array for the specified accelerator. */
     Addr getArrayBaseAddress(int id, const char* array_name) {
+        id = acceleratorIds(id).front();
         if (accelerators.find(id) == accelerators.end())
             fatal("Unable to get array base address: No accelerator with id %#x.",
                   id);
@@ -725,6 +775,7 @@ class System : public MemObject
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
 
+    DrainState drain() override;
     void drainResume() override;
 
   public:
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include "cpu/simple/block_cache.hh"
+#include "unittest/unittest.hh"
+
+using UnitTest::setCase;
+
+namespace {
+
+/** An instruction that only has flags, or the micro-ops of a macro-op */
+class FakeInst : public StaticInst
+{
+  public:
+    FakeInst(std::vector<StaticInstPtr> microops=std::vector<StaticInstPtr>())
+        : StaticInst("fake", TheISA::ExtMachInst(), No_OpClass),
+          microops(microops)
+    {
+        if (!microops.empty()) {
+            flags[IsMacroop] = true;
+            static_cast<FakeInst *>(microops.back().get())->set(
+                IsLastMicroop);
+        }
+    }
+
+    FakeInst *
+    set(Flags flag)
+    {
+        flags[flag] = true;
+        return this;
+    }
+
+    Fault
+    execute(ExecContext *xc, Trace::InstRecord *traceData) const override
+    {
+        return NoFault;
+    }
+
+    void
+    advancePC(TheISA::PCState &pc) const override
+    {
+        pc.advance();
+    }
+
+    StaticInstPtr
+    fetchMicroop(MicroPC upc) const override
+    {
+        return microops.at(upc);
+    }
+
+    std::string
+    generateDisassembly(Addr pc, const SymbolTable *symtab) const override
+    {
+        return mnemonic;
+    }
+
+  private:
+    std::vector<StaticInstPtr> microops;
+};
+
+const Addr page = TheISA::PageBytes;
+const Addr instBytes = 4;
+const uint64_t context = 1;
+
+TheISA::PCState
+pcAt(Addr addr)
+{
+    TheISA::PCState pc(addr);
+    pc.npc(addr + instBytes);
+    return pc;
+}
+
+/**
+ * Drives a BlockCache like the atomic CPU does for a run of instructions,
+ * where the virtual and physical addresses are the same. The stats of a
+ * block cache can't be unregistered, so it is never deleted.
+ */
+class Runner
+{
+  public:
+    Runner() : cache(*new BlockCache(1024)) {}
+
+    /**
+     * Execute an instruction at addr, decoding it if the block cache
+     * doesn't have it.
+     *
+     * @return Whether the instruction came from the block cache.
+     */
+    bool
+    execute(Addr addr, const StaticInstPtr &inst, bool in_page=true)
+    {
+        TheISA::PCState pc = pcAt(addr);
+        if (cache.next(pc, context))
+            return true;
+        if (const BlockCache::Inst *cached = cache.enter(addr, pc, context)) {
+            EXPECT_TRUE(inst == cached->staticInst);
+            return true;
+        }
+        cache.record(pc, pc, inst, in_page);
+        return false;
+    }
+
+    /** Execute straight-line code at addr, and return how many of its
+     * instructions came from the block cache. */
+    int
+    run(Addr addr, const std::vector<StaticInstPtr> &insts)
+    {
+        int cached = 0;
+        for (const StaticInstPtr &inst : insts) {
+            cached += execute(addr, inst);
+            addr += instBytes;
+        }
+        return cached;
+    }
+
+    BlockCache &cache;
+};
+
+StaticInstPtr
+plain()
+{
+    return new FakeInst;
+}
+
+StaticInstPtr
+control()
+{
+    return (new FakeInst)->set(StaticInst::IsControl);
+}
+
+void
+testRecordsThenHits()
+{
+    setCase("RecordsThenHits");
+    Runner r;
+    std::vector<StaticInstPtr> insts = { plain(), plain(), control() };
+    EXPECT_EQ(0, r.run(page, insts));
+    EXPECT_EQ(3, r.run(page, insts));
+    EXPECT_EQ(1, r.cache.hits.value());
+    EXPECT_EQ(1, r.cache.misses.value());
+}
+
+void
+testEndsAtControl()
+{
+    setCase("EndsAtControl");
+    Runner r;
+    StaticInstPtr branch = control();
+    std::vector<StaticInstPtr> insts = { plain(), branch, plain(), plain() };
+    EXPECT_EQ(0, r.run(page, insts));
+
+    // The instructions after the branch are a block of their own
+    EXPECT_EQ(4, r.run(page, insts));
+    EXPECT_EQ(2, r.cache.hits.value());
+    EXPECT_EQ(2, r.cache.misses.value());
+
+    // The first block isn't followed past the branch, even if the next
+    // instruction is at the following address
+    EXPECT_TRUE(r.execute(page, insts[0]));
+    EXPECT_TRUE(r.execute(page + instBytes, branch));
+    EXPECT_TRUE(!r.cache.next(pcAt(page + 2 * instBytes), context));
+}
+
+void
+testEndsAtSerializingAndSyscall()
+{
+    setCase("EndsAtSerializingAndSyscall");
+    Runner r;
+    std::vector<StaticInstPtr> insts = {
+        plain(), (new FakeInst)->set(StaticInst::IsSerializing),
+        plain(), (new FakeInst)->set(StaticInst::IsSyscall),
+        plain(), (new FakeInst)->set(StaticInst::IsNonSpeculative),
+    };
+    EXPECT_EQ(0, r.run(page, insts));
+    EXPECT_EQ(3, r.cache.misses.value());
+}
+
+void
+testEndsAtMacroopWithControlMicroop()
+{
+    setCase("EndsAtMacroopWithControlMicroop");
+    Runner r;
+    StaticInstPtr macroop = new FakeInst({ plain(), control(), plain() });
+    std::vector<StaticInstPtr> insts = { plain(), macroop, plain() };
+    EXPECT_EQ(0, r.run(page, insts));
+    EXPECT_EQ(2, r.cache.misses.value());
+
+    StaticInstPtr plain_macroop = new FakeInst({ plain(), plain() });
+    insts = { plain(), plain_macroop, plain(), control() };
+    EXPECT_EQ(0, r.run(2 * page, insts));
+    EXPECT_EQ(3, r.cache.misses.value());
+    EXPECT_EQ(4, r.run(2 * page, insts));
+}
+
+void
+testEndsAtPageEnd()
+{
+    setCase("EndsAtPageEnd");
+    Runner r;
+    Addr addr = 2 * page - instBytes;
+    EXPECT_FALSE(r.execute(addr - instBytes, plain()));
+    EXPECT_FALSE(r.execute(addr, plain()));
+    // Continues in the next page, so a new block starts there
+    EXPECT_FALSE(r.execute(addr + instBytes, control()));
+    EXPECT_EQ(2, r.cache.misses.value());
+
+    // An instruction whose bytes cross into the next page isn't added
+    EXPECT_FALSE(r.execute(3 * page - instBytes, plain(), false));
+    EXPECT_FALSE(r.execute(3 * page - instBytes, plain()));
+    EXPECT_EQ(4, r.cache.misses.value());
+}
+
+void
+testLeavesOnOtherPC()
+{
+    setCase("LeavesOnOtherPC");
+    Runner r;
+    std::vector<StaticInstPtr> insts = { plain(), plain(), control() };
+    r.run(page, insts);
+
+    // E.g. an interrupt after the first instruction
+    EXPECT_TRUE(r.execute(page, insts[0]));
+    EXPECT_TRUE(!r.cache.next(pcAt(4 * page), context));
+    EXPECT_TRUE(!r.cache.next(pcAt(page + instBytes), context));
+}
+
+void
+testRecordsAgainInOtherContext()
+{
+    setCase("RecordsAgainInOtherContext");
+    Runner r;
+    std::vector<StaticInstPtr> insts = { plain(), control() };
+    r.run(page, insts);
+    TheISA::PCState pc = pcAt(page);
+    EXPECT_TRUE(nullptr == r.cache.enter(page, pc, context + 1));
+    EXPECT_EQ(2, r.cache.misses.value());
+}
+
+void
+testInvalidatesWrittenPage()
+{
+    setCase("InvalidatesWrittenPage");
+    Runner r;
+    std::vector<StaticInstPtr> insts = { plain(), plain(), control() };
+    r.run(page, insts);
+    r.run(3 * page, insts);
+
+    // Writes to other pages don't drop the blocks
+    r.cache.invalidate(2 * page, page);
+    r.cache.invalidate(page - 8, 8);
+    EXPECT_EQ(0, r.cache.invalidations.value());
+    EXPECT_EQ(3, r.run(page, insts));
+
+    // A write that straddles a page boundary drops the blocks of both
+    r.cache.invalidate(page + page - 2, 4);
+    EXPECT_EQ(1, r.cache.invalidations.value());
+    EXPECT_EQ(0, r.run(page, insts));
+    r.cache.invalidate(2 * page - 2, page + 4);
+    EXPECT_EQ(3, r.cache.invalidations.value());
+    EXPECT_EQ(0, r.run(3 * page, insts));
+}
+
+void
+testInvalidatesCurrentBlock()
+{
+    setCase("InvalidatesCurrentBlock");
+    Runner r;
+    std::vector<StaticInstPtr> insts = { plain(), plain(), control() };
+    r.run(page, insts);
+
+    // Self-modifying code writes the block that is executing
+    EXPECT_TRUE(r.execute(page, insts[0]));
+    r.cache.invalidate(page + instBytes, instBytes);
+    EXPECT_TRUE(!r.cache.next(pcAt(page + instBytes), context));
+    EXPECT_EQ(0, r.run(page, insts));
+    EXPECT_EQ(3, r.run(page, insts));
+}
+
+void
+testFlushesWhenFull()
+{
+    setCase("FlushesWhenFull");
+    BlockCache &small = *new BlockCache(2);
+    TheISA::PCState pc = pcAt(page);
+    StaticInstPtr branch = control();
+    EXPECT_TRUE(nullptr == small.enter(page, pc, context));
+    small.record(pc, pc, plain(), true);
+    small.record(pcAt(page + instBytes), pcAt(page + instBytes), branch,
+                 true);
+
+    // Full, so recording another block drops the first one
+    TheISA::PCState other = pcAt(2 * page);
+    EXPECT_TRUE(nullptr == small.enter(2 * page, other, context));
+    small.record(other, other, branch, true);
+    EXPECT_TRUE(nullptr == small.enter(page, pc, context));
+    EXPECT_EQ(3, small.misses.value());
+}
+} // anonymous namespace
+
+int
+main()
+{
+    testRecordsThenHits();
+    testEndsAtControl();
+    testEndsAtSerializingAndSyscall();
+    testEndsAtMacroopWithControlMicroop();
+    testEndsAtPageEnd();
+    testLeavesOnOtherPC();
+    testRecordsAgainInOtherContext();
+    testInvalidatesWrittenPage();
+    testInvalidatesCurrentBlock();
+    testFlushesWhenFull();
+
+    return UnitTest::printResults();
+}
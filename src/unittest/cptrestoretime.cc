@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Time restoring a large array from a binary and from an ini checkpoint.
+ */
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/inifile.hh"
+#include "base/str.hh"
+#include "sim/binary_checkpoint.hh"
+
+using namespace std;
+using namespace BinaryCheckpoint;
+
+namespace {
+
+string
+tempFile()
+{
+    char path[] = "/tmp/cptrestoretimeXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0)
+        return string();
+    ::close(fd);
+    return path;
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    const size_t num_values = 1 << 20;
+    vector<uint64_t> values(num_values);
+    for (size_t i = 0; i < num_values; ++i)
+        values[i] = i * 0x9e3779b97f4a7c15ULL;
+
+    const string binary_path = tempFile();
+    const string ini_path = tempFile();
+    if (binary_path.empty() || ini_path.empty()) {
+        cprintf("Can't create a temporary checkpoint\n");
+        return 1;
+    }
+
+    {
+        Writer writer;
+        if (!writer.open(binary_path)) {
+            cprintf("Can't write %s\n", binary_path);
+            return 1;
+        }
+        writer.section("mem");
+        writer.putValues<uint64_t>("data", values.begin(), values.end(),
+                                   values.size());
+    }
+
+    {
+        ofstream f(ini_path);
+        f << "[mem]\ndata=";
+        for (size_t i = 0; i < num_values; ++i)
+            f << (i ? " " : "") << values[i];
+        f << "\n";
+    }
+
+    bool ok = true;
+
+    auto start = chrono::steady_clock::now();
+    {
+        Reader reader;
+        IniFile ini;
+        vector<uint64_t> restored(num_values);
+        const Entry *entry = nullptr;
+        if (reader.load(binary_path, ini))
+            entry = reader.find("mem", "data");
+        if (entry)
+            entry->get<uint64_t>(restored.begin());
+        ok = ok && entry && restored == values;
+    }
+    chrono::duration<double> binary_secs =
+        chrono::steady_clock::now() - start;
+
+    start = chrono::steady_clock::now();
+    {
+        IniFile ini;
+        string str;
+        vector<string> tokens;
+        if (ini.load(ini_path) && ini.find("mem", "data", str))
+            tokenize(tokens, str, ' ');
+        vector<uint64_t> restored(tokens.size());
+        for (size_t i = 0; i < tokens.size(); ++i)
+            ok = to_number(tokens[i], restored[i]) && ok;
+        ok = ok && restored == values;
+    }
+    chrono::duration<double> ini_secs = chrono::steady_clock::now() - start;
+
+    unlink(binary_path.c_str());
+    unlink(ini_path.c_str());
+
+    if (!ok) {
+        cprintf("Restored values don't match\n");
+        return 1;
+    }
+
+    cprintf("%d values restored in %f s from a binary checkpoint, "
+            "%f s from an ini checkpoint\n",
+            num_values, binary_secs.count(), ini_secs.count());
+
+    return 0;
+}
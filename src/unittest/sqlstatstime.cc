@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 The gem5-Aladdin Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Throughput of the SQLite stats output for many small dumps, with the
+ * value tables indexed as the stats are written and with the indexes
+ * deferred until the database is closed.
+ */
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/statistics.hh"
+#include "base/stats/sql.hh"
+
+using namespace std;
+using namespace Stats;
+
+#ifdef ENABLE_SQLITE_STATS_OUTPUT
+
+/** The Info of a stat, of the type that the outputs visit */
+template <class Stat>
+const typename Stat::Info &
+infoOf(const Stat &stat)
+{
+    return *stat.info();
+}
+
+int
+main()
+{
+    const int num_scalars = 200;
+    const int num_vectors = 50;
+    const int num_dumps = 200;
+
+    // Never destroyed, like all stats
+    vector<Scalar *> scalars;
+    for (int i = 0; i < num_scalars; ++i) {
+        scalars.push_back(new Scalar);
+        scalars.back()->name("bench.scalar" + to_string(i));
+    }
+    vector<Vector *> vectors;
+    for (int i = 0; i < num_vectors; ++i) {
+        vectors.push_back(new Vector);
+        vectors.back()->init(8).name("bench.vector" + to_string(i));
+    }
+
+    char path[] = "/tmp/sqlstatstimeXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        cprintf("Can't create a temporary database\n");
+        return 1;
+    }
+    ::close(fd);
+
+    for (bool defer : { false, true }) {
+        OutputSQL sql(path, defer);
+        auto start = chrono::steady_clock::now();
+        for (int dump = 0; dump < num_dumps; ++dump) {
+            sql.begin();
+            for (auto *scalar : scalars) {
+                *scalar += dump;
+                sql.visit(infoOf(*scalar));
+            }
+            for (auto *vector : vectors)
+                sql.visit(infoOf(*vector));
+            sql.end();
+        }
+        sql.close();
+        chrono::duration<double> secs = chrono::steady_clock::now() - start;
+
+        cprintf("%s: %d rows in %f s, %f rows/s\n",
+                defer ? "Deferred indexes" : "Indexes", sql.rows(),
+                secs.count(), sql.rows() / secs.count());
+    }
+
+    for (const char *suffix : { "", "-wal", "-shm" })
+        unlink((string(path) + suffix).c_str());
+
+    return 0;
+}
+
+#else
+
+int
+main()
+{
+    cprintf("gem5 was built without SQLite stats output\n");
+    return 0;
+}
+
+#endif // ENABLE_SQLITE_STATS_OUTPUT
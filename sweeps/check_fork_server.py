@@ -0,0 +1,196 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Smoke test of the fork server: simulates one design point of a
+# fork_server.sh both with its run.sh and through the fork server, and checks
+# that the two runs write the same outputs.
+#
+# The fork server is run on a copy of its points file that only lists the
+# design point, so the point's datapaths are named <accel>_datapath0 instead
+# of <accel>_datapath. The stats of the fork server's parent up to the fork
+# belong in front of the ones of its child. The outputs of the point are put
+# back afterwards.
+
+from __future__ import print_function
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+STATS_BEGIN = "---------- Begin Simulation Statistics ----------"
+STATS_END = "---------- End Simulation Statistics   ----------"
+
+# Outputs that hold host times, paths or the command line.
+IGNORED_OUTPUTS = ["stdout", "stderr", "config.ini", "config.json",
+                   "stats.db", "stats.txt"]
+
+def readStatsDumps(path):
+  """ The stats of each dump in a stats.txt file, by name. Stats of the host
+  are left out. """
+  dumps = []
+  if not os.path.exists(path):
+    return dumps
+  with open(path) as f:
+    for line in f:
+      line = line.strip()
+      if line == STATS_BEGIN:
+        dumps.append({})
+      elif line and line != STATS_END and not line.startswith("#"):
+        fields = line.split()
+        if not fields[0].startswith("host_"):
+          dumps[-1][fields[0]] = fields[1]
+  return dumps
+
+def renameDatapaths(text):
+  """ Names the datapaths of the fork server's only design point like run.sh
+  does. """
+  return re.sub(r"(_datapath)0\b", r"\1", text)
+
+def compareStats(run_sh_dumps, fork_dumps):
+  errors = []
+  if len(run_sh_dumps) != len(fork_dumps):
+    errors.append("run.sh dumped the stats %d times but the fork server %d "
+                  "times" % (len(run_sh_dumps), len(fork_dumps)))
+  for i, (expected, actual) in enumerate(zip(run_sh_dumps, fork_dumps)):
+    actual = dict((renameDatapaths(name), value)
+                  for name, value in actual.items())
+    for name in sorted(set(expected) | set(actual)):
+      if expected.get(name) != actual.get(name):
+        errors.append("dump %d: %s is %s with run.sh but %s with the fork "
+                      "server" % (i, name, expected.get(name),
+                                  actual.get(name)))
+  return errors
+
+def compareOutputs(run_sh_dir, fork_dir):
+  """ Compares the outputs other than gem5's own, such as Aladdin's. """
+  errors = []
+  for root, dirs, files in os.walk(run_sh_dir):
+    for name in sorted(files):
+      expected_path = os.path.join(root, name)
+      rel_path = os.path.relpath(expected_path, run_sh_dir)
+      if rel_path in IGNORED_OUTPUTS:
+        continue
+      actual_path = os.path.join(fork_dir, rel_path)
+      if not os.path.exists(actual_path):
+        errors.append("The fork server didn't write %s" % rel_path)
+        continue
+      with open(expected_path) as f:
+        expected = f.read()
+      with open(actual_path) as f:
+        actual = renameDatapaths(f.read())
+      if expected != actual:
+        errors.append("%s differs" % rel_path)
+  return errors
+
+def runScript(script, cwd):
+  print("Running %s" % script)
+  sys.stdout.flush()
+  code = subprocess.call(["/bin/sh", script], cwd=cwd)
+  if code != 0:
+    raise RuntimeError("%s failed with exit code %d" % (script, code))
+
+def main():
+  parser = argparse.ArgumentParser(
+      description="Check that a fork server writes the same outputs as "
+      "run.sh for one of its design points.")
+  parser.add_argument("fork_server", help="The fork_server.sh script.")
+  parser.add_argument("--point", type=int, default=0,
+                      help="Index of the design point in the points file "
+                      "[Default: %(default)s].")
+  args = parser.parse_args()
+
+  with open(args.fork_server) as f:
+    script = f.read()
+  match = re.search(r"--accel-sweep=(\S+)", script)
+  if not match:
+    sys.exit("%s doesn't have --accel-sweep" % args.fork_server)
+  with open(match.group(1)) as f:
+    cfg_paths = [line.strip() for line in f
+                 if line.strip() and not line.startswith("#")]
+  cfg_path = cfg_paths[args.point]
+  sweep_dir = os.path.dirname(os.path.abspath(cfg_path))
+  outputs = os.path.join(sweep_dir, "outputs")
+
+  tmp_dir = tempfile.mkdtemp(prefix="check_fork_server.")
+  saved_outputs = os.path.join(tmp_dir, "saved_outputs")
+  run_sh_outputs = os.path.join(tmp_dir, "run_sh")
+  fork_outputs = os.path.join(tmp_dir, "fork_server")
+  if os.path.exists(outputs):
+    shutil.move(outputs, saved_outputs)
+
+  try:
+    os.makedirs(outputs)
+    runScript(os.path.join(sweep_dir, "run.sh"), sweep_dir)
+    shutil.move(outputs, run_sh_outputs)
+
+    points_path = os.path.join(tmp_dir, "fork_server.points")
+    with open(points_path, "w") as f:
+      f.write(cfg_path + "\n")
+    parent_dir = os.path.join(tmp_dir, "parent")
+    script = script.replace(match.group(0), "--accel-sweep=" + points_path)
+    script = re.sub(r"--outdir=\S+", "--outdir=" + parent_dir, script)
+    script = re.sub(r"> (\S+)\.stdout",
+                    "> " + os.path.join(tmp_dir, "fork_server.stdout"), script)
+    script = re.sub(r"2> (\S+)\.stderr",
+                    "2> " + os.path.join(tmp_dir, "fork_server.stderr"),
+                    script)
+    fork_server = os.path.join(tmp_dir, "fork_server.sh")
+    with open(fork_server, "w") as f:
+      f.write(script)
+
+    os.makedirs(outputs)
+    runScript(fork_server, os.getcwd())
+    shutil.move(outputs, fork_outputs)
+  finally:
+    if os.path.exists(outputs):
+      shutil.rmtree(outputs)
+    if os.path.exists(saved_outputs):
+      shutil.move(saved_outputs, outputs)
+
+  # The parent dumps the stats once more when it exits after the children.
+  parent_dumps = readStatsDumps(os.path.join(parent_dir, "stats.txt"))[:-1]
+  errors = compareStats(
+      readStatsDumps(os.path.join(run_sh_outputs, "stats.txt")),
+      parent_dumps + readStatsDumps(os.path.join(fork_outputs, "stats.txt")))
+  errors += compareOutputs(run_sh_outputs, fork_outputs)
+
+  if errors:
+    for error in errors[:50]:
+      print(error)
+    print("The outputs differ, they are in %s." % tmp_dir)
+    return 1
+  print("The outputs of %s match." % sweep_dir)
+  shutil.rmtree(tmp_dir)
+  return 0
+
+if __name__ == "__main__":
+  sys.exit(main())
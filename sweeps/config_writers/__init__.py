@@ -3,4 +3,5 @@ __all__ = [
     "aladdin_config_writer",
     "gem5_config_writer",
     "condor_writer",
+    "local_writer",
 ]
@@ -1,6 +1,7 @@
 # Writes JSON design sweep dumps as gem5 configuration files.
 
 import ConfigParser
+import collections
 import os
 
 from benchmarks import datatypes
@@ -10,6 +11,7 @@ from xenon.base.datatypes import Param
 
 GEM5_HOME = os.path.abspath(os.path.join(os.environ["ALADDIN_HOME"], "..", ".."))
 GEM5_PATH = os.path.join(GEM5_HOME, "build", "X86", "gem5.opt")
+ALADDIN_SCRIPT = os.path.join(GEM5_HOME, "configs", "aladdin", "aladdin_se.py")
 DEFAULTS = {}
 
 def buildParamDefaults():
@@ -24,6 +26,9 @@ class Gem5ConfigWriter(config_writer.JsonConfigWriter):
   def __init__(self):
     super(Gem5ConfigWriter, self).__init__()
     self.topLevelType = "Benchmark"
+    # Design points that can share a fork server, by benchmark directory and
+    # the gem5 options that aren't specific to the design point.
+    self.fork_server_points = collections.OrderedDict()
     global DEFAULTS
     DEFAULTS = buildParamDefaults()
 
@@ -58,7 +63,7 @@ class Gem5ConfigWriter(config_writer.JsonConfigWriter):
         self.writeRunscript(sweep, child_obj, sweep_dir)
 
   def writeLast(self, all_sweeps):
-    pass
+    self.writeForkServerScripts()
 
   def addGlobalSweepParams(self, sweep, section, config_writer):
     global_params = ["memory_type"]
@@ -253,11 +258,38 @@ class Gem5ConfigWriter(config_writer.JsonConfigWriter):
     output_dir = os.path.join(sweep_dir, "outputs")
     runscript_path = os.path.join(sweep_dir, "run.sh")
     gem5_cfg_path = os.path.join(sweep_dir, "gem5.cfg")
-    aladdin_script = os.path.join(GEM5_HOME, "configs", "aladdin", "aladdin_se.py")
-    num_cpus = 1 if sweep["simulator"] == "gem5-cpu" else 0
-    sys_clock = self.getSysClock(benchmark)
     stdout_path = os.path.join(output_dir, "stdout")
     stderr_path = os.path.join(output_dir, "stderr")
+    sim_options = self.getSimOptions(sweep, benchmark)
+
+    with open(runscript_path, "w") as f:
+      lines = [
+          "#!/bin/sh",
+          GEM5_PATH,
+          "--stats-db-file=stats.db",
+          "--outdir=" + output_dir,
+          ALADDIN_SCRIPT,
+      ] + sim_options[:-1] + [
+          "--accel_cfg_file=" + gem5_cfg_path,
+          sim_options[-1],
+          "> " + stdout_path,
+          "2> " + stderr_path,
+      ]
+      f.write(" \\\n".join(lines))
+
+    # Only design points with CPUs invoke the accelerator, which is where
+    # the fork server forks.
+    if sweep["simulator"] == "gem5-cpu":
+      key = (os.path.dirname(sweep_dir), tuple(sim_options))
+      self.fork_server_points.setdefault(key, []).append(gem5_cfg_path)
+
+  def getSimOptions(self, sweep, benchmark):
+    """ The options of aladdin_se.py, except for the accelerator config.
+
+    The last option is the workload.
+    """
+    num_cpus = 1 if sweep["simulator"] == "gem5-cpu" else 0
+    sys_clock = self.getSysClock(benchmark)
     l2cache_flag = "--l2cache" if benchmark["enable_l2"] else ""
     perfect_bus_flag = "--is_perfect_bus=1 " if benchmark["perfect_bus"] else ""
     if benchmark["perfect_l1"]:
@@ -273,32 +305,61 @@ class Gem5ConfigWriter(config_writer.JsonConfigWriter):
     else:
       exec_cmd = ""
 
-    with open(runscript_path, "w") as f:
+    return [
+        "--num-cpus=" + str(num_cpus),
+        "--mem-size=4GB",
+        "--enable-stats-dump",
+        "--enable_prefetchers",
+        "--prefetcher-type=stride",
+        mem_flag,
+        "--sys-clock=" + sys_clock,
+        "--cpu-type=DerivO3CPU ",
+        "--caches",
+        l2cache_flag,
+        "--cacheline_size=%d " % benchmark["cache_line_sz"],
+        perfect_l1_flag,
+        perfect_bus_flag,
+        exec_cmd,
+    ]
+
+  def writeForkServerScripts(self):
+    """ Write a script per set of design points that only differ in their
+    accelerators.
+
+    The script simulates the CPU up to the first accelerator invocation once
+    and then forks the simulator for each design point, so that the outputs
+    are the same as those of its run.sh.
+    """
+    servers_per_dir = collections.Counter(
+        bmk_dir for bmk_dir, _ in self.fork_server_points)
+    server_ids = collections.Counter()
+    for (bmk_dir, sim_options), cfg_paths in \
+        self.fork_server_points.iteritems():
+      if servers_per_dir[bmk_dir] == 1:
+        name = "fork_server"
+      else:
+        name = "fork_server_%d" % server_ids[bmk_dir]
+        server_ids[bmk_dir] += 1
+
+      points_path = os.path.join(bmk_dir, "%s.points" % name)
+      with open(points_path, "w") as f:
+        for cfg_path in cfg_paths:
+          f.write(cfg_path + "\n")
+
       lines = [
           "#!/bin/sh",
           GEM5_PATH,
           "--stats-db-file=stats.db",
-          "--outdir=" + output_dir,
-          aladdin_script,
-          "--num-cpus=" + str(num_cpus),
-          "--mem-size=4GB",
-          "--enable-stats-dump",
-          "--enable_prefetchers",
-          "--prefetcher-type=stride",
-          mem_flag,
-          "--sys-clock=" + sys_clock,
-          "--cpu-type=DerivO3CPU ",
-          "--caches",
-          l2cache_flag,
-          "--cacheline_size=%d " % benchmark["cache_line_sz"],
-          perfect_l1_flag,
-          perfect_bus_flag,
-          "--accel_cfg_file=" + gem5_cfg_path,
-          exec_cmd,
-          "> " + stdout_path,
-          "2> " + stderr_path,
+          "--outdir=" + os.path.join(bmk_dir, name),
+          ALADDIN_SCRIPT,
+      ] + list(sim_options[:-1]) + [
+          "--accel-sweep=" + points_path,
+          sim_options[-1],
+          "> " + os.path.join(bmk_dir, "%s.stdout" % name),
+          "2> " + os.path.join(bmk_dir, "%s.stderr" % name),
       ]
-      f.write(" \\\n".join(lines))
+      with open(os.path.join(bmk_dir, "%s.sh" % name), "w") as f:
+        f.write(" \\\n".join(lines))
 
   def getSysClock(self, benchmark):
     """ Convert cycle time into MHz. """
@@ -0,0 +1,90 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Writes a list of sweep jobs that run_local.py runs on this machine.
+
+import json
+import os
+
+import aladdin_config_writer
+import config_writer
+import gem5_config_writer
+
+class LocalWriter(config_writer.JsonConfigWriter):
+  def __init__(self):
+    super(LocalWriter, self).__init__()
+    self.topLevelType = "Benchmark"
+    self.jobs_path = None
+    self.jobs = []
+
+  def is_applicable(self, sweep):
+    return ("output_dir" in sweep and "name" in sweep)
+
+  def writeSweep(self, sweep):
+    """ Add a job for each Benchmark obj in the JSON dump. """
+    if not self.jobs_path:
+      self.jobs_path = os.path.join(sweep["output_dir"], "%s.jobs" % sweep["name"])
+    self.writeSweepRecursive_(sweep, sweep.get("simulator", ""))
+
+  def writeLast(self, all_sweeps):
+    if not self.jobs_path:
+      return
+    with open(self.jobs_path, "w") as f:
+      json.dump(self.jobs, f, indent=2)
+
+  def writeSweepRecursive_(self, obj, simulator):
+    for name, child_obj in self.iterdicttypes(obj):
+      identifier = self.get_identifier(name)
+      assert(identifier)
+
+      if identifier == self.topLevelType:
+        benchmark = child_obj["name"]
+        output_dir = self.getOutputSweepDirectory(obj, benchmark)
+        if not os.path.exists(output_dir):
+          os.makedirs(output_dir)
+        self.jobs.append({
+            "name": "%s/%s" % (benchmark, os.path.basename(output_dir)),
+            "dir": output_dir,
+            "runscript": os.path.join(output_dir, "run.sh"),
+            "inputs": self.getInputs(output_dir, simulator),
+        })
+      else:
+        self.writeSweepRecursive_(child_obj, simulator)
+
+  def getInputs(self, output_dir, simulator):
+    """ Files and directories that the results of a job depend on.
+
+    The job directory holds the configuration files, the run script and
+    links to the benchmark binaries, and the trace is shared by all jobs of
+    a benchmark.
+    """
+    if simulator == "aladdin":
+      simulator_path = aladdin_config_writer.ALADDIN_PATH
+    else:
+      simulator_path = gem5_config_writer.GEM5_PATH
+    trace = os.path.join(os.path.dirname(output_dir), "inputs",
+                         "dynamic_trace.gz")
+    return [output_dir, trace, simulator_path]
@@ -14,6 +14,7 @@ def run(input_file):
     aladdin_config_writer.AladdinConfigWriter,
     gem5_config_writer.Gem5ConfigWriter,
     condor_writer.CondorWriter,
+    local_writer.LocalWriter,
   ]
   for genfile in genfiles:
     for writer_type in writers:
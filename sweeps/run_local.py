@@ -0,0 +1,285 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Runs the design points of a sweep on this machine, as an alternative to
+# submitting the Condor script.
+#
+# The sweep scripts write a list of the design points of a sweep to
+# <output_dir>/<name>.jobs. This script runs them in parallel, at most as
+# many at once as there are job slots, and starts a point only if the host
+# has enough free memory for it. Points whose inputs haven't changed since
+# their last successful run are skipped, and the gem5 stats of all points
+# are collected into one SQLite database.
+
+from __future__ import print_function
+
+import argparse
+import hashlib
+import json
+import multiprocessing
+import os
+import sqlite3
+import sys
+import time
+
+CHUNK_SIZE = 1 << 20
+
+# Jobs younger than this may not have reached their footprint yet, so memory
+# is still kept free for them.
+RAMP_UP_SECONDS = 10
+
+# Files and directories in a design point that hold its results, not its
+# inputs.
+OUTPUTS = ["outputs", "log"]
+
+class InputHasher(object):
+  """ Computes the content hash of the inputs of a design point.
+
+  Files are hashed once, as many points share the same trace and simulator
+  binary.
+  """
+  def __init__(self):
+    self.file_digests = {}
+
+  def hashFile(self, path):
+    path = os.path.realpath(path)
+    if path not in self.file_digests:
+      sha = hashlib.sha1()
+      with open(path, "rb") as f:
+        chunk = f.read(CHUNK_SIZE)
+        while chunk:
+          sha.update(chunk)
+          chunk = f.read(CHUNK_SIZE)
+      self.file_digests[path] = sha.hexdigest()
+    return self.file_digests[path]
+
+  def hashPaths(self, paths):
+    """ Hash the named files and the files in the named directories.
+
+    Missing paths are hashed as missing, so that creating them later
+    reruns the point.
+    """
+    sha = hashlib.sha1()
+    for path in paths:
+      if os.path.isdir(path):
+        for root, dirs, files in os.walk(path):
+          if root == path:
+            dirs[:] = [d for d in dirs if d not in OUTPUTS]
+            files = [f for f in files if f not in OUTPUTS]
+          dirs.sort()
+          for name in sorted(files):
+            full_path = os.path.join(root, name)
+            if not os.path.isfile(full_path):
+              continue
+            sha.update(os.path.relpath(full_path, path).encode("utf-8"))
+            sha.update(self.hashFile(full_path).encode("utf-8"))
+      elif os.path.isfile(path):
+        sha.update(self.hashFile(path).encode("utf-8"))
+      else:
+        sha.update(("missing:" + path).encode("utf-8"))
+    return sha.hexdigest()
+
+class Results(object):
+  """ The consolidated results of a sweep.
+
+  The points table records the input hash and the outcome of the last run of
+  each point. The tables of the stats database of each point are copied into
+  tables of the same name, with an extra column that names the point.
+  """
+  def __init__(self, path):
+    self.conn = sqlite3.connect(path)
+    self.conn.execute("pragma journal_mode = wal")
+    self.conn.execute(
+        "create table if not exists points ("
+        "name text primary key, dir text, hash text, status integer, "
+        "seconds real, max_rss_kb integer, finished text)")
+    self.conn.commit()
+
+  def isUpToDate(self, name, digest):
+    row = self.conn.execute(
+        "select hash, status from points where name = ?", (name,)).fetchone()
+    return row is not None and row[0] == digest and row[1] == 0
+
+  def record(self, job, digest, status, seconds, max_rss_kb):
+    if status == 0:
+      self.mergeStats(job)
+    # A failed point keeps no hash, so that it always runs again.
+    self.conn.execute(
+        "insert or replace into points values (?, ?, ?, ?, ?, ?, ?)",
+        (job["name"], job["dir"], digest if status == 0 else None, status,
+         seconds, max_rss_kb, time.strftime("%Y-%m-%d %H:%M:%S")))
+    self.conn.commit()
+
+  def mergeStats(self, job):
+    stats_db = os.path.join(job["dir"], "outputs", "stats.db")
+    if not os.path.exists(stats_db):
+      return
+    try:
+      self.conn.execute("attach database ? as p", (stats_db,))
+      try:
+        tables = [row[0] for row in self.conn.execute(
+            "select name from p.sqlite_master where type = 'table'")]
+        for table in tables:
+          self.conn.execute(
+              "create table if not exists main.\"%s\" as "
+              "select '' as point, * from p.\"%s\" where 0" % (table, table))
+          self.conn.execute(
+              "delete from main.\"%s\" where point = ?" % table,
+              (job["name"],))
+          self.conn.execute(
+              "insert into main.\"%s\" select ?, * from p.\"%s\"" %
+              (table, table), (job["name"],))
+        self.conn.commit()
+      finally:
+        self.conn.execute("detach database p")
+    except sqlite3.Error as e:
+      self.conn.rollback()
+      print("Warning: could not collect the stats of %s: %s" %
+            (job["name"], e), file=sys.stderr)
+
+  def close(self):
+    self.conn.close()
+
+def availableMemoryKB():
+  """ Memory available to new processes, or None if it is unknown. """
+  try:
+    with open("/proc/meminfo") as f:
+      for line in f:
+        if line.startswith("MemAvailable:"):
+          return int(line.split()[1])
+  except IOError:
+    pass
+  return None
+
+class Runner(object):
+  def __init__(self, results, num_slots, job_memory_kb):
+    self.results = results
+    self.num_slots = num_slots
+    # Memory to keep free for each job that is started. Grows to the largest
+    # footprint of a finished job.
+    self.job_memory_kb = job_memory_kb
+    self.running = {}
+
+  def canStart(self):
+    if len(self.running) >= self.num_slots:
+      return False
+    if not self.running:
+      return True
+    available = availableMemoryKB()
+    if available is None:
+      return True
+    now = time.time()
+    ramping_up = sum(1 for job, digest, start in self.running.values()
+                     if now - start < RAMP_UP_SECONDS)
+    return available >= self.job_memory_kb * (1 + ramping_up)
+
+  def start(self, job, digest):
+    pid = os.fork()
+    if pid == 0:
+      try:
+        os.chdir(job["dir"])
+        log = os.open("log", os.O_WRONLY | os.O_CREAT | os.O_TRUNC, 0o644)
+        os.dup2(log, 1)
+        os.dup2(log, 2)
+        os.execv("/bin/sh", ["/bin/sh", job["runscript"]])
+      finally:
+        os._exit(127)
+    self.running[pid] = (job, digest, time.time())
+
+  def waitOne(self):
+    pid, status, rusage = os.wait4(-1, 0)
+    job, digest, start = self.running.pop(pid)
+    if os.WIFSIGNALED(status):
+      code = -os.WTERMSIG(status)
+    else:
+      code = os.WEXITSTATUS(status)
+    seconds = time.time() - start
+    # Linux reports the largest resident set of all waited-for descendants,
+    # which is the simulator itself.
+    max_rss_kb = rusage.ru_maxrss
+    self.job_memory_kb = max(self.job_memory_kb, max_rss_kb)
+    self.results.record(job, digest, code, seconds, max_rss_kb)
+    return job, code, seconds
+
+def main():
+  parser = argparse.ArgumentParser(
+      description="Run the design points of a sweep on this machine.")
+  parser.add_argument("jobs_file", help="The .jobs file of a sweep.")
+  parser.add_argument("-j", "--jobs", type=int,
+                      default=multiprocessing.cpu_count(),
+                      help="Maximum number of points to run at once "
+                      "[Default: %(default)s].")
+  parser.add_argument("--job-memory", type=float, default=1.0,
+                      help="Memory in GB to keep free for each point that "
+                      "is started, until a point has finished and its actual "
+                      "footprint is known [Default: %(default)s].")
+  parser.add_argument("--results",
+                      help="The database to store results in [Default: the "
+                      "jobs file with a .db extension].")
+  parser.add_argument("-f", "--force", action="store_true",
+                      help="Rerun points whose inputs haven't changed.")
+  args = parser.parse_args()
+
+  with open(args.jobs_file) as f:
+    jobs = json.load(f)
+  results_path = args.results or os.path.splitext(args.jobs_file)[0] + ".db"
+  results = Results(results_path)
+  hasher = InputHasher()
+
+  pending = []
+  for job in jobs:
+    digest = hasher.hashPaths(job["inputs"])
+    if not args.force and results.isUpToDate(job["name"], digest):
+      print("Skipping %s, its inputs haven't changed." % job["name"])
+      continue
+    pending.append((job, digest))
+
+  runner = Runner(results, max(args.jobs, 1),
+                  int(args.job_memory * 1024 * 1024))
+  num_done = 0
+  num_failed = 0
+  pending.reverse()
+  while pending or runner.running:
+    while pending and runner.canStart():
+      runner.start(*pending.pop())
+    job, code, seconds = runner.waitOne()
+    num_done += 1
+    if code != 0:
+      num_failed += 1
+    print("[%d/%d] %s %s in %.1f s" %
+          (num_done, num_done + len(pending) + len(runner.running),
+           job["name"], "done" if code == 0 else "failed (%d)" % code,
+           seconds))
+    sys.stdout.flush()
+
+  results.close()
+  print("Results are in %s." % results_path)
+  return 1 if num_failed else 0
+
+if __name__ == "__main__":
+  sys.exit(main())
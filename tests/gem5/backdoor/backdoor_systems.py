@@ -0,0 +1,101 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Run a program on several systems side by side, so that their backdoor
+traces are in the same debug output: one without memory backdoors, one
+with them, one with them and two CPUs that snoop each other's accesses,
+and one with them and a memory that is interleaved over two controllers.
+'''
+
+from __future__ import print_function
+
+import argparse
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument("cmd", help="The program to run")
+args = parser.parse_args()
+
+def create_system(backdoor, num_cpus=1, interleaved=False):
+    system = System()
+
+    system.clk_domain = SrcClockDomain()
+    system.clk_domain.clock = '1GHz'
+    system.clk_domain.voltage_domain = VoltageDomain()
+
+    system.mem_mode = 'atomic'
+    system.mem_ranges = [AddrRange('512MB')]
+
+    system.cpu = [ AtomicSimpleCPU(cpu_id=i, memory_backdoor=backdoor)
+                   for i in range(num_cpus) ]
+
+    system.membus = SystemXBar()
+
+    for cpu in system.cpu:
+        cpu.icache_port = system.membus.slave
+        cpu.dcache_port = system.membus.slave
+
+        cpu.createInterruptController()
+
+        if m5.defines.buildEnv['TARGET_ISA'] == "x86":
+            cpu.interrupts[0].pio = system.membus.master
+            cpu.interrupts[0].int_master = system.membus.slave
+            cpu.interrupts[0].int_slave = system.membus.master
+
+    if interleaved:
+        # Interleave cache lines over two controllers, which can't grant
+        # a backdoor to their part of the range
+        system.mem_ctrls = [
+            SimpleMemory(range=AddrRange(0, size='512MB', intlvHighBit=6,
+                                         intlvBits=1, intlvMatch=i))
+            for i in range(2) ]
+    else:
+        system.mem_ctrls = [ SimpleMemory(range=system.mem_ranges[0]) ]
+    for mem_ctrl in system.mem_ctrls:
+        mem_ctrl.port = system.membus.master
+
+    system.system_port = system.membus.slave
+
+    for i, cpu in enumerate(system.cpu):
+        process = Process(pid=100 + i)
+        process.cmd = [args.cmd]
+        cpu.workload = process
+        cpu.createThreads()
+
+    return system
+
+root = Root(full_system = False,
+            system_off = create_system(False),
+            system_on = create_system(True),
+            system_dual = create_system(True, num_cpus=2),
+            system_intlv = create_system(True, interleaved=True))
+m5.instantiate()
+
+exit_event = m5.simulate()
+print('Exiting @ tick %i because %s' % (m5.curTick(), exit_event.getCause()))
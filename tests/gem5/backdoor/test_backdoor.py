@@ -0,0 +1,132 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Memory backdoors of atomic CPUs and port proxies: check that a CPU alone on
+a coherent crossbar gets backdoors for both of its ports and fetches no
+instructions through packets, that the proxy of its thread uses one too, and
+that CPUs which snoop each other's accesses and interleaved memories get no
+backdoor. All systems must run the program the same way.
+'''
+import os
+import re
+
+from testlib import *
+from testlib.config import constants
+
+class MatchBackdoors(verifier.Verifier):
+    line = re.compile(r'^(\S+)\s+(\S+)')
+
+    def stats(self, filename):
+        '''The values of the last dump of a text stats file, by name'''
+        values = {}
+        with open(filename) as text:
+            for line in text:
+                if line.startswith('---------- Begin'):
+                    values = {}
+                match = self.line.match(line)
+                if match and not line.startswith('#'):
+                    values[match.group(1)] = match.group(2)
+        return values
+
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+        stats = self.stats(joinpath(tempdir, 'stats.txt'))
+        with open(joinpath(tempdir, 'backdoor.out')) as f:
+            trace = f.read()
+        with open(joinpath(tempdir, constants.gem5_simulation_stdout)) as f:
+            simout = f.read()
+
+        def packets(system, port, cpu='cpu'):
+            '''Packets sent through a port of a CPU, which isn't in the
+            stats if there are none'''
+            name = '%s.membus.pkt_count_%s.%s.%s::total' % \
+                (system, system, cpu, port)
+            return int(stats.get(name, 0))
+
+        def traced(pattern):
+            return re.search(pattern, trace, re.MULTILINE) is not None
+
+        errors = []
+        if simout.count('Hello world!') != 5:
+            errors.append('The programs printed %d times instead of 5' %
+                          simout.count('Hello world!'))
+        insts = [ stats.get('%s.cpu.committedInsts' % system)
+                  for system in ('system_off', 'system_on', 'system_intlv') ]
+        if None in insts or len(set(insts)) != 1:
+            errors.append('The systems committed %s instructions' % insts)
+
+        # Alone on the crossbar, the CPU's own data port doesn't keep it
+        # from getting a backdoor for its instruction port
+        if not packets('system_off', 'icache_port') > 0:
+            errors.append('system_off fetched no instructions with packets')
+        if packets('system_on', 'icache_port') != 0:
+            errors.append('system_on fetched instructions with packets')
+        if not packets('system_on', 'dcache_port') < \
+                packets('system_off', 'dcache_port'):
+            errors.append('system_on accessed data with as many packets as '
+                          'system_off')
+        if not traced(r'system_on\.mem_ctrls\d*: Granting backdoor'):
+            errors.append('system_on got no backdoor from its memory')
+        if traced(r'Refusing backdoor for system_on\.cpu\.'):
+            errors.append('The CPU of system_on was refused a backdoor')
+        if not traced(r'system_on\.cpu\.dcache_port: Proxy backdoor'):
+            errors.append('The proxy of system_on used no backdoor')
+
+        # The CPUs snoop each other's accesses
+        for cpu in ('cpu0', 'cpu1'):
+            if not packets('system_dual', 'icache_port', cpu) > 0:
+                errors.append('system_dual.%s fetched no instructions with '
+                              'packets' % cpu)
+        if not traced(r'Refusing backdoor for system_dual\.cpu0\.'
+                      r'icache_port, snooped by system_dual\.cpu1\.'):
+            errors.append('system_dual.cpu0 was not refused a backdoor')
+        if traced(r'system_dual\.\S+: Granting backdoor'):
+            errors.append('system_dual was granted a backdoor')
+
+        # Neither controller has the whole range
+        if not packets('system_intlv', 'icache_port') > 0:
+            errors.append('system_intlv fetched no instructions with packets')
+        if traced(r'system_intlv\.\S+: Granting backdoor'):
+            errors.append('system_intlv was granted a backdoor')
+
+        if errors:
+            self.failed(fixtures)
+            raise AssertionError('\n'.join(errors))
+
+hello_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86', 'linux'),
+                                  'hello64-static')
+
+gem5_verify_config(
+    name='test_backdoor',
+    verifiers=(MatchBackdoors(),),
+    fixtures=(hello_program,),
+    config=joinpath(getcwd(), 'backdoor_systems.py'),
+    config_args=[hello_program.path],
+    gem5_args=['--debug-flags=Backdoor', '--debug-file=backdoor.out'],
+    valid_isas=('X86',),
+)
@@ -0,0 +1,91 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Run a program on two identical systems with atomic CPUs side by side, one
+with the block cache and one without, so that the instruction traces of
+both CPUs are in the same debug output.
+'''
+
+from __future__ import print_function
+
+import argparse
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument("cmd", help="The program to run")
+args = parser.parse_args()
+
+def create_system(block_cache):
+    system = System()
+
+    system.clk_domain = SrcClockDomain()
+    system.clk_domain.clock = '1GHz'
+    system.clk_domain.voltage_domain = VoltageDomain()
+
+    system.mem_mode = 'atomic'
+    system.mem_ranges = [AddrRange('512MB')]
+
+    system.cpu = AtomicSimpleCPU(block_cache=block_cache)
+
+    system.membus = SystemXBar()
+
+    system.cpu.icache_port = system.membus.slave
+    system.cpu.dcache_port = system.membus.slave
+
+    system.cpu.createInterruptController()
+
+    if m5.defines.buildEnv['TARGET_ISA'] == "x86":
+        system.cpu.interrupts[0].pio = system.membus.master
+        system.cpu.interrupts[0].int_master = system.membus.slave
+        system.cpu.interrupts[0].int_slave = system.membus.master
+
+    system.mem_ctrl = SimpleMemory(range=system.mem_ranges[0])
+    system.mem_ctrl.port = system.membus.master
+
+    system.system_port = system.membus.slave
+
+    process = Process()
+    process.cmd = [args.cmd]
+    system.cpu.workload = process
+    system.cpu.createThreads()
+
+    return system
+
+root = Root(full_system = False,
+            system_off = create_system(False),
+            system_on = create_system(True))
+m5.instantiate()
+
+# Each system exits from the simulation loop when its program is done
+for i in range(2):
+    exit_event = m5.simulate()
+    if exit_event.getCause() != "exiting with last active thread context":
+        break
+
+print('Exiting @ tick %i because %s' % (m5.curTick(), exit_event.getCause()))
@@ -0,0 +1,106 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Regression test of the block cache of the atomic CPU: run a program with
+and without it, and check that the traces of the committed instructions,
+with their results and effective addresses, are the same.
+'''
+import os
+import re
+
+from testlib import *
+from testlib.config import constants
+
+class MatchTraces(verifier.Verifier):
+    '''
+    Compares the instruction traces of the CPU without the block cache to
+    the ones of the CPU with it, and checks that it executed cached blocks.
+    '''
+    def __init__(self, trace_filename, cpu_off, cpu_on):
+        super(MatchTraces, self).__init__()
+        self.trace_filename = trace_filename
+        self.cpu_off = cpu_off
+        self.cpu_on = cpu_on
+
+    def traces(self, filename):
+        '''The trace lines of each CPU, without the CPU name'''
+        traces = { self.cpu_off : [], self.cpu_on : [] }
+        with open(filename) as f:
+            for line in f:
+                cpu, _, rest = line.partition(' ')
+                if cpu in traces:
+                    traces[cpu].append(rest)
+        return traces
+
+    def block_cache_hits(self, filename):
+        hits = re.compile(r'^%s\.block_cache\.hits\s+(\d+)' %
+                          re.escape(self.cpu_on))
+        with open(filename) as f:
+            for line in f:
+                match = hits.match(line)
+                if match:
+                    return int(match.group(1))
+        return 0
+
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+
+        traces = self.traces(joinpath(tempdir, self.trace_filename))
+        expected = traces[self.cpu_off]
+        actual = traces[self.cpu_on]
+
+        errors = []
+        if not expected:
+            errors.append('No instructions of %s were traced' % self.cpu_off)
+        for i, (a, b) in enumerate(zip(expected, actual)):
+            if a != b:
+                errors.append('Instruction %d differs:\n  %s: %s  %s: %s' %
+                              (i, self.cpu_off, a, self.cpu_on, b))
+                break
+        if len(expected) != len(actual):
+            errors.append('%s committed %d instructions but %s %d' %
+                          (self.cpu_off, len(expected), self.cpu_on,
+                           len(actual)))
+        if not self.block_cache_hits(joinpath(tempdir, 'stats.txt')):
+            errors.append('%s never executed a cached block' % self.cpu_on)
+        if errors:
+            self.failed(fixtures)
+            raise AssertionError('\n'.join(errors))
+
+hello_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86', 'linux'),
+                                  'hello64-static')
+
+gem5_verify_config(
+    name='test_block_cache_trace',
+    verifiers=(MatchTraces('trace.out', 'system_off.cpu', 'system_on.cpu'),),
+    fixtures=(hello_program,),
+    config=joinpath(getcwd(), 'block_cache_pair.py'),
+    config_args=[hello_program.path],
+    gem5_args=['--debug-flags=ExecNoTicks', '--debug-file=trace.out'],
+    valid_isas=('X86',),
+)
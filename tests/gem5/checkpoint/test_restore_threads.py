@@ -0,0 +1,95 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Restore a checkpoint of a run on one and on several threads (see
+--restore-threads), and check that the restored runs are the same.
+'''
+import os
+import re
+
+from testlib import *
+from testlib.config import constants
+
+class MatchRestoredStats(verifier.Verifier):
+    '''
+    Compares the stats of the runs in the given directories of the tempdir,
+    apart from the host stats, which differ from run to run.
+    '''
+    host_stat = re.compile(r'^host_')
+
+    def __init__(self, outdirs):
+        super(MatchRestoredStats, self).__init__()
+        self.outdirs = outdirs
+
+    def stats(self, filename):
+        with open(filename) as f:
+            return [ line for line in f
+                     if not self.host_stat.match(line) ]
+
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+
+        expected = self.stats(joinpath(tempdir, self.outdirs[0],
+                                       'stats.txt'))
+        errors = []
+        if not expected:
+            errors.append('No stats in %s' % self.outdirs[0])
+        for outdir in self.outdirs[1:]:
+            stats = self.stats(joinpath(tempdir, outdir, 'stats.txt'))
+            for a, b in zip(expected, stats):
+                if a != b:
+                    errors.append('%s: %s%s: %s' % (self.outdirs[0], a,
+                                                    outdir, b))
+                    break
+            if len(expected) != len(stats):
+                errors.append('%d lines of stats in %s but %d in %s' %
+                              (len(expected), self.outdirs[0], len(stats),
+                               outdir))
+        if errors:
+            self.failed(fixtures)
+            raise AssertionError('\n'.join(errors))
+
+hello_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86',
+                                               'linux'),
+                                  'hello64-static')
+
+restores = [ ('restore-%d' % threads,
+              ['--restore-threads=%d' % threads],
+              ['--checkpoint-restore=1']) for threads in (1, 4) ]
+
+gem5_verify_checkpoint(
+    name='test_restore_threads',
+    verifiers=(MatchRestoredStats([ name for name, _, _ in restores ]),),
+    fixtures=(hello_program,),
+    config=joinpath(config.base_dir, 'configs', 'example', 'se.py'),
+    config_args=['--cmd', hello_program.path, '--cpu-type=TimingSimpleCPU',
+                 '--caches', '--checkpoint-dir={tempdir}/cpt'],
+    checkpoint_args=['--maxinsts=2000', '--checkpoint-at-end'],
+    restores=restores,
+    valid_isas=('X86',),
+)
@@ -0,0 +1,90 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Round trip of Ruby checkpoints with functional warmup: take a checkpoint of
+a run whose modified lines are written back to memory functionally, restore
+it by installing the cache contents in the controllers directly, and check
+that the restored run finishes the program.
+'''
+import os
+
+from testlib import *
+from testlib.config import constants
+
+class MatchRestoredOutput(verifier.Verifier):
+    '''
+    Checks that the program printed its output after the checkpoint was
+    restored, and not before, and that the restored run exited normally.
+    '''
+    def __init__(self, output):
+        super(MatchRestoredOutput, self).__init__()
+        self.output = output
+
+    def simout(self, tempdir, outdir):
+        with open(joinpath(tempdir, outdir,
+                           constants.gem5_simulation_stdout)) as f:
+            return f.read()
+
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+
+        errors = []
+        if self.output in self.simout(tempdir, 'checkpoint'):
+            errors.append('The program finished before the checkpoint')
+        restored = self.simout(tempdir, 'restore')
+        if self.output not in restored:
+            errors.append('The restored run did not print %r' % self.output)
+        if 'exiting with last active thread context' not in restored:
+            errors.append('The restored run did not exit normally')
+        if errors:
+            self.failed(fixtures)
+            raise AssertionError('\n'.join(errors))
+
+hello_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86',
+                                               'linux'),
+                                  'hello64-static')
+
+# The protocol of the X86 build is MI_example. MESI_Three_Level shares the L2
+# and directory machines of MESI_Two_Level, but its L0 and L1 caches can't be
+# installed functionally, so its checkpoint is restored by replaying the trace.
+for name, protocol in (('MI_example', None),
+                       ('MESI_Two_Level', 'MESI_Two_Level'),
+                       ('MESI_Three_Level', 'MESI_Three_Level')):
+    gem5_verify_checkpoint(
+        name='test_ruby_checkpoint_' + name,
+        verifiers=(MatchRestoredOutput('Hello world!'),),
+        fixtures=(hello_program,),
+        config=joinpath(config.base_dir, 'configs', 'example', 'se.py'),
+        config_args=['--cmd', hello_program.path, '--ruby',
+                     '--ruby-functional-warmup',
+                     '--checkpoint-dir={tempdir}/cpt'],
+        checkpoint_args=['--maxinsts=2000', '--checkpoint-at-end'],
+        restores=[('restore', [], ['--checkpoint-restore=1'])],
+        valid_isas=('X86',),
+        protocol=protocol,
+    )
@@ -64,11 +64,16 @@ class SConsFixture(Fixture):
 
     :param directory: The directory which scons will -C (cd) into before
         executing. If None is provided, will choose the config base_dir.
+
+    :param options: Extra options to give scons, e.g. to configure the
+        build. Targets built with different options need their own build
+        directory.
     '''
-    def __init__(self, directory=None, target_class=None):
+    def __init__(self, directory=None, target_class=None, options=()):
         self.directory = directory if directory else config.base_dir
         self.target_class = target_class if target_class else SConsTarget
         self.threads = config.threads
+        self.options = list(options)
         self.targets = set()
         super(SConsFixture, self).__init__()
 
@@ -80,7 +85,7 @@ class SConsFixture(Fixture):
             'scons', '-C', self.directory,
             '-j', str(self.threads),
             '--ignore-style'
-        ]
+        ] + self.options
 
         if not self.targets:
             log.test_log.warn(
@@ -139,14 +144,35 @@ class SConsTarget(Fixture):
         return Fixture.schedule_finalized(self, schedule)
 
 class Gem5Fixture(SConsTarget):
-    def __init__(self, isa, variant):
-        target = joinpath(isa.upper(), 'gem5.%s' % variant)
-        super(Gem5Fixture, self).__init__(target)
+    # The scons invocation of builds with --with-cxx-config
+    cxx_config_invocation = None
+
+    def __init__(self, isa, variant, protocol=None, cxx_config=False):
+        build = isa.upper()
+        if protocol is not None:
+            build += '_' + protocol
+        target = joinpath(build, 'gem5.%s' % variant)
+
+        if cxx_config:
+            # The option applies to the whole build, so these builds get a
+            # build directory and an invocation of scons of their own
+            if Gem5Fixture.cxx_config_invocation is None:
+                Gem5Fixture.cxx_config_invocation = SConsFixture(
+                        options=['--with-cxx-config'])
+                globalfixture(Gem5Fixture.cxx_config_invocation)
+            super(Gem5Fixture, self).__init__(target,
+                    build_dir=joinpath(config.build_dir, 'cxx_config',
+                                       'build'),
+                    invocation=Gem5Fixture.cxx_config_invocation)
+        else:
+            super(Gem5Fixture, self).__init__(target)
 
         self.name = constants.gem5_binary_fixture_name
         self.path = self.target
         self.isa = isa
         self.variant = variant
+        self.protocol = protocol
+        self.cxx_config = cxx_config
 
 
 class MakeFixture(Fixture):
@@ -0,0 +1,110 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Run a program on a simple system for a while, then fork the simulator once
+for each of a few output directories with m5.forkEach and let every child
+finish the program. Each child writes its index to a file in its output
+directory and exits with it, except for the last one, which kills itself.
+'''
+
+from __future__ import print_function
+
+import argparse
+import os
+import signal
+import sys
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument("cmd", help="The program to run")
+parser.add_argument("--children", type=int, default=4,
+                    help="Number of children [Default: %(default)s]")
+parser.add_argument("--max-jobs", type=int, default=2,
+                    help="Children that run at once [Default: %(default)s]")
+parser.add_argument("--fork-tick", type=int, default=10000000,
+                    help="Tick to fork at [Default: %(default)s]")
+args = parser.parse_args()
+
+system = System()
+
+system.clk_domain = SrcClockDomain()
+system.clk_domain.clock = '1GHz'
+system.clk_domain.voltage_domain = VoltageDomain()
+
+system.mem_mode = 'timing'
+system.mem_ranges = [AddrRange('512MB')]
+
+system.cpu = TimingSimpleCPU()
+
+system.membus = SystemXBar()
+
+system.cpu.icache_port = system.membus.slave
+system.cpu.dcache_port = system.membus.slave
+
+system.cpu.createInterruptController()
+
+if m5.defines.buildEnv['TARGET_ISA'] == "x86":
+    system.cpu.interrupts[0].pio = system.membus.master
+    system.cpu.interrupts[0].int_master = system.membus.slave
+    system.cpu.interrupts[0].int_slave = system.membus.master
+
+system.mem_ctrl = DDR3_1600_8x8()
+system.mem_ctrl.range = system.mem_ranges[0]
+system.mem_ctrl.port = system.membus.master
+
+system.system_port = system.membus.slave
+
+process = Process()
+process.cmd = [args.cmd]
+system.cpu.workload = process
+system.cpu.createThreads()
+
+root = Root(full_system = False, system = system)
+
+# The simulator can't be forked with listeners enabled
+m5.disableAllListeners()
+m5.instantiate()
+
+exit_event = m5.simulate(args.fork_tick)
+if exit_event.getCause() != "simulate() limit reached":
+    sys.exit("The program finished before forking at tick %i" %
+             args.fork_tick)
+
+simouts = [ "%%(parent)s/child%d" % i for i in range(args.children) ]
+index, codes = m5.forkEach(simouts, max_jobs=args.max_jobs)
+
+if index is not None:
+    exit_event = m5.simulate()
+    with open(os.path.join(m5.options.outdir, "child.txt"), "w") as f:
+        print(index, m5.curTick(), exit_event.getCause(), file=f)
+    if index == args.children - 1:
+        os.kill(os.getpid(), signal.SIGKILL)
+    sys.exit(index)
+
+print("forkEach exit codes:", " ".join(str(c) for c in codes))
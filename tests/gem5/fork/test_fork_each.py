@@ -0,0 +1,89 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Fork the simulator with m5.forkEach and check that every child gets its
+own output directory, finishes the program the same way, and that the
+parent collects the exit codes of all children.
+'''
+import os
+import re
+
+from testlib import *
+from testlib.config import constants
+
+children = 4
+
+class MatchChildren(verifier.Verifier):
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+
+        errors = []
+        ends = set()
+        for index in range(children):
+            outdir = joinpath(tempdir, 'child%d' % index)
+            if not os.path.exists(joinpath(outdir, 'stats.txt')) and \
+               index != children - 1:
+                errors.append('%s has no stats.txt' % outdir)
+            marker = joinpath(outdir, 'child.txt')
+            if not os.path.exists(marker):
+                errors.append('%s has no child.txt' % outdir)
+                continue
+            with open(marker) as f:
+                fields = f.read().split(None, 2)
+            if int(fields[0]) != index:
+                errors.append('%s holds index %s' % (marker, fields[0]))
+            ends.add((fields[1], fields[2].strip()))
+
+        # Every child continues from the same state
+        if len(ends) > 1:
+            errors.append('The children ended differently: %s' %
+                          sorted(ends))
+        if errors:
+            self.failed(fixtures)
+            raise AssertionError('\n'.join(errors))
+
+hello_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86', 'linux'),
+                                  'hello64-static')
+
+# The last child kills itself with SIGKILL
+exit_codes = ' '.join([ str(i) for i in range(children - 1) ] + [ '-9' ])
+
+gem5_verify_config(
+    name='test_fork_each',
+    verifiers=(
+        verifier.MatchRegex(re.compile(r'^forkEach exit codes: %s$' %
+                                       exit_codes),
+                            match_stderr=False),
+        MatchChildren(),
+    ),
+    fixtures=(hello_program,),
+    config=joinpath(getcwd(), 'fork_each.py'),
+    config_args=[hello_program.path, '--children', str(children),
+                 '--max-jobs', '2'],
+    valid_isas=('X86',),
+)
@@ -0,0 +1,160 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Re-run hello from the config.ini dumped by a scripted run: as is, with a
+parameter overridden with --set-param, and restored from a checkpoint of
+the scripted system with --from-config-checkpoint. Check that the stats of
+the re-runs match those of the scripted run, apart from what the override
+changes.
+'''
+import os
+import re
+import ConfigParser
+
+from testlib import *
+from testlib.config import constants
+
+# Tick of the checkpoint, a few thousand instructions into hello
+checkpoint_tick = 1000000
+max_insts = 1000
+
+class MatchFromConfig(verifier.Verifier):
+    line = re.compile(r'^(\S+)\s+(\S+)')
+
+    def stats(self, tempdir, run):
+        '''The values of the last dump of the stats of a run, by name'''
+        values = {}
+        with open(joinpath(tempdir, run, 'stats.txt')) as text:
+            for line in text:
+                if line.startswith('---------- Begin'):
+                    values = {}
+                match = self.line.match(line)
+                if match and not line.startswith('#'):
+                    values[match.group(1)] = match.group(2)
+        return values
+
+    def simout(self, tempdir, run):
+        with open(joinpath(tempdir, run,
+                           constants.gem5_simulation_stdout)) as f:
+            return f.read()
+
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+        errors = []
+
+        # Host stats depend on the machine, not on the simulated system
+        original = self.stats(tempdir, 'original')
+        simulated = set(name for name in original
+                        if not name.startswith('host_'))
+
+        def value(stats, run, name):
+            try:
+                return float(stats[name])
+            except (KeyError, ValueError):
+                errors.append('No value of %s in %s' % (name, run))
+                return 0
+
+        # The same system gives the same stats
+        from_config = self.stats(tempdir, 'from_config')
+        differences = [ name for name in sorted(simulated)
+                        if from_config.get(name) != original[name] ]
+        differences += [ name for name in sorted(from_config)
+                         if not name.startswith('host_') and
+                            name not in simulated ]
+        if differences:
+            errors.append('%d stats differ from the scripted run, e.g. '
+                          '%s: %s instead of %s' %
+                          (len(differences), differences[0],
+                           from_config.get(differences[0]),
+                           original.get(differences[0])))
+        if 'Hello world!' not in self.simout(tempdir, 'from_config'):
+            errors.append('The run from config.ini did not print its output')
+
+        # The overridden instruction limit stops the program early
+        set_param = self.stats(tempdir, 'set_param')
+        if value(original, 'original', 'sim_insts') <= max_insts:
+            errors.append('hello is too short to test --set-param')
+        if value(set_param, 'set_param', 'sim_insts') != max_insts:
+            errors.append('--set-param did not limit the instructions to '
+                          '%d' % max_insts)
+        if 'max instruction count' not in self.simout(tempdir, 'set_param'):
+            errors.append('--set-param did not stop at the limit')
+
+        # The restored system finishes the program at the same time, give
+        # or take the clock edge the CPU resumed on
+        cpt_config = ConfigParser.ConfigParser()
+        cpt_config.read(joinpath(tempdir, 'checkpoint', 'config.ini'))
+        period = float(cpt_config.get('system.cpu_clk_domain', 'clock'))
+        restored = self.stats(tempdir, 'restore')
+        restored_tick = value(restored, 'restore', 'final_tick')
+        if restored_tick <= checkpoint_tick:
+            errors.append('The restored run did not simulate past the '
+                          'checkpoint')
+        if abs(restored_tick - value(original, 'original', 'final_tick')) \
+                > period:
+            errors.append('The restored run finished at tick %d' %
+                          restored_tick)
+        simout = self.simout(tempdir, 'restore')
+        if 'Hello world!' not in simout:
+            errors.append('The restored run did not print its output')
+        if 'exiting with last active thread context' not in simout:
+            errors.append('The restored run did not exit normally')
+
+        if errors:
+            self.failed(fixtures)
+            raise AssertionError('\n'.join(errors))
+
+hello_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86', 'linux'),
+                                  'hello64-static')
+
+se_py = joinpath(config.base_dir, 'configs', 'example', 'se.py')
+from_config = '--from-config={tempdir}/original/config.ini'
+gem5_verify_runs(
+    name='test_from_config',
+    runs=[
+        ('original', [], se_py, ['--cmd', hello_program.path]),
+        ('from_config', [from_config], None, None),
+        ('set_param',
+         [from_config,
+          '--set-param=system.cpu.max_insts_any_thread=%d' % max_insts],
+         None, None),
+        ('checkpoint', [], se_py,
+         ['--cmd', hello_program.path,
+          '--checkpoint-dir={tempdir}/cpt',
+          '--take-checkpoints=%d,%d' % (checkpoint_tick, checkpoint_tick),
+          '--max-checkpoints=1']),
+        ('restore',
+         ['--from-config={tempdir}/checkpoint/config.ini',
+          '--from-config-checkpoint={tempdir}/cpt/cpt.%d' % checkpoint_tick],
+         None, None),
+    ],
+    verifiers=(MatchFromConfig(),),
+    fixtures=(hello_program,),
+    valid_isas=('X86',),
+    cxx_config=True,
+)
@@ -0,0 +1,108 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+SMARTS-style sampling of hello on a detailed CPU: check that the sampling
+controller measured several windows, and that the atomic CPU trained the one
+branch predictor that it shares with the detailed CPU.
+'''
+import os
+import re
+
+from testlib import *
+from testlib.config import constants
+
+window = 200
+
+class MatchSamplingStats(verifier.Verifier):
+    line = re.compile(r'^(\S+)\s+(\S+)')
+
+    def stats(self, filename):
+        '''The values of the last dump of a text stats file, by name'''
+        values = {}
+        with open(filename) as text:
+            for line in text:
+                if line.startswith('---------- Begin'):
+                    values = {}
+                match = self.line.match(line)
+                if match and not line.startswith('#'):
+                    values[match.group(1)] = match.group(2)
+        return values
+
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+        stats = self.stats(joinpath(tempdir, 'stats.txt'))
+
+        def value(name):
+            try:
+                return float(stats[name])
+            except (KeyError, ValueError):
+                errors.append('No value of %s' % name)
+                return 0
+
+        errors = []
+        samples = value('system.sampler.samples')
+        if samples < 2:
+            errors.append('Only %d measurement windows' % samples)
+        if value('system.sampler.windowInsts') < (samples - 1) * window:
+            errors.append('The windows committed too few instructions')
+        if not value('system.sampler.windowCycles') > 0:
+            errors.append('The windows took no cycles')
+        if not value('system.sampler.cpi') > 0:
+            errors.append('No mean CPI')
+
+        # The predictor is a child of the atomic CPU only
+        if not value('system.cpu.branchPred.lookups') > 0:
+            errors.append('The atomic CPU made no branch predictions')
+        shared = [ name for name in stats
+                   if name.startswith('system.switch_cpus.branchPred.') ]
+        if shared:
+            errors.append('The detailed CPU has its own predictor: %s' %
+                          shared[0])
+
+        if errors:
+            self.failed(fixtures)
+            raise AssertionError('\n'.join(errors))
+
+hello_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86', 'linux'),
+                                  'hello64-static')
+
+for name, bp_args in (('default_bp', []),
+                      ('bp_type', ['--bp-type', 'LocalBP'])):
+    gem5_verify_config(
+        name='test_sampling_' + name,
+        verifiers=(MatchSamplingStats(),),
+        fixtures=(hello_program,),
+        config=joinpath(config.base_dir, 'configs', 'example', 'se.py'),
+        config_args=['--cmd', hello_program.path, '--caches',
+                     '--cpu-type', 'DerivO3CPU', '--sampling',
+                     '--sampling-warming', '1000',
+                     '--sampling-warmup', '100',
+                     '--sampling-window', str(window),
+                     '--sampling-error', '0'] + bp_args,
+        valid_isas=('X86',),
+    )
@@ -0,0 +1,147 @@
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Round trip of the binary stats format: dump the stats of a run many times
+to both stats.txt and a binary file, and check that util/stats/binary.py
+reads back the values of the text output from the binary file.
+'''
+import math
+import os
+import re
+import sys
+
+from testlib import *
+from testlib.config import constants
+
+class MatchBinaryStats(verifier.Verifier):
+    begin = '---------- Begin Simulation Statistics ----------'
+    end = '---------- End Simulation Statistics   ----------'
+    line = re.compile(r'^(\S+)\s+(\S+)')
+
+    def __init__(self, binary_filename):
+        super(MatchBinaryStats, self).__init__()
+        self.binary_filename = binary_filename
+
+    def text_dumps(self, filename):
+        '''The values of each dump in a text stats file, by name'''
+        dumps = []
+        with open(filename) as text:
+            for line in text:
+                line = line.strip()
+                if line == self.begin:
+                    dumps.append({})
+                elif line and line != self.end and not line.startswith('#'):
+                    match = self.line.match(line)
+                    dumps[-1][match.group(1)] = match.group(2)
+        return dumps
+
+    def binary_value(self, stats, dump, name):
+        '''The value of a line of the text output in the binary file, or
+        None if it isn't one that the binary format has'''
+        import binary
+
+        base, _, sub = name.partition('::')
+        stat = stats.stats.get(base)
+        if stat is None:
+            return None
+
+        if stat.kind == binary.SCALAR and not sub:
+            return stats.values(base)[dump, 0]
+        if stat.kind in (binary.VECTOR, binary.FORMULA) and sub:
+            values = stats.values(base)[dump]
+            if sub == 'total':
+                return values[-1]
+            if sub in stat.subnames:
+                return values[stat.subnames.index(sub)]
+            if sub.isdigit():
+                return values[int(sub)]
+        if stat.kind == binary.DIST and sub in ('samples', 'overflows',
+                                                'underflows'):
+            field = { 'samples' : 'samples', 'overflows' : 'overflow',
+                      'underflows' : 'underflow' }[sub]
+            return stats.dist_values(base)[field][dump]
+        return None
+
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+
+        sys.path.insert(0, joinpath(config.base_dir, 'util', 'stats'))
+        import binary
+
+        stats = binary.BinaryStats(joinpath(tempdir, self.binary_filename))
+        text_dumps = self.text_dumps(joinpath(tempdir, 'stats.txt'))
+
+        errors = []
+        if len(stats) != len(text_dumps):
+            errors.append('%d binary dumps but %d text dumps' %
+                          (len(stats), len(text_dumps)))
+        if len(text_dumps) < 3:
+            errors.append('Only %d dumps' % len(text_dumps))
+
+        compared = 0
+        for dump, text_values in enumerate(text_dumps[:len(stats)]):
+            for name, text in text_values.items():
+                try:
+                    expected = float(text)
+                except ValueError:
+                    continue
+                value = self.binary_value(stats, dump, name)
+                if value is None:
+                    continue
+                compared += 1
+
+                # The text output is rounded to the precision of the stat
+                precision = stats.stats[name.partition('::')[0]].precision
+                if precision < 0:
+                    precision = 6
+                tolerance = max(1e-6 * abs(value), 0.5 * 10 ** -precision)
+                if math.isnan(expected) and math.isnan(value):
+                    continue
+                if not abs(expected - value) <= tolerance:
+                    errors.append('dump %d: %s is %s in stats.txt but %r '
+                                  'in %s' % (dump, name, text, value,
+                                             self.binary_filename))
+
+        if not compared:
+            errors.append('No values to compare')
+        if errors:
+            self.failed(fixtures)
+            raise AssertionError('\n'.join(errors[:20]))
+
+hello_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86', 'linux'),
+                                  'hello64-static')
+
+gem5_verify_config(
+    name='test_binary_stats',
+    verifiers=(MatchBinaryStats('stats.bin'),),
+    fixtures=(hello_program,),
+    config=joinpath(getcwd(), 'periodic_dumps.py'),
+    config_args=[hello_program.path, '--period', '20000000'],
+    gem5_args=['--stats-binary-file=stats.bin'],
+    valid_isas=('X86',),
+)
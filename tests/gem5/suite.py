@@ -120,10 +120,121 @@ def gem5_verify_config(name,
                 tests=tests))
     return testsuites
 
-def _create_test_run_gem5(config, config_args, gem5_args):
+def gem5_verify_checkpoint(name,
+                           config,
+                           config_args,
+                           checkpoint_args,
+                           restores,
+                           verifiers,
+                           gem5_args=tuple(),
+                           fixtures=[],
+                           valid_isas=constants.supported_isas,
+                           valid_variants=constants.supported_variants,
+                           length=constants.supported_lengths[0],
+                           protocol=None):
+    '''
+    Helper to generate tests that restore checkpoints.
+
+    Like :func:`gem5_verify_config`, but gem5 first runs the config to take
+    a checkpoint, with its output in the \'checkpoint\' directory of the
+    tempdir, and then once more for each restore, with its output in a
+    directory of the tempdir named after it. The verifiers run after all
+    of them.
+
+    :param checkpoint_args: A list of arguments which are added to
+        config_args to take the checkpoint.
+
+    :param protocol: The Ruby protocol of the gem5 build, if it isn't the
+        default one of the isa.
+
+    :param restores: An iterable of (name, gem5_args, config_args) tuples,
+        the arguments of which are added to gem5_args and config_args to
+        restore the checkpoint.
+
+    Arguments can refer to the tempdir of the test as {tempdir}, e.g. to
+    give the configs the directory of the checkpoint.
+    '''
+    runs = [('checkpoint', gem5_args, config,
+             list(config_args) + list(checkpoint_args))]
+    for restore, restore_gem5_args, restore_config_args in restores:
+        runs.append((restore, list(gem5_args) + list(restore_gem5_args),
+                     config, list(config_args) + list(restore_config_args)))
+
+    return gem5_verify_runs(name, runs, verifiers, fixtures=fixtures,
+                            valid_isas=valid_isas,
+                            valid_variants=valid_variants, length=length,
+                            protocol=protocol)
+
+def gem5_verify_runs(name,
+                     runs,
+                     verifiers,
+                     fixtures=[],
+                     valid_isas=constants.supported_isas,
+                     valid_variants=constants.supported_variants,
+                     length=constants.supported_lengths[0],
+                     protocol=None,
+                     cxx_config=False):
+    '''
+    Helper to generate tests that run gem5 several times, each run using
+    the output of the ones before it, and verify them together.
+
+    :param runs: An iterable of (name, gem5_args, config, config_args)
+        tuples, run in order with their output in a directory of the
+        tempdir named after them. If config is None, gem5 is run without a
+        config, e.g. with --from-config, and config_args are ignored.
+
+    :param protocol: The Ruby protocol of the gem5 build, if it isn't the
+        default one of the isa.
+
+    :param cxx_config: Use a gem5 built with --with-cxx-config.
+
+    Arguments can refer to the tempdir of the test as {tempdir}, e.g. to
+    give a run the output of an earlier one.
+    '''
+    fixtures = list(fixtures)
+    testsuites = []
+    for opt in valid_variants:
+        for isa in valid_isas:
+            tempdir = TempdirFixture()
+            gem5_returncode = VariableFixture(
+                    name=constants.gem5_returncode_fixture_name)
+
+            _name = '{given_name}-{isa}-{opt}'.format(
+                    given_name=name,
+                    isa=isa,
+                    opt=opt)
+
+            tests = []
+            for run, run_gem5_args, run_config, run_config_args in runs:
+                tests.append(TestFunction(
+                        _create_test_run_gem5(
+                            run_config,
+                            run_config_args if run_config else [],
+                            run_gem5_args, run),
+                        name='-'.join([_name, run])))
+
+            for verifier in verifiers:
+                tests.append(verifier.instantiate_test(_name))
+
+            tags = [isa, opt, length]
+
+            _fixtures = copy.copy(fixtures)
+            _fixtures.append(Gem5Fixture(isa, opt, protocol, cxx_config))
+            _fixtures.append(tempdir)
+            _fixtures.append(gem5_returncode)
+
+            testsuites.append(TestSuite(
+                name=_name,
+                fixtures=_fixtures,
+                tags=tags,
+                tests=tests))
+    return testsuites
+
+def _create_test_run_gem5(config, config_args, gem5_args, outdir=None):
     def test_run_gem5(params):
         '''
-        Simple \'test\' which runs gem5 and saves the result into a tempdir.
+        Simple \'test\' which runs gem5 and saves the result into a tempdir,
+        or the outdir directory of it.
 
         NOTE: Requires fixtures: tempdir, gem5
         '''
@@ -151,13 +262,17 @@ def _create_test_run_gem5(config, config_args, gem5_args):
         command = [
             gem5,
             '-d',  # Set redirect dir to tempdir.
-            tempdir,
+            tempdir if outdir is None else os.path.join(tempdir, outdir),
             '-re',# TODO: Change to const. Redirect stdout and stderr
         ]
-        command.extend(_gem5_args)
-        command.append(config)
+        command.extend(arg.format(tempdir=tempdir) for arg in _gem5_args)
+        if config is not None:
+            command.append(config)
         # Config_args should set up the program args.
-        command.extend(config_args)
+        command.extend(arg.format(tempdir=tempdir) for arg in config_args)
         returncode.value = log_call(params.log, command)
+        if outdir is not None and returncode.value != 0:
+            raise AssertionError('gem5 exited with %d in %s' %
+                                 (returncode.value, outdir))
 
     return test_run_gem5
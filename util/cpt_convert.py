@@ -0,0 +1,295 @@
+#! /usr/bin/env python2.7
+
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Convert the m5.cpt file of a checkpoint between the ini format and the
+# binary format (--checkpoint-format=binary). The binary format is
+# described in src/sim/binary_checkpoint.hh.
+#
+# Examples:
+#   cpt_convert.py m5out/cpt.1000                 # convert in place
+#   cpt_convert.py m5out/cpt.1000/m5.cpt cpt.ini  # write an ini copy
+#   cpt_convert.py --to binary cpt.ini m5.cpt
+#
+# Converting an ini checkpoint stores integer and boolean values, and
+# arrays of them, in binary, and everything else as text. Converting a
+# binary checkpoint prints floating point values with enough digits to
+# read back the same value.
+
+from __future__ import print_function
+
+import argparse
+import os.path as osp
+import re
+import shutil
+import struct
+import sys
+from collections import OrderedDict
+
+MAGIC = b"gem5cpt"
+VERSION = 1
+
+# Entry types, see BinaryCheckpoint::Type
+TEXT, BOOL, INT8, UINT8, INT16, UINT16, INT32, UINT32, INT64, UINT64, \
+    FLOAT, DOUBLE = range(12)
+
+FORMATS = {
+    BOOL : "B",
+    INT8 : "b", UINT8 : "B",
+    INT16 : "h", UINT16 : "H",
+    INT32 : "i", UINT32 : "I",
+    INT64 : "q", UINT64 : "Q",
+    FLOAT : "f", DOUBLE : "d",
+}
+
+LIMITS = {
+    INT8 : (-2**7, 2**7), UINT8 : (0, 2**8),
+    INT16 : (-2**15, 2**15), UINT16 : (0, 2**16),
+    INT32 : (-2**31, 2**31), UINT32 : (0, 2**32),
+    INT64 : (-2**63, 2**63), UINT64 : (0, 2**64),
+}
+
+# Integers as gem5 prints them, so that they read back as the same text
+INT_RE = re.compile(r"^(0|-?[1-9][0-9]*)$")
+
+def is_binary(path):
+    with open(path, "rb") as f:
+        return f.read(len(MAGIC)) == MAGIC
+
+def show(entry_type, values):
+    '''The ini text of the values of an entry, like Entry::str()'''
+    if entry_type == BOOL:
+        return " ".join("true" if v else "false" for v in values)
+    elif entry_type in (FLOAT, DOUBLE):
+        return " ".join("%.17g" % v for v in values)
+    else:
+        return " ".join(str(v) for v in values)
+
+def parse(entry_type, value):
+    '''The values of an entry from its ini text, None if they can't be
+    stored as the type'''
+    tokens = value.split(" ") if value else []
+    try:
+        if entry_type == BOOL:
+            values = [ { "true" : 1, "false" : 0 }[t] for t in tokens ]
+        elif entry_type in (FLOAT, DOUBLE):
+            values = [ float(t) for t in tokens ]
+        else:
+            values = [ int(t) for t in tokens ]
+            low, high = LIMITS[entry_type]
+            if any(v < low or v >= high for v in values):
+                return None
+    except (KeyError, ValueError):
+        return None
+    return values
+
+def guess_type(value):
+    '''The type to store an ini value as'''
+    tokens = value.split(" ")
+    if not value:
+        return TEXT
+    elif all(t in ("true", "false") for t in tokens):
+        return BOOL
+    elif all(INT_RE.match(t) for t in tokens):
+        return INT64 if any(t.startswith("-") for t in tokens) else UINT64
+    else:
+        return TEXT
+
+def parse_ini(lines, sections=None):
+    '''Add the sections of ini text, which are dicts of the values by
+    entry name, to sections. Follows the rules of IniFile.'''
+    if sections is None:
+        sections = OrderedDict()
+    section = None
+    for line in lines:
+        line = line.rstrip("\n").lstrip().rstrip(" ")
+        if not line:
+            continue
+        if line.startswith("[") and line.endswith("]"):
+            section = sections.setdefault(line[1:-1].strip(" "),
+                                          OrderedDict())
+            continue
+        if section is None:
+            continue
+
+        if "=" not in line:
+            raise ValueError("Can't parse .ini line %s" % line)
+        name, value = line.split("=", 1)
+        append = name.endswith("+")
+        if append:
+            name = name[:-1]
+        name, value = name.strip(" "), value.strip(" ")
+        if append and name in section:
+            section[name] += " " + value
+        else:
+            section[name] = value
+    return sections
+
+def read_ini(path):
+    '''The sections of an ini checkpoint'''
+    with open(path, "r") as f:
+        return parse_ini(f)
+
+def write_ini(path, sections):
+    with open(path, "w") as f:
+        for section, entries in sections.items():
+            f.write("\n[%s]\n" % section)
+            for name, value in entries.items():
+                f.write("%s=%s\n" % (name, value))
+
+def read_binary(path):
+    '''The sections of a binary checkpoint as text, like read_ini(), and
+    the types of the entries by (section, name)'''
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:len(MAGIC)] != MAGIC:
+        raise ValueError("%s is not a binary checkpoint" % path)
+    version = ord(data[len(MAGIC):len(MAGIC) + 1])
+    if version != VERSION:
+        raise ValueError("Unsupported binary checkpoint version %d" % version)
+
+    def string(pos):
+        length, = struct.unpack_from("=I", data, pos)
+        pos += 4
+        return data[pos:pos + length].decode("utf-8", "replace"), \
+            pos + length
+
+    index_offset, = struct.unpack_from("=Q", data, len(data) - 8)
+    text_offset, text_size, parts = \
+        struct.unpack_from("=QQI", data, index_offset)
+    pos = index_offset + 20
+
+    sections = OrderedDict()
+    types = {}
+    for _ in range(parts):
+        section, pos = string(pos)
+        offset, size = struct.unpack_from("=QQ", data, pos)
+        pos += 16
+
+        entries = sections.setdefault(section, OrderedDict())
+        end = offset + size
+        while offset < end:
+            name, offset = string(offset)
+            entry_type, count = struct.unpack_from("=BQ", data, offset)
+            offset += 9
+            if entry_type == TEXT:
+                value = data[offset:offset + count].decode("utf-8", "replace")
+                offset += count
+            else:
+                fmt = "=%d%s" % (count, FORMATS[entry_type])
+                value = show(entry_type,
+                             struct.unpack_from(fmt, data, offset))
+                offset += struct.calcsize(fmt)
+            entries[name] = value
+            types[(section, name)] = entry_type
+
+    # Entries that were written as text to the checkpoint stream, which
+    # gem5 looks up after the entries above
+    text = data[text_offset:text_offset + text_size].decode("utf-8", "replace")
+    for section, entries in parse_ini(text.splitlines()).items():
+        merged = sections.setdefault(section, OrderedDict())
+        for name, value in entries.items():
+            merged.setdefault(name, value)
+
+    return sections, types
+
+def write_binary(path, sections, types={}):
+    '''Write sections, like those of read_ini(), as a binary checkpoint.
+    Entries keep the type in types if their values still fit it.'''
+    def string(s):
+        if not isinstance(s, bytes):
+            s = s.encode("utf-8")
+        return struct.pack("=I", len(s)) + s
+
+    with open(path, "wb") as f:
+        f.write(MAGIC + struct.pack("=B", VERSION))
+        index = []
+        for section, entries in sections.items():
+            chunks = []
+            for name, value in entries.items():
+                entry_type = types.get((section, name), guess_type(value))
+                values = None if entry_type == TEXT else \
+                    parse(entry_type, value)
+                if values is None:
+                    text = string(value)[4:]
+                    chunks.append(string(name) +
+                                  struct.pack("=BQ", TEXT, len(text)) + text)
+                else:
+                    chunks.append(string(name) +
+                                  struct.pack("=BQ", entry_type, len(values)) +
+                                  struct.pack("=%d%s" % (len(values),
+                                                         FORMATS[entry_type]),
+                                              *values))
+            chunk = b"".join(chunks)
+            index.append(string(section) + struct.pack("=QQ", f.tell(),
+                                                       len(chunk)))
+            f.write(chunk)
+
+        index_offset = f.tell()
+        f.write(struct.pack("=QQI", index_offset, 0, len(index)))
+        f.write(b"".join(index))
+        f.write(struct.pack("=Q", index_offset))
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert a gem5 checkpoint between the ini and the "
+        "binary format.")
+    parser.add_argument("--to", choices=["ini", "binary"],
+                        help="Format to convert to [Default: the other "
+                        "format]")
+    parser.add_argument("-N", "--no-backup", action="store_false",
+                        dest="backup", default=True,
+                        help="Don't back up the checkpoint when converting "
+                        "it in place")
+    parser.add_argument("input", help="Checkpoint directory or m5.cpt file")
+    parser.add_argument("output", nargs="?",
+                        help="Converted file [Default: convert in place]")
+    args = parser.parse_args()
+
+    path = args.input
+    if osp.isdir(path):
+        path = osp.join(path, "m5.cpt")
+
+    binary = is_binary(path)
+    if binary:
+        sections, types = read_binary(path)
+    else:
+        sections, types = read_ini(path), {}
+
+    to_binary = (args.to or ("ini" if binary else "binary")) == "binary"
+    output = args.output or path
+    if output == path and args.backup:
+        shutil.copyfile(path, path + ".bak")
+
+    if to_binary:
+        write_binary(output, sections, types)
+    else:
+        write_ini(output, sections)
+
+if __name__ == "__main__":
+    main()
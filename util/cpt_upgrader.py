@@ -74,8 +74,12 @@
 
 
 import ConfigParser
+import StringIO
 import glob, types, sys, os
 import os.path as osp
+from collections import OrderedDict
+
+import cpt_convert
 
 verbose_print = False
 
@@ -200,10 +204,22 @@ def process_file(path, **kwargs):
     # gem5 is case sensitive with paramaters
     cpt.optionxform = str
 
-    # Read the current data
-    cpt_file = file(path, 'r')
-    cpt.readfp(cpt_file)
-    cpt_file.close()
+    # Read the current data, binary checkpoints are upgraded as ini text
+    # and keep the types of their entries
+    binary = cpt_convert.is_binary(path)
+    if binary:
+        sections, entry_types = cpt_convert.read_binary(path)
+        text = StringIO.StringIO()
+        for section, entries in sections.items():
+            text.write("[%s]\n" % section)
+            for name, value in entries.items():
+                text.write("%s=%s\n" % (name, value))
+        text.seek(0)
+        cpt.readfp(text)
+    else:
+        cpt_file = file(path, 'r')
+        cpt.readfp(cpt_file)
+        cpt_file.close()
 
     change = False
 
@@ -259,7 +275,12 @@ def process_file(path, **kwargs):
 
     # Write the old data back
     verboseprint("...completed")
-    cpt.write(file(path, 'w'))
+    if binary:
+        sections = OrderedDict((section, OrderedDict(cpt.items(section, True)))
+                               for section in cpt.sections())
+        cpt_convert.write_binary(path, sections, entry_types)
+    else:
+        cpt.write(file(path, 'w'))
 
 if __name__ == '__main__':
     from optparse import OptionParser, SUPPRESS_HELP
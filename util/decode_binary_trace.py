@@ -0,0 +1,305 @@
+#! /usr/bin/env python2.7
+
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Decode a binary debug trace (--debug-format=binary) into the text that
+# the normal debug output would have produced. The file format is
+# described in src/base/binary_trace.hh.
+
+from __future__ import print_function
+
+import argparse
+import gzip
+import re
+import struct
+import sys
+
+MAGIC = b"gem5btr"
+VERSION = 1
+
+MAX_TICK = 2**64 - 1
+
+# Argument tags, see src/base/trace_args.hh
+ARG_INT, ARG_UINT, ARG_FLOAT, ARG_CHAR, ARG_BOOL, ARG_PTR, ARG_STR = \
+    range(1, 8)
+
+# Instruction record flags, see BinaryLogger::InstFlags
+INST_RAN = 0x1
+INST_PRED_FALSE = 0x2
+INST_DATA_VALID = 0x4
+INST_ADDR_VALID = 0x8
+
+SPEC_RE = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?"
+                     r"(hh|h|ll|l|L|q|j|z|t)?([diouxXcsfFeEgGpn%])")
+
+def open_trace(filename):
+    f = open(filename, "rb")
+    if f.read(2) == b"\x1f\x8b":
+        f.close()
+        return gzip.open(filename, "rb")
+    f.seek(0)
+    return f
+
+def decode_args(data, nargs):
+    args = []
+    pos = 0
+    for _ in range(nargs):
+        tag = ord(data[pos:pos + 1])
+        pos += 1
+        if tag in (ARG_INT, ARG_UINT):
+            size = ord(data[pos:pos + 1])
+            val, = struct.unpack_from("=q" if tag == ARG_INT else "=Q",
+                                      data, pos + 1)
+            args.append((tag, size, val))
+            pos += 9
+        elif tag in (ARG_FLOAT, ARG_PTR):
+            val, = struct.unpack_from("=d" if tag == ARG_FLOAT else "=Q",
+                                      data, pos)
+            args.append((tag, 8, val))
+            pos += 8
+        elif tag in (ARG_CHAR, ARG_BOOL):
+            args.append((tag, 1, ord(data[pos:pos + 1])))
+            pos += 1
+        elif tag == ARG_STR:
+            length, = struct.unpack_from("=I", data, pos)
+            val = data[pos + 4:pos + 4 + length].decode("utf-8", "replace")
+            args.append((tag, length, val))
+            pos += 4 + length
+        else:
+            raise ValueError("Unknown argument tag %d" % tag)
+    return args
+
+def format_arg(flags, width, precision, conv, arg):
+    tag, size, val = arg
+
+    if conv in "diouxX":
+        if tag == ARG_STR:
+            conv = "s"
+        elif tag == ARG_FLOAT:
+            val = int(val)
+        elif tag == ARG_CHAR and conv in "di":
+            # cprintf prints chars as characters even with %d
+            conv = "c"
+        if conv in "ouxX" and tag == ARG_INT and val < 0:
+            # Like cprintf, show negative numbers as their unsigned
+            # representation of the original size
+            val &= (1 << (8 * size)) - 1
+    elif conv in "fFeEgG":
+        if tag == ARG_STR:
+            conv = "s"
+        else:
+            val = float(val)
+    elif conv == "c":
+        if tag == ARG_STR:
+            conv = "s"
+        else:
+            val = chr(val & 0xff)
+            conv = "s"
+    elif conv == "s":
+        if tag == ARG_BOOL:
+            val = "true" if val else "false"
+        elif tag == ARG_CHAR:
+            val = chr(val)
+        elif tag in (ARG_UINT, ARG_INT, ARG_PTR):
+            # cprintf formats numbers passed to %s as decimal
+            conv = "d"
+    elif conv == "p":
+        flags += "#"
+        conv = "x"
+
+    spec = "%" + flags
+    if width is not None:
+        spec += str(width)
+    if precision is not None and conv != "d":
+        spec += "." + str(precision)
+    if conv == "u":
+        conv = "d"
+    return (spec + conv) % val
+
+def cprintf(fmt, args):
+    out = []
+    pos = 0
+    argi = 0
+    for m in SPEC_RE.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, precision, _, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        if width == "*":
+            width = args[argi][2]
+            argi += 1
+        if precision == "*":
+            precision = args[argi][2]
+            argi += 1
+        elif precision == "":
+            precision = 0
+        if argi >= len(args):
+            out.append("<missing arg for format>")
+            continue
+        out.append(format_arg(flags, width, precision, conv, args[argi]))
+        argi += 1
+    out.append(fmt[pos:])
+    if argi < len(args):
+        out.append("<extra arg>" * (len(args) - argi))
+    return "".join(out)
+
+def prefix(when, name):
+    out = ""
+    if when != MAX_TICK:
+        out += "%7d: " % when
+    if name:
+        out += "%s: " % name
+    return out
+
+def hex_dump(when, name, data):
+    # Same layout as Logger::dump()
+    lines = []
+    for i in range(0, len(data), 16):
+        chunk = bytearray(data[i:i + 16])
+        line = "%08x  " % i
+        for j, c in enumerate(chunk):
+            line += "%02x " % c
+            if j == 7:
+                line += " "
+        line += "   " * (16 - len(chunk)) + "  "
+        for c in chunk:
+            c &= 0x7f
+            line += chr(c) if 32 <= c < 127 else " "
+        lines.append(prefix(when, name) + line + "\n")
+    return "".join(lines)
+
+class Decoder(object):
+    def __init__(self, out, args):
+        self.out = out
+        self.args = args
+        self.strings = {}
+
+    def inst(self, when, cpu, tid, pc, upc, disasm, op_class, flags,
+             data, addr):
+        args = self.args
+        line = "%7d: %s " % (when, self.strings[cpu])
+        if args.thread:
+            line += "T%d : " % tid
+        line += "0x%x" % pc
+        line += (".%2d" % upc) if upc != 0xffff else "   "
+        line += " : %-26s" % self.strings[disasm]
+        if flags & INST_RAN:
+            line += " : "
+            if args.op_class:
+                line += self.strings[op_class] + " : "
+            if args.result and flags & INST_PRED_FALSE:
+                line += "Predicated False"
+            if args.result and flags & INST_DATA_VALID:
+                line += " D=%#018x" % data
+            if args.eff_addr and flags & INST_ADDR_VALID:
+                line += " A=0x%x" % addr
+        self.out.write(line + "\n")
+
+    def block(self, data):
+        strings = self.strings
+        pos = 0
+        end = len(data)
+        while pos < end:
+            kind = data[pos:pos + 1]
+            pos += 1
+            if kind == b"M":
+                when, name, fmt, nargs, length = \
+                    struct.unpack_from("=QIIBI", data, pos)
+                pos += 21
+                args = decode_args(data[pos:pos + length], nargs)
+                pos += length
+                self.out.write(prefix(when, strings[name]) +
+                               cprintf(strings[fmt], args))
+            elif kind in (b"T", b"X"):
+                when, name, length = struct.unpack_from("=QII", data, pos)
+                pos += 16
+                payload = data[pos:pos + length]
+                pos += length
+                if kind == b"T":
+                    self.out.write(prefix(when, strings[name]) +
+                                   payload.decode("utf-8", "replace"))
+                else:
+                    self.out.write(hex_dump(when, strings[name], payload))
+            elif kind == b"I":
+                fields = struct.unpack_from("=QIBQHIIBQQ", data, pos)
+                pos += 48
+                self.inst(*fields)
+            else:
+                raise ValueError("Unknown record type %r" % kind)
+
+    def decode(self, f):
+        if f.read(len(MAGIC)) != MAGIC:
+            raise ValueError("Not a binary gem5 trace")
+        version = ord(f.read(1))
+        if version != VERSION:
+            raise ValueError("Unsupported trace version %d" % version)
+
+        while True:
+            kind = f.read(1)
+            if not kind:
+                break
+            header = f.read(8)
+            if len(header) < 8:
+                # Truncated, e.g. if the simulator was killed
+                break
+            ident, length = struct.unpack("=II", header)
+            payload = f.read(length)
+            if len(payload) < length:
+                break
+            if kind == b"S":
+                self.strings[ident] = payload.decode("utf-8", "replace")
+            elif kind == b"B":
+                self.block(payload)
+            else:
+                raise ValueError("Unknown chunk type %r" % kind)
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode a binary gem5 debug trace into text.")
+    parser.add_argument("trace", help="Binary trace file")
+    parser.add_argument("output", nargs="?",
+                        help="Text output file [Default: stdout]")
+    parser.add_argument("--no-thread", dest="thread", action="store_false",
+                        help="Don't print thread IDs of instructions")
+    parser.add_argument("--no-op-class", dest="op_class",
+                        action="store_false",
+                        help="Don't print op classes of instructions")
+    parser.add_argument("--no-result", dest="result", action="store_false",
+                        help="Don't print instruction results")
+    parser.add_argument("--no-eff-addr", dest="eff_addr",
+                        action="store_false",
+                        help="Don't print effective addresses")
+    args = parser.parse_args()
+
+    out = open(args.output, "w") if args.output else sys.stdout
+    with open_trace(args.trace) as f:
+        Decoder(out, args).decode(f)
+
+if __name__ == "__main__":
+    main()
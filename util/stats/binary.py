@@ -0,0 +1,294 @@
+#! /usr/bin/env python2.7
+
+# Copyright (c) 2026 The gem5-Aladdin Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Read binary stats files (--stats-binary-file) into numpy arrays. The
+# file format is described in src/base/stats/binary.hh.
+#
+# Example:
+#   stats = BinaryStats("m5out/stats.bin")
+#   ipc = stats.values("system.cpu.ipc")[:, 0]     # one value per dump
+#   misses = stats.values("system.l2.overall_misses")
+#
+# This module only needs numpy, not the rest of util/stats or gem5.
+
+from __future__ import print_function
+
+import argparse
+import struct
+import sys
+
+import numpy as np
+
+MAGIC = b"gem5sbn"
+VERSION = 1
+
+# Stat kinds, see Stats::Binary::Kind
+SCALAR, VECTOR, DIST, VECTOR_DIST, VECTOR_2D, FORMULA, SPARSE_HIST = \
+    range(1, 8)
+
+KIND_NAMES = {
+    SCALAR : "Scalar",
+    VECTOR : "Vector",
+    DIST : "Dist",
+    VECTOR_DIST : "VectorDist",
+    VECTOR_2D : "Vector2d",
+    FORMULA : "Formula",
+    SPARSE_HIST : "SparseHist",
+}
+
+# Distribution types, see Stats::DistType
+DEVIATION, DIST_TYPE, HIST = range(3)
+
+# The summary values at the start of each distribution, followed by the
+# buckets, see Stats::Binary::DistField
+DIST_FIELDS = ("samples", "sum", "squares", "logs", "min", "max",
+               "bucket_size", "min_val", "max_val", "underflow", "overflow")
+
+class Reader(object):
+    def __init__(self, data, pos=0):
+        self.data = data
+        self.pos = pos
+
+    def unpack(self, fmt):
+        vals = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += struct.calcsize(fmt)
+        return vals if len(vals) > 1 else vals[0]
+
+    def string(self):
+        length = self.unpack("=I")
+        val = self.data[self.pos:self.pos + length].decode("utf-8", "replace")
+        self.pos += length
+        return val
+
+    def strings(self):
+        return [ self.string() for _ in range(self.unpack("=I")) ]
+
+    def array(self, dtype, count):
+        arr = np.frombuffer(self.data, dtype=dtype, count=count,
+                            offset=self.pos)
+        self.pos += arr.nbytes
+        return arr
+
+class Stat(object):
+    '''Description of a stat'''
+
+    subnames = []
+    subdescs = []
+    y_subnames = []
+    formula = None
+    dist_type = None
+    size = x = y = None
+
+    def __init__(self, reader):
+        (self.id, self.kind, self.flags, self.precision, self.prereq) = \
+            reader.unpack("=IBHii")
+        self.name = reader.string()
+        self.desc = reader.string()
+
+        if self.kind in (VECTOR, FORMULA):
+            self.subnames = reader.strings()
+            self.subdescs = reader.strings()
+            if self.kind == FORMULA:
+                self.formula = reader.string()
+        elif self.kind == DIST:
+            self.dist_type = reader.unpack("=B")
+        elif self.kind == VECTOR_DIST:
+            self.dist_type, self.size = reader.unpack("=BI")
+            self.subnames = reader.strings()
+            self.subdescs = reader.strings()
+        elif self.kind == VECTOR_2D:
+            self.x, self.y = reader.unpack("=II")
+            self.subnames = reader.strings()
+            self.subdescs = reader.strings()
+            self.y_subnames = reader.strings()
+
+    def __repr__(self):
+        return "<%s %s>" % (KIND_NAMES.get(self.kind, "?"), self.name)
+
+class Layout(object):
+    '''The offsets of the stats in the values of a dump'''
+
+    def __init__(self, ids, widths):
+        self.columns = {}
+        offset = 0
+        for stat_id, width in zip(ids, widths):
+            self.columns[stat_id] = (offset, width)
+            offset += width
+        self.dumps = []
+        self.rows = []
+        self.block = None
+
+class BinaryStats(object):
+    '''All dumps in a binary stats file'''
+
+    def __init__(self, filename):
+        with open(filename, "rb") as f:
+            data = f.read()
+
+        if data[:len(MAGIC)] != MAGIC:
+            raise ValueError("%s is not a binary stats file" % filename)
+        version = ord(data[len(MAGIC):len(MAGIC) + 1])
+        if version != VERSION:
+            raise ValueError("Unsupported binary stats version %d" % version)
+
+        # Stats by name and by ID
+        self.stats = {}
+        self.ids = {}
+        # Descriptions of the dumps
+        self.descs = []
+        # Sparse histograms of each dump by stat ID
+        self.sparse_hists = []
+
+        self._layouts = []
+        self._parse(data, len(MAGIC) + 1)
+
+        # Put the values of all dumps with the same layout into one array
+        for layout in self._layouts:
+            if layout.dumps:
+                layout.block = np.vstack(layout.dumps)
+                layout.dumps = None
+
+    def _parse(self, data, pos):
+        end = len(data)
+        while pos + 5 <= end:
+            kind = data[pos:pos + 1]
+            length, = struct.unpack_from("=I", data, pos + 1)
+            pos += 5
+            if pos + length > end:
+                # Truncated, e.g. if the simulator was killed
+                break
+            reader = Reader(data, pos)
+            pos += length
+
+            if kind == b"S":
+                for _ in range(reader.unpack("=I")):
+                    stat = Stat(reader)
+                    self.stats[stat.name] = stat
+                    self.ids[stat.id] = stat
+            elif kind == b"L":
+                number, count = reader.unpack("=II")
+                assert number == len(self._layouts)
+                ids = reader.array(np.uint32, count)
+                widths = reader.array(np.uint32, count)
+                self._layouts.append(Layout(ids, widths))
+            elif kind == b"D":
+                layout = self._layouts[reader.unpack("=I")]
+                self.descs.append(reader.string())
+                values = reader.array(np.float64, reader.unpack("=I"))
+                layout.rows.append(len(self.descs) - 1)
+                layout.dumps.append(values)
+
+                sparse = {}
+                for _ in range(reader.unpack("=I")):
+                    stat_id, samples, count = reader.unpack("=IdI")
+                    buckets = reader.array(np.float64, 2 * count)
+                    sparse[stat_id] = (samples, buckets.reshape(count, 2))
+                self.sparse_hists.append(sparse)
+            else:
+                raise ValueError("Unknown chunk type %r" % kind)
+
+    def __len__(self):
+        return len(self.descs)
+
+    def names(self):
+        return sorted(self.stats.keys())
+
+    def values(self, name):
+        '''The values of a stat in each dump, as a (dumps, values) array.
+        Dumps that don't include the stat have NaN values. See
+        src/base/stats/binary.hh for the values of each kind of stat,
+        distributions can be split up with dist_values().'''
+
+        stat = self.stats[name]
+        if stat.kind == SPARSE_HIST:
+            raise ValueError("Use sparse_hist() for %s" % name)
+
+        found = [ (layout, layout.columns[stat.id])
+                  for layout in self._layouts
+                  if layout.block is not None and stat.id in layout.columns ]
+        widths = set(width for _, (_, width) in found)
+        if len(widths) > 1:
+            raise ValueError("The size of %s changes" % name)
+
+        width = widths.pop() if widths else 0
+        out = np.full((len(self), width), np.nan)
+        for layout, (offset, _) in found:
+            out[layout.rows] = layout.block[:, offset:offset + width]
+        return out
+
+    def dist_values(self, name):
+        '''The summary values and buckets of a distribution, or of each
+        distribution of a vector distribution, in each dump. Returns a
+        dict of the DIST_FIELDS and "buckets", with an extra dimension
+        for the elements of vector distributions.'''
+
+        stat = self.stats[name]
+        if stat.kind not in (DIST, VECTOR_DIST):
+            raise ValueError("%s is not a distribution" % name)
+
+        vals = self.values(name)
+        if stat.kind == VECTOR_DIST:
+            vals = vals.reshape(len(self), stat.size, -1)
+
+        fields = dict((field, vals[..., i])
+                      for i, field in enumerate(DIST_FIELDS))
+        fields["buckets"] = vals[..., len(DIST_FIELDS):]
+        return fields
+
+    def sparse_hist(self, name):
+        '''The (samples, buckets) of a sparse histogram in each dump, where
+        buckets is an array of (key, count) rows, or None if the dump
+        doesn't include the stat'''
+
+        stat_id = self.stats[name].id
+        return [ dump.get(stat_id) for dump in self.sparse_hists ]
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Print stats from a binary gem5 stats file.")
+    parser.add_argument("stats", help="Binary stats file")
+    parser.add_argument("names", nargs="*",
+                        help="Stats to print [Default: list all stats]")
+    args = parser.parse_args()
+
+    stats = BinaryStats(args.stats)
+    if not args.names:
+        print("%d dumps" % len(stats))
+        for name in stats.names():
+            print(name, KIND_NAMES[stats.stats[name].kind])
+        return
+
+    np.set_printoptions(threshold=sys.maxsize)
+    for name in args.names:
+        if stats.stats[name].kind == SPARSE_HIST:
+            print(name, stats.sparse_hist(name))
+        else:
+            print(name, stats.values(name))
+
+if __name__ == "__main__":
+    main()